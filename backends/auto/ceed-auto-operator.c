@@ -0,0 +1,375 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#define _POSIX_C_SOURCE 200112
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "ceed-auto.h"
+
+//------------------------------------------------------------------------------
+// Operator Key
+//------------------------------------------------------------------------------
+static int CeedOperatorGetKey_Auto(CeedOperator op, char key[CEED_AUTO_MAX_KEY_LEN]) {
+  const char         *kernel_name;
+  int                 len;
+  CeedInt             num_elem, Q, num_input_fields, num_output_fields;
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  CeedQFunction       qf;
+  CeedOperatorField  *op_input_fields, *op_output_fields;
+
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedQFunctionGetKernelName(qf, &kernel_name));
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+  CeedCallBackend(CeedQFunctionDestroy(&qf));
+
+  // QFunction, mesh size, and the evaluation mode, dimension, components, and nodes of each field
+  len = snprintf(key, CEED_AUTO_MAX_KEY_LEN, "%s,%" CeedInt_FMT ",%" CeedInt_FMT, kernel_name ? kernel_name : "none", num_elem, Q);
+  for (CeedInt i = 0; i < num_input_fields + num_output_fields && len < CEED_AUTO_MAX_KEY_LEN; i++) {
+    const bool         is_input = i < num_input_fields;
+    CeedInt            dim = 0, num_comp = 0, num_nodes = 0;
+    CeedEvalMode       eval_mode;
+    CeedBasis          basis;
+    CeedOperatorField  op_field = is_input ? op_input_fields[i] : op_output_fields[i - num_input_fields];
+    CeedQFunctionField qf_field = is_input ? qf_input_fields[i] : qf_output_fields[i - num_input_fields];
+
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_field, &eval_mode));
+    CeedCallBackend(CeedOperatorFieldGetBasis(op_field, &basis));
+    if (basis != CEED_BASIS_NONE) {
+      CeedCallBackend(CeedBasisGetDimension(basis, &dim));
+      CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
+      CeedCallBackend(CeedBasisGetNumNodes(basis, &num_nodes));
+    }
+    CeedCallBackend(CeedBasisDestroy(&basis));
+    len += snprintf(key + len, CEED_AUTO_MAX_KEY_LEN - len, ",%d:%" CeedInt_FMT ":%" CeedInt_FMT ":%" CeedInt_FMT, eval_mode, dim, num_comp,
+                    num_nodes);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Create Basis on Candidate Ceed
+//------------------------------------------------------------------------------
+static int CeedBasisCreateCandidate_Auto(Ceed ceed, CeedBasis basis, CeedBasis *basis_candidate) {
+  bool               is_tensor;
+  CeedInt            dim, num_comp, P_1d, Q_1d;
+  const CeedScalar  *interp_1d, *grad_1d, *q_ref_1d, *q_weight_1d;
+
+  *basis_candidate = NULL;
+  if (basis == CEED_BASIS_NONE) {
+    *basis_candidate = CEED_BASIS_NONE;
+    return CEED_ERROR_SUCCESS;
+  }
+  // Only tensor bases use the tensor contraction of the candidate backend
+  CeedCallBackend(CeedBasisIsTensor(basis, &is_tensor));
+  if (!is_tensor) {
+    CeedCallBackend(CeedBasisReferenceCopy(basis, basis_candidate));
+    return CEED_ERROR_SUCCESS;
+  }
+  CeedCallBackend(CeedBasisGetDimension(basis, &dim));
+  CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
+  CeedCallBackend(CeedBasisGetNumNodes1D(basis, &P_1d));
+  CeedCallBackend(CeedBasisGetNumQuadraturePoints1D(basis, &Q_1d));
+  CeedCallBackend(CeedBasisGetInterp1D(basis, &interp_1d));
+  CeedCallBackend(CeedBasisGetGrad1D(basis, &grad_1d));
+  CeedCallBackend(CeedBasisGetQRef(basis, &q_ref_1d));
+  CeedCallBackend(CeedBasisGetQWeights(basis, &q_weight_1d));
+  CeedCallBackend(CeedBasisCreateTensorH1(ceed, dim, num_comp, P_1d, Q_1d, interp_1d, grad_1d, q_ref_1d, q_weight_1d, basis_candidate));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Create Operator on Candidate Ceed
+//------------------------------------------------------------------------------
+static int CeedOperatorCreateCandidate_Auto(CeedOperator op, CeedInt candidate) {
+  bool                      is_symmetric, reuse_data;
+  const char               *name;
+  Ceed                      ceed;
+  CeedInt                   num_input_fields, num_output_fields, num_bases = 0, chunk_size;
+  CeedQFunctionAssemblyData data;
+  CeedBasis                 bases[2 * CEED_FIELD_MAX], bases_candidate[2 * CEED_FIELD_MAX];
+  CeedQFunction             qf, dqf, dqfT;
+  CeedOperatorField        *op_input_fields, *op_output_fields;
+  CeedOperator              op_candidate;
+  Ceed_Auto                *ceed_data;
+  CeedOperator_Auto        *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  if (impl->ops[candidate]) return CEED_ERROR_SUCCESS;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedGetData(ceed, &ceed_data));
+  CeedCallBackend(CeedDestroy(&ceed));
+
+  // The candidate shares the QFunctions, restrictions, and vectors of the operator
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedOperatorGetDQFunction(op, &dqf));
+  CeedCallBackend(CeedOperatorGetDQFunctionTranspose(op, &dqfT));
+  CeedCallBackend(CeedOperatorCreate(ceed_data->candidates[candidate], qf, dqf, dqfT, &op_candidate));
+  CeedCallBackend(CeedQFunctionDestroy(&qf));
+  CeedCallBackend(CeedQFunctionDestroy(&dqf));
+  CeedCallBackend(CeedQFunctionDestroy(&dqfT));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+    const char         *field_name;
+    CeedInt             b = 0;
+    CeedVector          vec;
+    CeedElemRestriction rstr;
+    CeedBasis           basis;
+    CeedOperatorField   op_field = i < num_input_fields ? op_input_fields[i] : op_output_fields[i - num_input_fields];
+
+    CeedCallBackend(CeedOperatorFieldGetData(op_field, &field_name, &rstr, &basis, &vec));
+    // Recreate each distinct basis once
+    while (b < num_bases && bases[b] != basis) b++;
+    if (b == num_bases) {
+      bases[b] = basis;
+      CeedCallBackend(CeedBasisCreateCandidate_Auto(ceed_data->candidates[candidate], basis, &bases_candidate[b]));
+      num_bases++;
+    }
+    CeedCallBackend(CeedOperatorSetField(op_candidate, field_name, rstr, bases_candidate[b], vec));
+    CeedCallBackend(CeedVectorDestroy(&vec));
+    CeedCallBackend(CeedElemRestrictionDestroy(&rstr));
+    CeedCallBackend(CeedBasisDestroy(&basis));
+  }
+  for (CeedInt b = 0; b < num_bases; b++) CeedCallBackend(CeedBasisDestroy(&bases_candidate[b]));
+  CeedCallBackend(CeedOperatorGetName(op, &name));
+  CeedCallBackend(CeedOperatorSetName(op_candidate, name));
+  // The candidate inherits the chunk size, symmetry, and QFunction assembly reuse settings of the operator
+  CeedCallBackend(CeedOperatorGetChunkSize(op, &chunk_size));
+  CeedCallBackend(CeedOperatorSetChunkSize(op_candidate, chunk_size));
+  CeedCallBackend(CeedOperatorIsSymmetric(op, &is_symmetric));
+  CeedCallBackend(CeedOperatorSetSymmetric(op_candidate, is_symmetric));
+  CeedCallBackend(CeedOperatorGetQFunctionAssemblyData(op, &data));
+  CeedCallBackend(CeedQFunctionAssemblyDataIsReuse(data, &reuse_data));
+  CeedCallBackend(CeedOperatorSetQFunctionAssemblyReuse(op_candidate, reuse_data));
+  CeedCallBackend(CeedOperatorCheckReady(op_candidate));
+  if (impl->elem_mask) CeedCallBackend(CeedOperatorSetElementMask(op_candidate, impl->elem_mask));
+  impl->ops[candidate] = op_candidate;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Wall-Clock Time in Seconds
+//------------------------------------------------------------------------------
+static double CeedGetWallTime_Auto(void) {
+  struct timespec time;
+
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (double)time.tv_sec + 1e-9 * (double)time.tv_nsec;
+}
+
+//------------------------------------------------------------------------------
+// Select Candidate Backend
+//------------------------------------------------------------------------------
+static int CeedOperatorSelect_Auto(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  bool               has_passive_output, is_from_cache;
+  char               key[CEED_AUTO_MAX_KEY_LEN];
+  Ceed               ceed;
+  CeedInt            num_elem, Q, num_output_fields;
+  CeedSize           out_length;
+  double             best_time = -1.0;
+  CeedVector         out_tmp;
+  CeedOperatorField *op_output_fields;
+  Ceed_Auto         *ceed_data;
+  CeedOperator_Auto *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  if (impl->selected >= 0) return CEED_ERROR_SUCCESS;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedGetData(ceed, &ceed_data));
+
+  // Selection from this run or the cache file
+  CeedCallBackend(CeedOperatorGetKey_Auto(op, key));
+  CeedCallBackend(CeedGetSelection_Auto(ceed, key, &impl->selected, &is_from_cache));
+  if (impl->selected >= 0) impl->source = is_from_cache ? CEED_AUTO_SELECTION_CACHED : CEED_AUTO_SELECTION_REUSED;
+
+  // Timed applications write to a scratch output, so passive outputs or a missing active output use the default candidate
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  has_passive_output = out_vec == CEED_VECTOR_NONE;
+  CeedCallBackend(CeedOperatorGetFields(op, NULL, NULL, &num_output_fields, &op_output_fields));
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedVector vec;
+
+    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
+    has_passive_output |= vec != CEED_VECTOR_ACTIVE;
+    CeedCallBackend(CeedVectorDestroy(&vec));
+  }
+  if (impl->selected < 0 && (has_passive_output || ceed_data->num_candidates == 1 || num_elem * Q < CEED_AUTO_MIN_TIMED_QPTS)) impl->selected = 0;
+  if (impl->selected >= 0) {
+    CeedCallBackend(CeedOperatorCreateCandidate_Auto(op, impl->selected));
+    CeedCallBackend(CeedDestroy(&ceed));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Time each candidate
+  CeedCallBackend(CeedVectorGetLength(out_vec, &out_length));
+  CeedCallBackend(CeedVectorCreate(ceed, out_length, &out_tmp));
+  CeedCallBackend(CeedVectorSetValue(out_tmp, 0.0));
+  for (CeedInt c = 0; c < ceed_data->num_candidates; c++) {
+    CeedInt num_reps = 0;
+    double  start, elapsed = 0.0;
+
+    CeedCallBackend(CeedOperatorCreateCandidate_Auto(op, c));
+    // Warm up, including backend setup
+    CeedCallBackend(CeedOperatorApplyAdd(impl->ops[c], in_vec, out_tmp, request));
+    // Operators slower than the minimum time are timed with a single application; faster ones repeat to resolve the timer
+    start = CeedGetWallTime_Auto();
+    while (num_reps < CEED_AUTO_MAX_REPS && (num_reps == 0 || elapsed < CEED_AUTO_MIN_TIME)) {
+      CeedCallBackend(CeedOperatorApplyAdd(impl->ops[c], in_vec, out_tmp, request));
+      elapsed = CeedGetWallTime_Auto() - start;
+      num_reps++;
+    }
+    const double rep_time = elapsed / num_reps;
+
+    if (best_time < 0.0 || rep_time < best_time) {
+      best_time      = rep_time;
+      impl->selected = c;
+    }
+  }
+  CeedCallBackend(CeedVectorDestroy(&out_tmp));
+
+  // Keep only the selected candidate
+  for (CeedInt c = 0; c < ceed_data->num_candidates; c++) {
+    if (c != impl->selected) CeedCallBackend(CeedOperatorDestroy(&impl->ops[c]));
+  }
+  impl->source = CEED_AUTO_SELECTION_TIMED;
+  CeedCallBackend(CeedSetSelection_Auto(ceed, key, impl->selected, true));
+  CeedCallBackend(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Auto(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  CeedOperator_Auto *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorSelect_Auto(op, in_vec, out_vec, request));
+  CeedCallBackend(CeedOperatorApplyAdd(impl->ops[impl->selected], in_vec, out_vec, request));
+  return CEED_ERROR_SUCCESS;
+}
+
+static int CeedOperatorApplyAddScaled_Auto(CeedOperator op, CeedScalar alpha, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  CeedOperator_Auto *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorSelect_Auto(op, in_vec, out_vec, request));
+  CeedCallBackend(CeedOperatorApplyAddScaled(impl->ops[impl->selected], alpha, in_vec, out_vec, request));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply to Multiple Vectors
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddMulti_Auto(CeedOperator op, CeedInt num_vecs, CeedVector *in_vecs, CeedVector *out_vecs, CeedRequest *request) {
+  CeedOperator_Auto *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorSelect_Auto(op, in_vecs[0], out_vecs[0], request));
+  CeedCallBackend(CeedOperatorApplyAddMulti(impl->ops[impl->selected], num_vecs, in_vecs, out_vecs, request));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Set Element Mask
+//------------------------------------------------------------------------------
+static int CeedOperatorSetElementMask_Auto(CeedOperator op, const bool *mask) {
+  CeedInt            num_elem, num_candidates;
+  Ceed               ceed;
+  Ceed_Auto         *ceed_data;
+  CeedOperator_Auto *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedGetData(ceed, &ceed_data));
+  CeedCallBackend(CeedDestroy(&ceed));
+  num_candidates = ceed_data->num_candidates;
+  CeedCallBackend(CeedFree(&impl->elem_mask));
+  if (mask) {
+    CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+    CeedCallBackend(CeedCalloc(num_elem, &impl->elem_mask));
+    memcpy(impl->elem_mask, mask, num_elem * sizeof(bool));
+  }
+  for (CeedInt c = 0; c < num_candidates; c++) {
+    if (impl->ops[c]) CeedCallBackend(CeedOperatorSetElementMask(impl->ops[c], mask));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator View
+//------------------------------------------------------------------------------
+static int CeedOperatorView_Auto(CeedOperator op, bool sub, FILE *stream) {
+  const char        *resource;
+  const char *const  source_labels[] = {"default", "timed", "timed earlier in this run", "cached"};
+  Ceed               ceed;
+  Ceed_Auto         *ceed_data;
+  CeedOperator_Auto *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  if (impl->selected < 0) return CEED_ERROR_SUCCESS;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedGetData(ceed, &ceed_data));
+  CeedCallBackend(CeedGetResource(ceed_data->candidates[impl->selected], &resource));
+  CeedCallBackend(CeedDestroy(&ceed));
+  fprintf(stream, "%s  Selected backend: %s (%s)\n", sub ? "  " : "", resource, source_labels[impl->source]);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Destroy
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroy_Auto(CeedOperator op) {
+  Ceed               ceed;
+  Ceed_Auto         *ceed_data;
+  CeedOperator_Auto *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedGetData(ceed, &ceed_data));
+  CeedCallBackend(CeedDestroy(&ceed));
+  for (CeedInt c = 0; c < ceed_data->num_candidates; c++) CeedCallBackend(CeedOperatorDestroy(&impl->ops[c]));
+  CeedCallBackend(CeedFree(&impl->ops));
+  CeedCallBackend(CeedFree(&impl->elem_mask));
+  CeedCallBackend(CeedFree(&impl));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Create
+//------------------------------------------------------------------------------
+int CeedOperatorCreate_Auto(CeedOperator op) {
+  Ceed               ceed;
+  Ceed_Auto         *ceed_data;
+  CeedOperator_Auto *impl;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedGetData(ceed, &ceed_data));
+  CeedCallBackend(CeedCalloc(1, &impl));
+  CeedCallBackend(CeedCalloc(ceed_data->num_candidates, &impl->ops));
+  impl->selected = -1;
+  CeedCallBackend(CeedOperatorSetData(op, impl));
+
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd", CeedOperatorApplyAdd_Auto));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddScaled", CeedOperatorApplyAddScaled_Auto));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddMulti", CeedOperatorApplyAddMulti_Auto));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "SetElementMask", CeedOperatorSetElementMask_Auto));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "View", CeedOperatorView_Auto));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroy_Auto));
+  CeedCallBackend(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,164 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include "ceed-auto.h"
+
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Candidate backends, in order of preference when no timing is available
+static const char *const candidate_resources[] = {"/cpu/self/opt/blocked", "/cpu/self/avx/blocked", "/cpu/self/xsmm/blocked", "/cpu/self/ref/blocked"};
+
+//------------------------------------------------------------------------------
+// Get Selection for Operator Key
+//------------------------------------------------------------------------------
+int CeedGetSelection_Auto(Ceed ceed, const char *key, CeedInt *candidate, bool *is_from_cache) {
+  Ceed_Auto *data;
+
+  CeedCallBackend(CeedGetData(ceed, &data));
+  *candidate     = -1;
+  *is_from_cache = false;
+  for (CeedInt i = 0; i < data->num_entries; i++) {
+    if (!strcmp(data->entries[i].key, key)) {
+      *candidate     = data->entries[i].candidate;
+      *is_from_cache = data->entries[i].is_from_cache;
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Set Selection for Operator Key
+//------------------------------------------------------------------------------
+int CeedSetSelection_Auto(Ceed ceed, const char *key, CeedInt candidate, bool write_cache) {
+  Ceed_Auto *data;
+
+  CeedCallBackend(CeedGetData(ceed, &data));
+  if (data->num_entries == data->max_entries) {
+    data->max_entries = data->max_entries ? 2 * data->max_entries : 16;
+    CeedCallBackend(CeedRealloc(data->max_entries, &data->entries));
+  }
+  strncpy(data->entries[data->num_entries].key, key, CEED_AUTO_MAX_KEY_LEN - 1);
+  data->entries[data->num_entries].key[CEED_AUTO_MAX_KEY_LEN - 1] = 0;
+  data->entries[data->num_entries].candidate                      = candidate;
+  data->entries[data->num_entries].is_from_cache                  = !write_cache;
+  data->num_entries++;
+
+  // Append to cache file
+  if (write_cache && data->cache_path) {
+    const char *resource;
+    FILE       *file = fopen(data->cache_path, "a");
+
+    CeedCheck(file, ceed, CEED_ERROR_BACKEND, "Could not open selection cache file: %s", data->cache_path);
+    CeedCallBackend(CeedGetResource(data->candidates[candidate], &resource));
+    fprintf(file, "%s\t%s\n", resource, key);
+    fclose(file);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Read Selection Cache File
+//   Each line is the selected resource and the operator key, separated by a tab; keys may contain spaces
+//------------------------------------------------------------------------------
+static int CeedReadSelectionCache_Auto(Ceed ceed) {
+  char       line[CEED_MAX_RESOURCE_LEN + CEED_AUTO_MAX_KEY_LEN + 2];
+  FILE      *file;
+  Ceed_Auto *data;
+
+  CeedCallBackend(CeedGetData(ceed, &data));
+  file = fopen(data->cache_path, "r");
+  if (!file) return CEED_ERROR_SUCCESS;
+  while (fgets(line, sizeof(line), file)) {
+    char *resource = line, *key = strchr(line, '\t');
+
+    // Skip malformed lines and selections of backends that are not compiled in this build
+    line[strcspn(line, "\r\n")] = 0;
+    if (!key) continue;
+    *key++ = 0;
+    for (CeedInt i = 0; i < data->num_candidates; i++) {
+      const char *candidate_resource;
+
+      CeedCallBackend(CeedGetResource(data->candidates[i], &candidate_resource));
+      if (!strcmp(resource, candidate_resource)) CeedCallBackend(CeedSetSelection_Auto(ceed, key, i, false));
+    }
+  }
+  fclose(file);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Backend Destroy
+//------------------------------------------------------------------------------
+static int CeedDestroy_Auto(Ceed ceed) {
+  Ceed_Auto *data;
+
+  CeedCallBackend(CeedGetData(ceed, &data));
+  for (CeedInt i = 0; i < data->num_candidates; i++) CeedCallBackend(CeedDestroy(&data->candidates[i]));
+  CeedCallBackend(CeedFree(&data->candidates));
+  CeedCallBackend(CeedFree(&data->entries));
+  CeedCallBackend(CeedFree(&data->cache_path));
+  CeedCallBackend(CeedFree(&data));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Backend Init
+//------------------------------------------------------------------------------
+static int CeedInit_Auto(const char *resource, Ceed ceed) {
+  const char *cache_spec = strstr(resource, ":cache=");
+  char       *resource_root;
+  size_t      num_compiled;
+  char      **compiled_resources;
+  Ceed_Auto  *data;
+
+  CeedCallBackend(CeedGetResourceRoot(ceed, resource, ":", &resource_root));
+  CeedCheck(!strcmp(resource_root, "/cpu/self/auto"), ceed, CEED_ERROR_BACKEND, "Auto backend cannot use resource: %s", resource);
+  CeedCallBackend(CeedFree(&resource_root));
+  CeedCallBackend(CeedSetDeterministic(ceed, true));
+
+  CeedCallBackend(CeedCalloc(1, &data));
+  CeedCallBackend(CeedSetData(ceed, data));
+
+  // Create candidate Ceeds for the compiled backends
+  CeedCallBackend(CeedRegistryGetList(&num_compiled, &compiled_resources, NULL));
+  CeedCallBackend(CeedCalloc(sizeof(candidate_resources) / sizeof(candidate_resources[0]), &data->candidates));
+  for (size_t i = 0; i < sizeof(candidate_resources) / sizeof(candidate_resources[0]); i++) {
+    for (size_t j = 0; j < num_compiled; j++) {
+      if (!strcmp(candidate_resources[i], compiled_resources[j])) {
+        CeedCallBackend(CeedInit(candidate_resources[i], &data->candidates[data->num_candidates]));
+        data->num_candidates++;
+      }
+    }
+  }
+  free(compiled_resources);
+
+  // Default candidate handles all other objects and operator fallback
+  CeedCallBackend(CeedSetDelegate(ceed, data->candidates[0]));
+  CeedCallBackend(CeedSetOperatorFallbackCeed(ceed, data->candidates[0]));
+
+  // Selection cache
+  if (cache_spec) {
+    CeedCallBackend(CeedStringAllocCopy(cache_spec + 7, &data->cache_path));
+    CeedCallBackend(CeedReadSelectionCache_Auto(ceed));
+  }
+
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy", CeedDestroy_Auto));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "OperatorCreate", CeedOperatorCreate_Auto));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Backend Register
+//------------------------------------------------------------------------------
+CEED_INTERN int CeedRegister_Auto(void) { return CeedRegister("/cpu/self/auto", CeedInit_Auto, 60); }
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,55 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+#pragma once
+
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <stdbool.h>
+
+// Maximum length of an operator key in the selection table
+#define CEED_AUTO_MAX_KEY_LEN 1024
+
+// Operators with fewer quadrature points over all elements are too fast to time reliably and use the default candidate
+#define CEED_AUTO_MIN_TIMED_QPTS 16384
+
+// Wall-clock seconds of timed applications per candidate before repeating stops, and cap on repeats for fast operators
+#define CEED_AUTO_MIN_TIME 1e-4
+#define CEED_AUTO_MAX_REPS 16
+
+// Origin of an operator's candidate selection, reported by CeedOperatorView
+typedef enum {
+  CEED_AUTO_SELECTION_DEFAULT = 0, /* Default candidate, operator too small or not timeable */
+  CEED_AUTO_SELECTION_TIMED   = 1, /* Candidates timed for this operator */
+  CEED_AUTO_SELECTION_REUSED  = 2, /* Candidates timed earlier in this run for an operator of the same shape */
+  CEED_AUTO_SELECTION_CACHED  = 3, /* Read from the cache file */
+} CeedAutoSelectionSource;
+
+typedef struct {
+  char    key[CEED_AUTO_MAX_KEY_LEN]; /* Operator shape, see CeedOperatorGetKey_Auto */
+  CeedInt candidate;                  /* Index of selected candidate Ceed */
+  bool    is_from_cache;              /* Entry was read from the cache file */
+} CeedAutoEntry;
+
+typedef struct {
+  CeedInt        num_candidates;
+  Ceed          *candidates; /* Candidate backends, default first */
+  CeedInt        num_entries, max_entries;
+  CeedAutoEntry *entries;    /* Selection table, keyed by operator shape */
+  char          *cache_path; /* File to read and append selections, NULL for none */
+} Ceed_Auto;
+
+typedef struct {
+  CeedInt                 selected;  /* Index of selected candidate, -1 before selection */
+  CeedAutoSelectionSource source;    /* Origin of the selection */
+  CeedOperator           *ops;       /* Operators on candidate backends, built on first application */
+  bool                   *elem_mask; /* Elements to apply the operator on, NULL for all elements */
+} CeedOperator_Auto;
+
+CEED_INTERN int CeedGetSelection_Auto(Ceed ceed, const char *key, CeedInt *candidate, bool *is_from_cache);
+CEED_INTERN int CeedSetSelection_Auto(Ceed ceed, const char *key, CeedInt candidate, bool write_cache);
+
+CEED_INTERN int CeedOperatorCreate_Auto(CeedOperator op);
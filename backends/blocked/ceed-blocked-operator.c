@@ -10,15 +10,18 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
+#include "../ref/ceed-ref.h"
 #include "ceed-blocked.h"
 
 //------------------------------------------------------------------------------
 // Setup Input/Output Fields
 //------------------------------------------------------------------------------
 static int CeedOperatorSetupFields_Blocked(CeedQFunction qf, CeedOperator op, bool is_input, bool *skip_rstr, CeedInt *e_data_out_indices,
-                                           bool *apply_add_basis, const CeedInt block_size, CeedElemRestriction *block_rstr, CeedVector *e_vecs_full,
-                                           CeedVector *e_vecs, CeedVector *q_vecs, CeedInt start_e, CeedInt num_fields, CeedInt Q) {
+                                           bool *apply_add_basis, bool *is_elem_shared, const CeedInt block_size, CeedElemRestriction *block_rstr, CeedVector *e_vecs_full,
+                                           CeedVector *e_vecs, CeedVector *q_vecs, CeedInt start_e, CeedInt num_fields, CeedInt Q,
+                                           CeedInt chunk_size) {
   Ceed                ceed;
   CeedSize            e_size, q_size;
   CeedInt             num_comp, size, P;
@@ -48,67 +51,32 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf, CeedOperator op, bo
 
     CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_fields[i], &eval_mode));
     if (eval_mode != CEED_EVAL_WEIGHT) {
-      Ceed                ceed_rstr;
-      CeedSize            l_size;
-      CeedInt             num_elem, elem_size, comp_stride;
-      CeedRestrictionType rstr_type;
+      CeedInt             elem_size;
       CeedElemRestriction rstr;
 
       CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_fields[i], &rstr));
-      CeedCallBackend(CeedElemRestrictionGetCeed(rstr, &ceed_rstr));
-      CeedCallBackend(CeedElemRestrictionGetNumElements(rstr, &num_elem));
       CeedCallBackend(CeedElemRestrictionGetElementSize(rstr, &elem_size));
-      CeedCallBackend(CeedElemRestrictionGetLVectorSize(rstr, &l_size));
       CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
-      CeedCallBackend(CeedElemRestrictionGetCompStride(rstr, &comp_stride));
-
-      CeedCallBackend(CeedElemRestrictionGetType(rstr, &rstr_type));
-      switch (rstr_type) {
-        case CEED_RESTRICTION_STANDARD: {
-          const CeedInt *offsets = NULL;
-
-          CeedCallBackend(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
-          CeedCallBackend(CeedElemRestrictionCreateBlocked(ceed_rstr, num_elem, elem_size, block_size, num_comp, comp_stride, l_size, CEED_MEM_HOST,
-                                                           CEED_COPY_VALUES, offsets, &block_rstr[i + start_e]));
-          CeedCallBackend(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
-        } break;
-        case CEED_RESTRICTION_ORIENTED: {
-          const bool    *orients = NULL;
-          const CeedInt *offsets = NULL;
-
-          CeedCallBackend(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
-          CeedCallBackend(CeedElemRestrictionGetOrientations(rstr, CEED_MEM_HOST, &orients));
-          CeedCallBackend(CeedElemRestrictionCreateBlockedOriented(ceed_rstr, num_elem, elem_size, block_size, num_comp, comp_stride, l_size,
-                                                                   CEED_MEM_HOST, CEED_COPY_VALUES, offsets, orients, &block_rstr[i + start_e]));
-          CeedCallBackend(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
-          CeedCallBackend(CeedElemRestrictionRestoreOrientations(rstr, &orients));
-        } break;
-        case CEED_RESTRICTION_CURL_ORIENTED: {
-          const CeedInt8 *curl_orients = NULL;
-          const CeedInt  *offsets      = NULL;
-
-          CeedCallBackend(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
-          CeedCallBackend(CeedElemRestrictionGetCurlOrientations(rstr, CEED_MEM_HOST, &curl_orients));
-          CeedCallBackend(CeedElemRestrictionCreateBlockedCurlOriented(ceed_rstr, num_elem, elem_size, block_size, num_comp, comp_stride, l_size,
-                                                                       CEED_MEM_HOST, CEED_COPY_VALUES, offsets, curl_orients,
-                                                                       &block_rstr[i + start_e]));
-          CeedCallBackend(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
-          CeedCallBackend(CeedElemRestrictionRestoreCurlOrientations(rstr, &curl_orients));
-        } break;
-        case CEED_RESTRICTION_STRIDED: {
-          CeedInt strides[3];
-
-          CeedCallBackend(CeedElemRestrictionGetStrides(rstr, strides));
-          CeedCallBackend(CeedElemRestrictionCreateBlockedStrided(ceed_rstr, num_elem, elem_size, block_size, num_comp, l_size, strides,
-                                                                  &block_rstr[i + start_e]));
-        } break;
-        case CEED_RESTRICTION_POINTS:
-          // Empty case - won't occur
-          break;
+      CeedCallBackend(CeedElemRestrictionGetBlocked(rstr, block_size, &block_rstr[i + start_e]));
+
+      // Active inputs and all outputs only hold one chunk of elements; passive inputs are kept in full, unless shared by all elements
+      {
+        bool       is_active, is_chunked;
+        CeedVector vec;
+
+        CeedCallBackend(CeedOperatorFieldGetVector(op_fields[i], &vec));
+        is_active = vec == CEED_VECTOR_ACTIVE;
+        CeedCallBackend(CeedVectorDestroy(&vec));
+        is_chunked = chunk_size > 0 && (!is_input || is_active);
+        if (is_input && !is_active) CeedCallBackend(CeedElemRestrictionIsElementShared(rstr, &is_elem_shared[i]));
+        if (is_chunked || (is_input && is_elem_shared[i])) {
+          e_size = (CeedSize)(is_chunked ? chunk_size : block_size) * elem_size * num_comp;
+          CeedCallBackend(CeedVectorCreate(ceed, e_size, &e_vecs_full[i + start_e]));
+        } else {
+          CeedCallBackend(CeedElemRestrictionCreateVector(block_rstr[i + start_e], NULL, &e_vecs_full[i + start_e]));
+        }
       }
-      CeedCallBackend(CeedDestroy(&ceed_rstr));
       CeedCallBackend(CeedElemRestrictionDestroy(&rstr));
-      CeedCallBackend(CeedElemRestrictionCreateVector(block_rstr[i + start_e], NULL, &e_vecs_full[i + start_e]));
     }
 
     switch (eval_mode) {
@@ -235,14 +203,53 @@ static int CeedOperatorSetup_Blocked(CeedOperator op) {
   impl->num_inputs  = num_input_fields;
   impl->num_outputs = num_output_fields;
 
-  // Set up infield and outfield pointer arrays
-  // Infields
-  CeedCallBackend(CeedOperatorSetupFields_Blocked(qf, op, true, impl->skip_rstr_in, NULL, NULL, block_size, impl->block_rstr, impl->e_vecs_full,
-                                                  impl->e_vecs_in, impl->q_vecs_in, 0, num_input_fields, Q));
-  // Outfields
-  CeedCallBackend(CeedOperatorSetupFields_Blocked(qf, op, false, impl->skip_rstr_out, impl->e_data_out_indices, impl->apply_add_basis_out, block_size,
-                                                  impl->block_rstr, impl->e_vecs_full, impl->e_vecs_out, impl->q_vecs_out, num_input_fields,
-                                                  num_output_fields, Q));
+  // Chunk size, in whole blocks of elements
+  {
+    CeedInt chunk_size, num_elem, num_blocks;
+
+    CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+    CeedCallBackend(CeedOperatorGetChunkSize(op, &chunk_size));
+    num_blocks = (num_elem / block_size) + !!(num_elem % block_size);
+    if (chunk_size == -1) {
+      CeedSize elem_bytes = 0;
+
+      // Size chunks so the active input and output E-vectors fit in cache
+      for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+        bool                is_input = i < num_input_fields;
+        CeedInt             elem_size, num_comp;
+        CeedEvalMode        eval_mode;
+        CeedVector          vec;
+        CeedElemRestriction elem_rstr;
+        CeedOperatorField   op_field = is_input ? op_input_fields[i] : op_output_fields[i - num_input_fields];
+
+        CeedCallBackend(CeedQFunctionFieldGetEvalMode(is_input ? qf_input_fields[i] : qf_output_fields[i - num_input_fields], &eval_mode));
+        if (eval_mode == CEED_EVAL_WEIGHT) continue;
+        CeedCallBackend(CeedOperatorFieldGetVector(op_field, &vec));
+        if (!is_input || vec == CEED_VECTOR_ACTIVE) {
+          CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_field, &elem_rstr));
+          CeedCallBackend(CeedElemRestrictionGetElementSize(elem_rstr, &elem_size));
+          CeedCallBackend(CeedElemRestrictionGetNumComponents(elem_rstr, &num_comp));
+          CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
+          elem_bytes += (CeedSize)elem_size * num_comp * sizeof(CeedScalar);
+        }
+        CeedCallBackend(CeedVectorDestroy(&vec));
+      }
+      chunk_size = elem_bytes > 0 ? CeedIntMax(1, (CeedInt)(CEED_BLOCKED_CHUNK_BYTES / elem_bytes)) : 0;
+    }
+    chunk_size       = ((chunk_size + block_size - 1) / block_size) * block_size;
+    impl->chunk_size = (chunk_size <= 0 || chunk_size > num_blocks * block_size) ? num_blocks * block_size : chunk_size;
+    chunk_size       = impl->chunk_size < num_blocks * block_size ? impl->chunk_size : 0;
+
+    // Set up infield and outfield pointer arrays
+    // Infields
+    CeedCallBackend(CeedOperatorSetupFields_Blocked(qf, op, true, impl->skip_rstr_in, NULL, NULL, impl->is_elem_shared_in, block_size,
+                                                    impl->block_rstr, impl->e_vecs_full, impl->e_vecs_in, impl->q_vecs_in, 0, num_input_fields, Q,
+                                                    chunk_size));
+    // Outfields
+    CeedCallBackend(CeedOperatorSetupFields_Blocked(qf, op, false, impl->skip_rstr_out, impl->e_data_out_indices, impl->apply_add_basis_out, NULL,
+                                                    block_size, impl->block_rstr, impl->e_vecs_full, impl->e_vecs_out, impl->q_vecs_out,
+                                                    num_input_fields, num_output_fields, Q, chunk_size));
+  }
 
   // Identity QFunctions
   if (impl->is_identity_qf) {
@@ -291,7 +298,12 @@ static inline int CeedOperatorSetupInputs_Blocked(CeedInt num_input_fields, Ceed
       // Restrict
       CeedCallBackend(CeedVectorGetState(vec, &state));
       if ((state != impl->input_states[i] || vec == in_vec) && !impl->skip_rstr_in[i]) {
-        CeedCallBackend(CeedElemRestrictionApply(impl->block_rstr[i], CEED_NOTRANSPOSE, vec, impl->e_vecs_full[i], request));
+        if (impl->is_elem_shared_in[i]) {
+          // Inputs shared by all elements only restrict the first element block
+          CeedCallBackend(CeedElemRestrictionApplyRange(impl->block_rstr[i], 0, 1, CEED_NOTRANSPOSE, vec, impl->e_vecs_full[i], request));
+        } else {
+          CeedCallBackend(CeedElemRestrictionApply(impl->block_rstr[i], CEED_NOTRANSPOSE, vec, impl->e_vecs_full[i], request));
+        }
       }
       impl->input_states[i] = state;
       // Get evec
@@ -305,25 +317,24 @@ static inline int CeedOperatorSetupInputs_Blocked(CeedInt num_input_fields, Ceed
 //------------------------------------------------------------------------------
 // Input Basis Action
 //------------------------------------------------------------------------------
-static inline int CeedOperatorInputBasis_Blocked(CeedInt e, CeedInt Q, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-                                                 CeedInt num_input_fields, CeedInt block_size, bool skip_active,
+static inline int CeedOperatorInputBasis_Blocked(CeedInt e, CeedInt e_start, CeedInt Q, CeedQFunctionField *qf_input_fields,
+                                                 CeedOperatorField *op_input_fields, CeedInt num_input_fields, CeedInt block_size, bool skip_active,
                                                  CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedOperator_Blocked *impl) {
   for (CeedInt i = 0; i < num_input_fields; i++) {
-    CeedInt             elem_size, size, num_comp;
+    bool                is_active;
+    CeedInt             e_field, elem_size, size, num_comp;
     CeedEvalMode        eval_mode;
+    CeedVector          vec;
     CeedElemRestriction elem_rstr;
     CeedBasis           basis;
 
     // Skip active input
-    if (skip_active) {
-      bool       is_active;
-      CeedVector vec;
-
-      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-      is_active = vec == CEED_VECTOR_ACTIVE;
-      CeedCallBackend(CeedVectorDestroy(&vec));
-      if (is_active) continue;
-    }
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    is_active = vec == CEED_VECTOR_ACTIVE;
+    CeedCallBackend(CeedVectorDestroy(&vec));
+    if (skip_active && is_active) continue;
+    // Active E-vectors only hold the current chunk of elements, and E-vectors of inputs shared by all elements only hold one element block
+    e_field = is_active ? e - e_start : (impl->is_elem_shared_in[i] ? 0 : e);
 
     // Get elem_size, eval_mode, size
     CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_rstr));
@@ -334,7 +345,7 @@ static inline int CeedOperatorInputBasis_Blocked(CeedInt e, CeedInt Q, CeedQFunc
     // Basis action
     switch (eval_mode) {
       case CEED_EVAL_NONE:
-        CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * Q * size]));
+        CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e_field * Q * size]));
         break;
       case CEED_EVAL_INTERP:
       case CEED_EVAL_GRAD:
@@ -342,7 +353,8 @@ static inline int CeedOperatorInputBasis_Blocked(CeedInt e, CeedInt Q, CeedQFunc
       case CEED_EVAL_CURL:
         CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[i], &basis));
         CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * elem_size * num_comp]));
+        CeedCallBackend(
+            CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e_field * elem_size * num_comp]));
         CeedCallBackend(CeedBasisApply(basis, block_size, CEED_NOTRANSPOSE, eval_mode, impl->e_vecs_in[i], impl->q_vecs_in[i]));
         CeedCallBackend(CeedBasisDestroy(&basis));
         break;
@@ -427,9 +439,56 @@ static inline int CeedOperatorRestoreInputs_Blocked(CeedInt num_input_fields, Ce
 }
 
 //------------------------------------------------------------------------------
-// Operator Apply
+// Check if a range of elements contains elements selected by the element mask
 //------------------------------------------------------------------------------
-static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+static inline bool CeedOperatorIsRangeActive_Blocked(CeedInt e_start, CeedInt e_stop, CeedInt num_elem, CeedOperator_Blocked *impl) {
+  if (!impl->elem_mask) return true;
+  for (CeedInt e = e_start; e < CeedIntMin(e_stop, num_elem); e++) {
+    if (impl->elem_mask[e]) return true;
+  }
+  return false;
+}
+
+//------------------------------------------------------------------------------
+// Get the Next Range of Element Blocks Selected by the Element Mask
+//------------------------------------------------------------------------------
+// Advances e_start to the next block with a selected element and sets e_stop to the end of its run of such blocks, at most one chunk long.
+// An empty range, e_start == e_stop, marks the end of the element blocks.
+static inline void CeedOperatorGetNextRange_Blocked(CeedInt num_elem, CeedInt block_size, CeedOperator_Blocked *impl, CeedInt *e_start,
+                                                    CeedInt *e_stop) {
+  const CeedInt e_end = ((num_elem / block_size) + !!(num_elem % block_size)) * block_size;
+
+  while (*e_start < e_end && !CeedOperatorIsRangeActive_Blocked(*e_start, *e_start + block_size, num_elem, impl)) *e_start += block_size;
+  *e_stop = *e_start;
+  while (*e_stop < CeedIntMin(*e_start + impl->chunk_size, e_end) && CeedOperatorIsRangeActive_Blocked(*e_stop, *e_stop + block_size, num_elem, impl)) {
+    *e_stop += block_size;
+  }
+}
+
+//------------------------------------------------------------------------------
+// Zero E-vector Data of Elements Not Selected by the Element Mask
+//------------------------------------------------------------------------------
+static inline int CeedOperatorZeroMaskedElements_Blocked(CeedInt e_start, CeedInt e_stop, CeedInt num_elem, CeedInt block_size,
+                                                         CeedElemRestriction block_rstr, CeedScalar *e_data, CeedOperator_Blocked *impl) {
+  CeedInt elem_size, num_comp;
+
+  CeedCallBackend(CeedElemRestrictionGetElementSize(block_rstr, &elem_size));
+  CeedCallBackend(CeedElemRestrictionGetNumComponents(block_rstr, &num_comp));
+  for (CeedInt e = e_start; e < CeedIntMin(e_stop, num_elem); e++) {
+    const CeedSize block_offset = (CeedSize)((e - e_start) / block_size) * elem_size * num_comp * block_size;
+
+    if (impl->elem_mask[e]) continue;
+    for (CeedInt k = 0; k < elem_size * num_comp; k++) e_data[block_offset + k * block_size + (e - e_start) % block_size] = 0.0;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply to One or More Vectors
+//   Passive inputs are restricted once and each chunk of element blocks is applied to every vector before the next chunk
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddScaledMulti_Blocked(CeedOperator op, CeedScalar alpha, CeedInt num_vecs, CeedVector *in_vecs, CeedVector *out_vecs,
+                                                   CeedRequest *request) {
   CeedInt               Q, num_input_fields, num_output_fields, num_elem, size;
   const CeedInt         block_size = 8;
   CeedEvalMode          eval_mode;
@@ -441,84 +500,158 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec, Ceed
 
   // Setup
   CeedCallBackend(CeedOperatorSetup_Blocked(op));
+  if (num_vecs == 0) return CEED_ERROR_SUCCESS;
 
   CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  const CeedInt num_blocks = (num_elem / block_size) + !!(num_elem % block_size);
 
   // Restriction only operator
   if (impl->is_identity_rstr_op) {
-    CeedCallBackend(CeedElemRestrictionApply(impl->block_rstr[0], CEED_NOTRANSPOSE, in_vec, impl->e_vecs_full[0], request));
-    CeedCallBackend(CeedElemRestrictionApply(impl->block_rstr[1], CEED_TRANSPOSE, impl->e_vecs_full[0], out_vec, request));
+    for (CeedInt e_start = 0, e_stop; e_start < num_blocks * block_size; e_start = e_stop) {
+      CeedOperatorGetNextRange_Blocked(num_elem, block_size, impl, &e_start, &e_stop);
+      if (e_start == e_stop) break;
+      for (CeedInt v = 0; v < num_vecs; v++) {
+        CeedCallBackend(CeedElemRestrictionApplyRange(impl->block_rstr[0], e_start / block_size, e_stop / block_size, CEED_NOTRANSPOSE, in_vecs[v],
+                                                      impl->e_vecs_full[0], request));
+        if (impl->elem_mask) {
+          CeedScalar *e_data;
+
+          CeedCallBackend(CeedVectorGetArray(impl->e_vecs_full[0], CEED_MEM_HOST, &e_data));
+          CeedCallBackend(CeedOperatorZeroMaskedElements_Blocked(e_start, e_stop, num_elem, block_size, impl->block_rstr[1], e_data, impl));
+          CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_full[0], &e_data));
+        }
+        CeedCallBackend(CeedElemRestrictionApplyRangeScaled(impl->block_rstr[1], e_start / block_size, e_stop / block_size, alpha,
+                                                            impl->e_vecs_full[0], out_vecs[v], request));
+      }
+    }
     return CEED_ERROR_SUCCESS;
   }
-  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
   CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
   CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
   CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
   CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
-  const CeedInt num_blocks = (num_elem / block_size) + !!(num_elem % block_size);
 
-  // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Blocked(num_input_fields, qf_input_fields, op_input_fields, in_vec, false, e_data_full, impl, request));
+  // Passive input Evecs and Restriction
+  CeedCallBackend(CeedOperatorSetupInputs_Blocked(num_input_fields, qf_input_fields, op_input_fields, in_vecs[0], true, e_data_full, impl, request));
+
+  // Loop through chunks of element blocks with elements selected by the element mask
+  for (CeedInt e_start = 0, e_stop; e_start < num_blocks * block_size; e_start = e_stop) {
+    CeedOperatorGetNextRange_Blocked(num_elem, block_size, impl, &e_start, &e_stop);
+    if (e_start == e_stop) break;
+
+    for (CeedInt v = 0; v < num_vecs; v++) {
+      // Active input Evecs and Restriction
+      for (CeedInt i = 0; i < num_input_fields; i++) {
+        CeedVector vec;
+
+        CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+        CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+        if (vec == CEED_VECTOR_ACTIVE && eval_mode != CEED_EVAL_WEIGHT) {
+          if (!impl->skip_rstr_in[i]) {
+            CeedCallBackend(CeedElemRestrictionApplyRange(impl->block_rstr[i], e_start / block_size, e_stop / block_size, CEED_NOTRANSPOSE,
+                                                          in_vecs[v], impl->e_vecs_full[i], request));
+          }
+          CeedCallBackend(CeedVectorGetArrayRead(impl->e_vecs_full[i], CEED_MEM_HOST, (const CeedScalar **)&e_data_full[i]));
+        }
+        CeedCallBackend(CeedVectorDestroy(&vec));
+      }
 
-  // Output Evecs
-  for (CeedInt i = num_output_fields - 1; i >= 0; i--) {
-    if (impl->skip_rstr_out[i]) {
-      e_data_full[i + num_input_fields] = e_data_full[impl->e_data_out_indices[i] + num_input_fields];
-    } else {
-      CeedCallBackend(CeedVectorGetArrayWrite(impl->e_vecs_full[i + impl->num_inputs], CEED_MEM_HOST, &e_data_full[i + num_input_fields]));
-    }
-  }
+      // Output Evecs
+      for (CeedInt i = num_output_fields - 1; i >= 0; i--) {
+        if (impl->skip_rstr_out[i]) {
+          e_data_full[i + num_input_fields] = e_data_full[impl->e_data_out_indices[i] + num_input_fields];
+        } else {
+          CeedCallBackend(CeedVectorGetArrayWrite(impl->e_vecs_full[i + impl->num_inputs], CEED_MEM_HOST, &e_data_full[i + num_input_fields]));
+        }
+      }
 
-  // Loop through elements
-  for (CeedInt e = 0; e < num_blocks * block_size; e += block_size) {
-    // Output pointers
-    for (CeedInt i = 0; i < num_output_fields; i++) {
-      CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
-      if (eval_mode == CEED_EVAL_NONE) {
-        CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[i], &size));
+      // Loop through elements
+      for (CeedInt e = e_start; e < e_stop; e += block_size) {
+        // Output pointers
+        for (CeedInt i = 0; i < num_output_fields; i++) {
+          CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
+          if (eval_mode == CEED_EVAL_NONE) {
+            CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[i], &size));
+            CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER,
+                                               &e_data_full[i + num_input_fields][(CeedSize)(e - e_start) * Q * size]));
+          }
+        }
+
+        // Input basis apply
         CeedCallBackend(
-            CeedVectorSetArray(impl->q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i + num_input_fields][(CeedSize)e * Q * size]));
-      }
-    }
+            CeedOperatorInputBasis_Blocked(e, e_start, Q, qf_input_fields, op_input_fields, num_input_fields, block_size, false, e_data_full, impl));
 
-    // Input basis apply
-    CeedCallBackend(CeedOperatorInputBasis_Blocked(e, Q, qf_input_fields, op_input_fields, num_input_fields, block_size, false, e_data_full, impl));
+        // Q function
+        if (!impl->is_identity_qf) {
+          CeedCallBackend(CeedQFunctionApply(qf, Q * block_size, impl->q_vecs_in, impl->q_vecs_out));
+        }
 
-    // Q function
-    if (!impl->is_identity_qf) {
-      CeedCallBackend(CeedQFunctionApply(qf, Q * block_size, impl->q_vecs_in, impl->q_vecs_out));
-    }
+        // Output basis apply
+        CeedCallBackend(CeedOperatorOutputBasis_Blocked(e - e_start, Q, qf_output_fields, op_output_fields, block_size, num_input_fields,
+                                                        num_output_fields, impl->apply_add_basis_out, op, e_data_full, impl));
+      }
 
-    // Output basis apply
-    CeedCallBackend(CeedOperatorOutputBasis_Blocked(e, Q, qf_output_fields, op_output_fields, block_size, num_input_fields, num_output_fields,
-                                                    impl->apply_add_basis_out, op, e_data_full, impl));
-  }
+      // Elements of partially selected blocks not selected by the mask do not contribute to the outputs
+      if (impl->elem_mask) {
+        for (CeedInt i = 0; i < num_output_fields; i++) {
+          if (impl->skip_rstr_out[i]) continue;
+          CeedCallBackend(CeedOperatorZeroMaskedElements_Blocked(e_start, e_stop, num_elem, block_size, impl->block_rstr[i + impl->num_inputs],
+                                                                 e_data_full[i + num_input_fields], impl));
+        }
+      }
 
-  // Output restriction
-  for (CeedInt i = 0; i < num_output_fields; i++) {
-    bool       is_active;
-    CeedVector vec;
+      // Output restriction
+      for (CeedInt i = 0; i < num_output_fields; i++) {
+        bool       is_active;
+        CeedVector vec;
+
+        if (impl->skip_rstr_out[i]) continue;
+        // Restore evec
+        CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_full[i + impl->num_inputs], &e_data_full[i + num_input_fields]));
+        // Get output vector
+        CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
+        is_active = vec == CEED_VECTOR_ACTIVE;
+        // Active
+        if (is_active) vec = out_vecs[v];
+        // Restrict, scaling active output
+        CeedCallBackend(CeedElemRestrictionApplyRangeScaled(impl->block_rstr[i + impl->num_inputs], e_start / block_size, e_stop / block_size,
+                                                            is_active ? alpha : 1.0, impl->e_vecs_full[i + impl->num_inputs], vec, request));
+        if (!is_active) CeedCallBackend(CeedVectorDestroy(&vec));
+      }
 
-    if (impl->skip_rstr_out[i]) continue;
-    // Restore evec
-    CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_full[i + impl->num_inputs], &e_data_full[i + num_input_fields]));
-    // Get output vector
-    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
-    is_active = vec == CEED_VECTOR_ACTIVE;
-    // Active
-    if (is_active) vec = out_vec;
-    // Restrict
-    CeedCallBackend(
-        CeedElemRestrictionApply(impl->block_rstr[i + impl->num_inputs], CEED_TRANSPOSE, impl->e_vecs_full[i + impl->num_inputs], vec, request));
-    if (!is_active) CeedCallBackend(CeedVectorDestroy(&vec));
+      // Restore active input arrays
+      for (CeedInt i = 0; i < num_input_fields; i++) {
+        CeedVector vec;
+
+        CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+        CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+        if (vec == CEED_VECTOR_ACTIVE && eval_mode != CEED_EVAL_WEIGHT) {
+          CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_full[i], (const CeedScalar **)&e_data_full[i]));
+        }
+        CeedCallBackend(CeedVectorDestroy(&vec));
+      }
+    }
   }
 
-  // Restore input arrays
-  CeedCallBackend(CeedOperatorRestoreInputs_Blocked(num_input_fields, qf_input_fields, op_input_fields, false, e_data_full, impl));
+  // Restore passive input arrays
+  CeedCallBackend(CeedOperatorRestoreInputs_Blocked(num_input_fields, qf_input_fields, op_input_fields, true, e_data_full, impl));
   CeedCallBackend(CeedQFunctionDestroy(&qf));
   return CEED_ERROR_SUCCESS;
 }
 
+static int CeedOperatorApplyAddScaled_Blocked(CeedOperator op, CeedScalar alpha, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  return CeedOperatorApplyAddScaledMulti_Blocked(op, alpha, 1, &in_vec, &out_vec, request);
+}
+
+static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  return CeedOperatorApplyAddScaledMulti_Blocked(op, 1.0, 1, &in_vec, &out_vec, request);
+}
+
+static int CeedOperatorApplyAddMulti_Blocked(CeedOperator op, CeedInt num_vecs, CeedVector *in_vecs, CeedVector *out_vecs, CeedRequest *request) {
+  return CeedOperatorApplyAddScaledMulti_Blocked(op, 1.0, num_vecs, in_vecs, out_vecs, request);
+}
+
 //------------------------------------------------------------------------------
 // Core code for assembling linear QFunction
 //------------------------------------------------------------------------------
@@ -567,7 +700,6 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Blocked(CeedOperator o
       CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
       if (vec == CEED_VECTOR_ACTIVE) {
         CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &field_size));
-        CeedCallBackend(CeedVectorSetValue(impl->q_vecs_in[i], 0.0));
         qf_size_in += field_size;
       }
       CeedCallBackend(CeedVectorDestroy(&vec));
@@ -576,6 +708,15 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Blocked(CeedOperator o
     impl->qf_size_in = qf_size_in;
   }
 
+  // Clear active input Q-vectors, which may hold data from an application of the operator since the last assembly
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedVector vec;
+
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    if (vec == CEED_VECTOR_ACTIVE) CeedCallBackend(CeedVectorSetValue(impl->q_vecs_in[i], 0.0));
+    CeedCallBackend(CeedVectorDestroy(&vec));
+  }
+
   // Count number of active output fields
   if (qf_size_out == 0) {
     for (CeedInt i = 0; i < num_output_fields; i++) {
@@ -627,7 +768,7 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Blocked(CeedOperator o
   // Loop through elements
   for (CeedInt e = 0; e < num_blocks * block_size; e += block_size) {
     // Input basis apply
-    CeedCallBackend(CeedOperatorInputBasis_Blocked(e, Q, qf_input_fields, op_input_fields, num_input_fields, block_size, true, e_data_full, impl));
+    CeedCallBackend(CeedOperatorInputBasis_Blocked(e, 0, Q, qf_input_fields, op_input_fields, num_input_fields, block_size, true, e_data_full, impl));
 
     // Assemble QFunction
     for (CeedInt i = 0; i < num_input_fields; i++) {
@@ -732,6 +873,22 @@ static int CeedOperatorLinearAssembleQFunctionUpdate_Blocked(CeedOperator op, Ce
   return CeedOperatorLinearAssembleQFunctionCore_Blocked(op, false, &assembled, &rstr, request);
 }
 
+//------------------------------------------------------------------------------
+// Set Element Mask
+//------------------------------------------------------------------------------
+static int CeedOperatorSetElementMask_Blocked(CeedOperator op, const bool *mask) {
+  CeedInt               num_elem;
+  CeedOperator_Blocked *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedFree(&impl->elem_mask));
+  if (!mask) return CEED_ERROR_SUCCESS;
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedCalloc(num_elem, &impl->elem_mask));
+  memcpy(impl->elem_mask, mask, num_elem * sizeof(bool));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Operator Destroy
 //------------------------------------------------------------------------------
@@ -769,6 +926,7 @@ static int CeedOperatorDestroy_Blocked(CeedOperator op) {
   // QFunction assembly data
   CeedCallBackend(CeedVectorDestroy(&impl->qf_l_vec));
   CeedCallBackend(CeedElemRestrictionDestroy(&impl->qf_block_rstr));
+  CeedCallBackend(CeedFree(&impl->elem_mask));
 
   CeedCallBackend(CeedFree(&impl));
   return CEED_ERROR_SUCCESS;
@@ -786,7 +944,16 @@ int CeedOperatorCreate_Blocked(CeedOperator op) {
   CeedCallBackend(CeedOperatorSetData(op, impl));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction", CeedOperatorLinearAssembleQFunction_Blocked));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunctionUpdate", CeedOperatorLinearAssembleQFunctionUpdate_Blocked));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleAddDiagonal", CeedOperatorLinearAssembleAddDiagonal_Ref));
+  CeedCallBackend(
+      CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleAddPointBlockDiagonal", CeedOperatorLinearAssembleAddPointBlockDiagonal_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleSingle", CeedSingleOperatorAssemble_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleSingleRange", CeedSingleOperatorAssembleRange_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleSingleAddSparse", CeedSingleOperatorAssembleAddSparse_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd", CeedOperatorApplyAdd_Blocked));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddScaled", CeedOperatorApplyAddScaled_Blocked));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddMulti", CeedOperatorApplyAddMulti_Blocked));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "SetElementMask", CeedOperatorSetElementMask_Blocked));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroy_Blocked));
   CeedCallBackend(CeedDestroy(&ceed));
   return CEED_ERROR_SUCCESS;
@@ -15,6 +15,9 @@ typedef struct {
   CeedScalar *colo_grad_1d;
 } CeedBasis_Blocked;
 
+// Target size in bytes of the chunked E-vector working set for automatic chunk sizing
+#define CEED_BLOCKED_CHUNK_BYTES (256 * 1024)
+
 typedef struct {
   bool                 is_identity_qf, is_identity_rstr_op;
   bool                *skip_rstr_in, *skip_rstr_out, *apply_add_basis_out;
@@ -26,10 +29,13 @@ typedef struct {
   CeedVector          *q_vecs_in;    /* Element block input Q-vectors  */
   CeedVector          *q_vecs_out;   /* Element block output Q-vectors */
   CeedElemRestriction *block_rstr;   /* Blocked versions of restrictions */
+  bool                 is_elem_shared_in[CEED_FIELD_MAX]; /* Passive inputs shared by all elements, with E-vectors holding one element block */
   CeedInt              num_inputs, num_outputs;
+  CeedInt              chunk_size; /* Number of elements per chunk of active input and output E-vectors, multiple of block size */
   CeedInt              qf_size_in, qf_size_out;
   CeedVector           qf_l_vec;
   CeedElemRestriction  qf_block_rstr;
+  bool                *elem_mask; /* Elements to apply the operator on, NULL for all elements */
 } CeedOperator_Blocked;
 
 CEED_INTERN int CeedOperatorCreate_Blocked(CeedOperator op);
@@ -11,6 +11,7 @@
 // This will be expanded inside CeedRegisterAll() to call each registration function in the order listed, and also to define weak symbol aliases for
 // backends that are not configured.
 
+CEED_BACKEND(CeedRegister_Auto, 1, "/cpu/self/auto")
 CEED_BACKEND(CeedRegister_Avx_Blocked, 1, "/cpu/self/avx/blocked")
 CEED_BACKEND(CeedRegister_Avx_Serial, 1, "/cpu/self/avx/serial")
 CEED_BACKEND(CeedRegister_Cuda, 1, "/gpu/cuda/ref")
@@ -27,6 +28,7 @@ CEED_BACKEND(CeedRegister_Magma_Det, 2, "/gpu/cuda/magma/det", "/gpu/hip/magma/d
 CEED_BACKEND(CeedRegister_Memcheck_Blocked, 1, "/cpu/self/memcheck/blocked")
 CEED_BACKEND(CeedRegister_Memcheck_Serial, 1, "/cpu/self/memcheck/serial")
 CEED_BACKEND(CeedRegister_Occa, 6, "/cpu/self/occa", "/cpu/openmp/occa", "/gpu/dpcpp/occa", "/gpu/opencl/occa", "/gpu/hip/occa", "/gpu/cuda/occa")
+CEED_BACKEND(CeedRegister_Opt_Auto, 1, "/cpu/self/opt/auto")
 CEED_BACKEND(CeedRegister_Opt_Blocked, 1, "/cpu/self/opt/blocked")
 CEED_BACKEND(CeedRegister_Opt_Serial, 1, "/cpu/self/opt/serial")
 CEED_BACKEND(CeedRegister_Ref, 1, "/cpu/self/ref/serial")
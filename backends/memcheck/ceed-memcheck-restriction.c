@@ -578,6 +578,22 @@ static int CeedElemRestrictionApplyBlock_Memcheck(CeedElemRestriction rstr, Ceed
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// ElemRestriction Apply Range
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionApplyRange_Memcheck(CeedElemRestriction rstr, CeedInt start_block, CeedInt stop_block, CeedTransposeMode t_mode,
+                                                  bool use_signs, bool use_orients, CeedVector u, CeedVector v, CeedRequest *request) {
+  CeedInt                       block_size, num_comp, comp_stride;
+  CeedElemRestriction_Memcheck *impl;
+
+  CeedCallBackend(CeedElemRestrictionGetBlockSize(rstr, &block_size));
+  CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
+  CeedCallBackend(CeedElemRestrictionGetCompStride(rstr, &comp_stride));
+  CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
+  CeedCallBackend(impl->Apply(rstr, num_comp, block_size, comp_stride, start_block, stop_block, t_mode, use_signs, use_orients, u, v, request));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // ElemRestriction Get Offsets
 //------------------------------------------------------------------------------
@@ -764,6 +780,9 @@ int CeedElemRestrictionCreate_Memcheck(CeedMemType mem_type, CeedCopyMode copy_m
         CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "ApplyAtPointsInElement", CeedElemRestrictionApplyAtPointsInElement_Memcheck));
   }
   CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "ApplyBlock", CeedElemRestrictionApplyBlock_Memcheck));
+  if (rstr_type != CEED_RESTRICTION_POINTS) {
+    CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "ApplyRange", CeedElemRestrictionApplyRange_Memcheck));
+  }
   CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "GetOffsets", CeedElemRestrictionGetOffsets_Memcheck));
   CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "GetOrientations", CeedElemRestrictionGetOrientations_Memcheck));
   CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "GetCurlOrientations", CeedElemRestrictionGetCurlOrientations_Memcheck));
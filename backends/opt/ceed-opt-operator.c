@@ -5,12 +5,15 @@
 //
 // This file is part of CEED:  http://github.com/ceed
 
+#define _POSIX_C_SOURCE 200112
 #include <ceed.h>
 #include <ceed/backend.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
+#include <time.h>
 
+#include "../ref/ceed-ref.h"
 #include "ceed-opt.h"
 
 //------------------------------------------------------------------------------
@@ -48,67 +51,29 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool i
 
     CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_fields[i], &eval_mode));
     if (eval_mode != CEED_EVAL_WEIGHT) {
-      Ceed                ceed_rstr;
-      CeedSize            l_size;
-      CeedInt             num_elem, elem_size, comp_stride;
-      CeedRestrictionType rstr_type;
+      bool                is_elem_shared = false;
       CeedElemRestriction rstr;
 
       CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_fields[i], &rstr));
-      CeedCallBackend(CeedElemRestrictionGetCeed(rstr, &ceed_rstr));
-      CeedCallBackend(CeedElemRestrictionGetNumElements(rstr, &num_elem));
-      CeedCallBackend(CeedElemRestrictionGetElementSize(rstr, &elem_size));
-      CeedCallBackend(CeedElemRestrictionGetLVectorSize(rstr, &l_size));
-      CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
-      CeedCallBackend(CeedElemRestrictionGetCompStride(rstr, &comp_stride));
-
-      CeedCallBackend(CeedElemRestrictionGetType(rstr, &rstr_type));
-      switch (rstr_type) {
-        case CEED_RESTRICTION_STANDARD: {
-          const CeedInt *offsets = NULL;
-
-          CeedCallBackend(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
-          CeedCallBackend(CeedElemRestrictionCreateBlocked(ceed_rstr, num_elem, elem_size, block_size, num_comp, comp_stride, l_size, CEED_MEM_HOST,
-                                                           CEED_COPY_VALUES, offsets, &block_rstr[i + start_e]));
-          CeedCallBackend(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
-        } break;
-        case CEED_RESTRICTION_ORIENTED: {
-          const bool    *orients = NULL;
-          const CeedInt *offsets = NULL;
-
-          CeedCallBackend(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
-          CeedCallBackend(CeedElemRestrictionGetOrientations(rstr, CEED_MEM_HOST, &orients));
-          CeedCallBackend(CeedElemRestrictionCreateBlockedOriented(ceed_rstr, num_elem, elem_size, block_size, num_comp, comp_stride, l_size,
-                                                                   CEED_MEM_HOST, CEED_COPY_VALUES, offsets, orients, &block_rstr[i + start_e]));
-          CeedCallBackend(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
-          CeedCallBackend(CeedElemRestrictionRestoreOrientations(rstr, &orients));
-        } break;
-        case CEED_RESTRICTION_CURL_ORIENTED: {
-          const CeedInt8 *curl_orients = NULL;
-          const CeedInt  *offsets      = NULL;
-
-          CeedCallBackend(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
-          CeedCallBackend(CeedElemRestrictionGetCurlOrientations(rstr, CEED_MEM_HOST, &curl_orients));
-          CeedCallBackend(CeedElemRestrictionCreateBlockedCurlOriented(ceed_rstr, num_elem, elem_size, block_size, num_comp, comp_stride, l_size,
-                                                                       CEED_MEM_HOST, CEED_COPY_VALUES, offsets, curl_orients,
-                                                                       &block_rstr[i + start_e]));
-          CeedCallBackend(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
-          CeedCallBackend(CeedElemRestrictionRestoreCurlOrientations(rstr, &curl_orients));
-        } break;
-        case CEED_RESTRICTION_STRIDED: {
-          CeedInt strides[3];
-
-          CeedCallBackend(CeedElemRestrictionGetStrides(rstr, strides));
-          CeedCallBackend(CeedElemRestrictionCreateBlockedStrided(ceed_rstr, num_elem, elem_size, block_size, num_comp, l_size, strides,
-                                                                  &block_rstr[i + start_e]));
-        } break;
-        case CEED_RESTRICTION_POINTS:
-          // Empty case - won't occur
-          break;
+      CeedCallBackend(CeedElemRestrictionGetBlocked(rstr, block_size, &block_rstr[i + start_e]));
+      // Passive inputs shared by all elements only hold one element block
+      if (is_input) {
+        CeedVector vec;
+
+        CeedCallBackend(CeedOperatorFieldGetVector(op_fields[i], &vec));
+        if (vec != CEED_VECTOR_ACTIVE) CeedCallBackend(CeedElemRestrictionIsElementShared(rstr, &is_elem_shared));
+        CeedCallBackend(CeedVectorDestroy(&vec));
+      }
+      if (is_elem_shared) {
+        CeedInt elem_size;
+
+        CeedCallBackend(CeedElemRestrictionGetElementSize(rstr, &elem_size));
+        CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
+        CeedCallBackend(CeedVectorCreate(ceed, (CeedSize)block_size * elem_size * num_comp, &e_vecs_full[i + start_e]));
+      } else {
+        CeedCallBackend(CeedElemRestrictionCreateVector(block_rstr[i + start_e], NULL, &e_vecs_full[i + start_e]));
       }
-      CeedCallBackend(CeedDestroy(&ceed_rstr));
       CeedCallBackend(CeedElemRestrictionDestroy(&rstr));
-      CeedCallBackend(CeedElemRestrictionCreateVector(block_rstr[i + start_e], NULL, &e_vecs_full[i + start_e]));
     }
 
     switch (eval_mode) {
@@ -200,35 +165,28 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool i
 }
 
 //------------------------------------------------------------------------------
-// Setup Operator
+// Setup Operator Data for an Element Block Size
 //------------------------------------------------------------------------------
-static int CeedOperatorSetup_Opt(CeedOperator op) {
-  bool                is_setup_done;
+static int CeedOperatorSetupBlocks_Opt(CeedOperator op, CeedInt block_size) {
   Ceed                ceed;
-  Ceed_Opt           *ceed_impl;
-  CeedInt             Q, num_input_fields, num_output_fields;
+  CeedInt             Q, num_input_fields, num_output_fields, chunk_size;
   CeedQFunctionField *qf_input_fields, *qf_output_fields;
   CeedQFunction       qf;
   CeedOperatorField  *op_input_fields, *op_output_fields;
   CeedOperator_Opt   *impl;
 
-  CeedCallBackend(CeedOperatorIsSetupDone(op, &is_setup_done));
-  if (is_setup_done) return CEED_ERROR_SUCCESS;
-
-  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
-  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
-  CeedCallBackend(CeedDestroy(&ceed));
   CeedCallBackend(CeedOperatorGetData(op, &impl));
   CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
   CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
   CeedCallBackend(CeedQFunctionIsIdentity(qf, &impl->is_identity_qf));
   CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
   CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
-  const CeedInt block_size = ceed_impl->block_size;
+  impl->block_size = block_size;
 
   // Allocate
   CeedCallBackend(CeedCalloc(num_input_fields + num_output_fields, &impl->block_rstr));
   CeedCallBackend(CeedCalloc(num_input_fields + num_output_fields, &impl->e_vecs_full));
+  CeedCallBackend(CeedCalloc(num_input_fields, &impl->q_vecs_full_in));
 
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->skip_rstr_in));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->skip_rstr_out));
@@ -250,6 +208,85 @@ static int CeedOperatorSetup_Opt(CeedOperator op) {
   CeedCallBackend(CeedOperatorSetupFields_Opt(qf, op, false, impl->skip_rstr_out, impl->apply_add_basis_out, block_size, impl->block_rstr,
                                               impl->e_vecs_full, impl->e_vecs_out, impl->q_vecs_out, num_input_fields, num_output_fields, Q));
 
+  // Field data and backend restriction, basis, and QFunction actions, resolved once for the element block loop
+  // The element block loop calls the backend actions directly, as setup sizes the block E-vectors and Q-vectors to match
+  CeedCallBackend(CeedOperatorGetNumElements(op, &impl->num_elem));
+  CeedCallBackend(CeedCalloc(num_input_fields, &impl->field_cache_in));
+  CeedCallBackend(CeedCalloc(num_output_fields, &impl->field_cache_out));
+  for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+    const bool                  is_input = i < num_input_fields;
+    CeedOperatorFieldCache_Opt *cache    = is_input ? &impl->field_cache_in[i] : &impl->field_cache_out[i - num_input_fields];
+    CeedOperatorField           op_field = is_input ? op_input_fields[i] : op_output_fields[i - num_input_fields];
+    CeedQFunctionField          qf_field = is_input ? qf_input_fields[i] : qf_output_fields[i - num_input_fields];
+    CeedBasis                   basis;
+    CeedVector                  vec;
+
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_field, &cache->eval_mode));
+    CeedCallBackend(CeedQFunctionFieldGetSize(qf_field, &cache->size));
+    cache->q_stride = (CeedSize)Q * cache->size;
+    if (cache->eval_mode != CEED_EVAL_WEIGHT) {
+      CeedInt             elem_size, num_comp;
+      CeedElemRestriction rstr;
+
+      CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_field, &rstr));
+      CeedCallBackend(CeedElemRestrictionGetElementSize(rstr, &elem_size));
+      CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
+      if (is_input) CeedCallBackend(CeedElemRestrictionIsElementShared(rstr, &cache->is_elem_shared));
+      CeedCallBackend(CeedElemRestrictionDestroy(&rstr));
+      cache->e_stride = (CeedSize)elem_size * num_comp;
+    }
+    // The operator holds references to its field bases and vectors while it exists
+    CeedCallBackend(CeedOperatorFieldGetBasis(op_field, &basis));
+    CeedCallBackend(CeedOperatorFieldGetVector(op_field, &vec));
+    cache->basis     = basis;
+    cache->vec       = vec;
+    cache->is_active = vec == CEED_VECTOR_ACTIVE;
+    CeedCallBackend(CeedBasisDestroy(&basis));
+    CeedCallBackend(CeedVectorDestroy(&vec));
+    // Every element block of a passive input shared by all elements reads the single stored element block
+    cache->is_elem_shared = cache->is_elem_shared && !cache->is_active;
+    if (cache->is_elem_shared) {
+      cache->e_stride = 0;
+      cache->q_stride = 0;
+    }
+    if (impl->block_rstr[i]) CeedCallBackend(CeedElemRestrictionGetApplyBlockFunction(impl->block_rstr[i], &cache->apply_block));
+    if (cache->eval_mode != CEED_EVAL_NONE && cache->eval_mode != CEED_EVAL_WEIGHT) {
+      CeedCallBackend(CeedBasisGetApplyFunctions(cache->basis, &cache->basis_apply, &cache->basis_apply_add));
+      CeedCheck(is_input || !impl->apply_add_basis_out[i - num_input_fields] || cache->basis_apply_add, CeedOperatorReturnCeed(op),
+                CEED_ERROR_UNSUPPORTED, "Backend does not implement CeedBasisApplyAdd");
+    }
+  }
+  {
+    CeedInt vec_length;
+
+    CeedCallBackend(CeedQFunctionGetVectorLength(qf, &vec_length));
+    CeedCheck((Q * block_size) % vec_length == 0, CeedOperatorReturnCeed(op), CEED_ERROR_DIMENSION,
+              "Number of quadrature points per element block %" CeedInt_FMT " must be a multiple of %" CeedInt_FMT, Q * block_size, vec_length);
+    CeedCallBackend(CeedQFunctionGetApplyFunction(qf, &impl->qf_apply));
+  }
+
+  // Full Q-vectors for passive inputs with basis action, unless a chunk size asks to bound the working set
+  CeedCallBackend(CeedOperatorGetChunkSize(op, &chunk_size));
+  for (CeedInt i = 0; i < num_input_fields && chunk_size == 0; i++) {
+    bool         is_passive;
+    CeedEvalMode eval_mode;
+    CeedVector   vec;
+
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    is_passive = vec != CEED_VECTOR_ACTIVE && !impl->field_cache_in[i].is_elem_shared;
+    CeedCallBackend(CeedVectorDestroy(&vec));
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    if (is_passive && eval_mode != CEED_EVAL_NONE && eval_mode != CEED_EVAL_WEIGHT) {
+      CeedInt num_blocks, size;
+
+      CeedCallBackend(CeedElemRestrictionGetNumBlocks(impl->block_rstr[i], &num_blocks));
+      CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
+      CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+      CeedCallBackend(CeedVectorCreate(ceed, (CeedSize)num_blocks * block_size * Q * size, &impl->q_vecs_full_in[i]));
+      CeedCallBackend(CeedDestroy(&ceed));
+    }
+  }
+
   // Identity QFunctions
   if (impl->is_identity_qf) {
     CeedEvalMode        in_mode, out_mode;
@@ -265,47 +302,127 @@ static int CeedOperatorSetup_Opt(CeedOperator op) {
       CeedCallBackend(CeedVectorReferenceCopy(impl->q_vecs_in[0], &impl->q_vecs_out[0]));
     }
   }
+  CeedCallBackend(CeedQFunctionDestroy(&qf));
+  return CEED_ERROR_SUCCESS;
+}
 
+//------------------------------------------------------------------------------
+// Destroy Setup Data
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupDestroy_Opt(CeedOperator_Opt *impl) {
+  for (CeedInt i = 0; i < impl->num_inputs + impl->num_outputs; i++) {
+    CeedCallBackend(CeedElemRestrictionDestroy(&impl->block_rstr[i]));
+    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_full[i]));
+  }
+  CeedCallBackend(CeedFree(&impl->block_rstr));
+  CeedCallBackend(CeedFree(&impl->e_vecs_full));
+  for (CeedInt i = 0; i < impl->num_inputs; i++) {
+    CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_full_in[i]));
+  }
+  CeedCallBackend(CeedFree(&impl->q_vecs_full_in));
+  CeedCallBackend(CeedFree(&impl->input_states));
+  CeedCallBackend(CeedFree(&impl->skip_rstr_in));
+  CeedCallBackend(CeedFree(&impl->skip_rstr_out));
+  CeedCallBackend(CeedFree(&impl->apply_add_basis_out));
+  CeedCallBackend(CeedFree(&impl->field_cache_in));
+  CeedCallBackend(CeedFree(&impl->field_cache_out));
+
+  for (CeedInt i = 0; i < impl->num_inputs; i++) {
+    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_in[i]));
+    CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_in[i]));
+  }
+  CeedCallBackend(CeedFree(&impl->e_vecs_in));
+  CeedCallBackend(CeedFree(&impl->q_vecs_in));
+
+  for (CeedInt i = 0; i < impl->num_outputs; i++) {
+    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_out[i]));
+    CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_out[i]));
+  }
+  CeedCallBackend(CeedFree(&impl->e_vecs_out));
+  CeedCallBackend(CeedFree(&impl->q_vecs_out));
+
+  // QFunction assembly data
+  CeedCallBackend(CeedVectorDestroy(&impl->qf_l_vec));
+  CeedCallBackend(CeedElemRestrictionDestroy(&impl->qf_block_rstr));
+  impl->is_identity_rstr_op = false;
+  impl->num_inputs          = 0;
+  impl->num_outputs         = 0;
+  impl->qf_size_in          = 0;
+  impl->qf_size_out         = 0;
+  impl->block_size          = 0;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup Operator
+//------------------------------------------------------------------------------
+static int CeedOperatorSetup_Opt(CeedOperator op) {
+  bool      is_setup_done;
+  Ceed      ceed;
+  Ceed_Opt *ceed_impl;
+
+  CeedCallBackend(CeedOperatorIsSetupDone(op, &is_setup_done));
+  if (is_setup_done) return CEED_ERROR_SUCCESS;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
+  CeedCallBackend(CeedDestroy(&ceed));
+  // Operators not autotuned before setup, such as when assembled before the first application, use the default block size
+  CeedCallBackend(CeedOperatorSetupBlocks_Opt(op, ceed_impl->block_size ? ceed_impl->block_size : 8));
   CeedCallBackend(CeedOperatorSetSetupDone(op));
-  CeedCallBackend(CeedQFunctionDestroy(&qf));
   return CEED_ERROR_SUCCESS;
 }
 
 //------------------------------------------------------------------------------
 // Setup Input Fields
 //------------------------------------------------------------------------------
-static inline int CeedOperatorSetupInputs_Opt(CeedInt num_input_fields, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-                                              CeedVector in_vec, CeedScalar *e_data[2 * CEED_FIELD_MAX], CeedOperator_Opt *impl,
+static inline int CeedOperatorSetupInputs_Opt(CeedInt num_input_fields, CeedScalar *e_data[2 * CEED_FIELD_MAX], CeedOperator_Opt *impl,
                                               CeedRequest *request) {
   for (CeedInt i = 0; i < num_input_fields; i++) {
-    CeedEvalMode eval_mode;
-
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
-    if (eval_mode == CEED_EVAL_WEIGHT) {  // Skip
-    } else {
-      uint64_t   state;
-      CeedVector vec;
-
-      // Get input vector
-      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-      if (vec != CEED_VECTOR_ACTIVE) {
-        // Restrict
-        CeedCallBackend(CeedVectorGetState(vec, &state));
-        if (state != impl->input_states[i] && impl->block_rstr[i] && !impl->skip_rstr_in[i]) {
-          CeedCallBackend(CeedElemRestrictionApply(impl->block_rstr[i], CEED_NOTRANSPOSE, vec, impl->e_vecs_full[i], request));
+    const CeedOperatorFieldCache_Opt *cache = &impl->field_cache_in[i];
+
+    if (cache->eval_mode == CEED_EVAL_WEIGHT) continue;
+    if (!cache->is_active) {
+      bool     is_updated;
+      uint64_t state;
+
+      // Restrict
+      CeedCallBackend(CeedVectorGetState(cache->vec, &state));
+      is_updated = state != impl->input_states[i];
+      if (is_updated && impl->block_rstr[i] && !impl->skip_rstr_in[i]) {
+        if (cache->is_elem_shared) {
+          CeedCallBackend(CeedElemRestrictionApplyRange(impl->block_rstr[i], 0, 1, CEED_NOTRANSPOSE, cache->vec, impl->e_vecs_full[i], request));
+        } else {
+          CeedCallBackend(CeedElemRestrictionApply(impl->block_rstr[i], CEED_NOTRANSPOSE, cache->vec, impl->e_vecs_full[i], request));
         }
-        impl->input_states[i] = state;
-        // Get evec
-        CeedCallBackend(CeedVectorGetArrayRead(impl->e_vecs_full[i], CEED_MEM_HOST, (const CeedScalar **)&e_data[i]));
-      } else {
-        // Set Qvec for CEED_EVAL_NONE
-        if (eval_mode == CEED_EVAL_NONE) {
-          CeedCallBackend(CeedVectorGetArrayRead(impl->e_vecs_in[i], CEED_MEM_HOST, (const CeedScalar **)&e_data[i]));
-          CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, e_data[i]));
-          CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_in[i], (const CeedScalar **)&e_data[i]));
+      }
+      impl->input_states[i] = state;
+      // Get evec
+      CeedCallBackend(CeedVectorGetArrayRead(impl->e_vecs_full[i], CEED_MEM_HOST, (const CeedScalar **)&e_data[i]));
+      // Passive basis action, skipped if input is unchanged
+      if (is_updated && impl->q_vecs_full_in[i]) {
+        CeedInt     num_blocks, block_size;
+        CeedScalar *q_data_full;
+
+        CeedCallBackend(CeedElemRestrictionGetNumBlocks(impl->block_rstr[i], &num_blocks));
+        CeedCallBackend(CeedElemRestrictionGetBlockSize(impl->block_rstr[i], &block_size));
+        CeedCallBackend(CeedVectorGetArrayWrite(impl->q_vecs_full_in[i], CEED_MEM_HOST, &q_data_full));
+        for (CeedInt e = 0; e < num_blocks * block_size; e += block_size) {
+          CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data[i][(CeedSize)e * cache->e_stride]));
+          CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &q_data_full[(CeedSize)e * cache->q_stride]));
+          CeedCallBackend(CeedBasisApply(cache->basis, block_size, CEED_NOTRANSPOSE, cache->eval_mode, impl->e_vecs_in[i], impl->q_vecs_in[i]));
         }
+        CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_full_in[i], &q_data_full));
       }
-      CeedCallBackend(CeedVectorDestroy(&vec));
+      // Get passive basis action for the element block loop
+      if (impl->q_vecs_full_in[i]) {
+        CeedCallBackend(CeedVectorGetArrayRead(impl->q_vecs_full_in[i], CEED_MEM_HOST, (const CeedScalar **)&impl->q_data_full_in[i]));
+      }
+    } else if (cache->eval_mode == CEED_EVAL_NONE) {
+      // Set Qvec for CEED_EVAL_NONE
+      CeedCallBackend(CeedVectorGetArrayRead(impl->e_vecs_in[i], CEED_MEM_HOST, (const CeedScalar **)&e_data[i]));
+      CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, e_data[i]));
+      CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_in[i], (const CeedScalar **)&e_data[i]));
     }
   }
   return CEED_ERROR_SUCCESS;
@@ -314,51 +431,40 @@ static inline int CeedOperatorSetupInputs_Opt(CeedInt num_input_fields, CeedQFun
 //------------------------------------------------------------------------------
 // Input Basis Action
 //------------------------------------------------------------------------------
-static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-                                             CeedInt num_input_fields, CeedInt block_size, CeedVector in_vec, bool skip_active,
-                                             CeedScalar *e_data[2 * CEED_FIELD_MAX], CeedOperator_Opt *impl, CeedRequest *request) {
+static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt num_input_fields, CeedInt block_size, CeedVector in_vec, bool skip_active,
+                                             bool skip_passive, CeedScalar *e_data[2 * CEED_FIELD_MAX], CeedOperator_Opt *impl,
+                                             CeedRequest *request) {
   for (CeedInt i = 0; i < num_input_fields; i++) {
-    bool                is_active;
-    CeedInt             elem_size, size, num_comp;
-    CeedEvalMode        eval_mode;
-    CeedVector          vec;
-    CeedElemRestriction elem_rstr;
-    CeedBasis           basis;
-
-    // Skip active input
-    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-    is_active = vec == CEED_VECTOR_ACTIVE;
-    CeedCallBackend(CeedVectorDestroy(&vec));
-    if (skip_active && is_active) continue;
+    const CeedOperatorFieldCache_Opt *cache = &impl->field_cache_in[i];
+
+    // Skip active or passive input
+    if ((skip_active && cache->is_active) || (skip_passive && !cache->is_active)) continue;
 
-    // Get elem_size, eval_mode, size
-    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_rstr));
-    CeedCallBackend(CeedElemRestrictionGetElementSize(elem_rstr, &elem_size));
-    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
-    CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
     // Restrict block active input
-    if (is_active && impl->block_rstr[i]) {
-      CeedCallBackend(CeedElemRestrictionApplyBlock(impl->block_rstr[i], e / block_size, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_in[i], request));
+    if (cache->is_active && impl->block_rstr[i]) {
+      CeedCallBackend(cache->apply_block(impl->block_rstr[i], e / block_size, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_in[i], request));
     }
     // Basis action
-    switch (eval_mode) {
+    switch (cache->eval_mode) {
       case CEED_EVAL_NONE:
-        if (!is_active) {
-          CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data[i][(CeedSize)e * Q * size]));
+        if (!cache->is_active) {
+          CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data[i][(CeedSize)e * cache->q_stride]));
         }
         break;
       case CEED_EVAL_INTERP:
       case CEED_EVAL_GRAD:
       case CEED_EVAL_DIV:
       case CEED_EVAL_CURL:
-        CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[i], &basis));
-        if (!is_active) {
-          CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-          CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data[i][(CeedSize)e * elem_size * num_comp]));
+        // Passive basis action computed in CeedOperatorSetupInputs_Opt
+        if (!cache->is_active && impl->q_data_full_in[i]) {
+          CeedCallBackend(
+              CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &impl->q_data_full_in[i][(CeedSize)e * cache->q_stride]));
+          break;
         }
-        CeedCallBackend(CeedBasisApply(basis, block_size, CEED_NOTRANSPOSE, eval_mode, impl->e_vecs_in[i], impl->q_vecs_in[i]));
-        CeedCallBackend(CeedBasisDestroy(&basis));
+        if (!cache->is_active) {
+          CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data[i][(CeedSize)e * cache->e_stride]));
+        }
+        CeedCallBackend(cache->basis_apply(cache->basis, block_size, CEED_NOTRANSPOSE, cache->eval_mode, impl->e_vecs_in[i], impl->q_vecs_in[i]));
         break;
       case CEED_EVAL_WEIGHT:
         break;  // No action
@@ -367,35 +473,56 @@ static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunction
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Check if an element block contains elements selected by the element mask
+//------------------------------------------------------------------------------
+static inline bool CeedOperatorIsBlockActive_Opt(CeedInt e, CeedInt block_size, CeedInt num_elem, CeedOperator_Opt *impl) {
+  if (!impl->elem_mask) return true;
+  for (CeedInt j = e; j < CeedIntMin(e + block_size, num_elem); j++) {
+    if (impl->elem_mask[j]) return true;
+  }
+  return false;
+}
+
+//------------------------------------------------------------------------------
+// Zero Element Block E-vector Lanes of Elements Not Selected by the Element Mask
+//------------------------------------------------------------------------------
+static inline int CeedOperatorZeroMaskedLanes_Opt(CeedInt e, CeedInt block_size, CeedInt num_elem, CeedVector e_vec, CeedOperator_Opt *impl) {
+  CeedSize    length;
+  CeedScalar *e_data;
+
+  CeedCallBackend(CeedVectorGetLength(e_vec, &length));
+  CeedCallBackend(CeedVectorGetArray(e_vec, CEED_MEM_HOST, &e_data));
+  for (CeedInt j = 0; j < block_size && e + j < num_elem; j++) {
+    if (impl->elem_mask[e + j]) continue;
+    for (CeedSize k = j; k < length; k += block_size) e_data[k] = 0.0;
+  }
+  CeedCallBackend(CeedVectorRestoreArray(e_vec, &e_data));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Output Basis Action
 //------------------------------------------------------------------------------
-static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunctionField *qf_output_fields, CeedOperatorField *op_output_fields,
-                                              CeedInt block_size, CeedInt num_input_fields, CeedInt num_output_fields, bool *apply_add_basis,
-                                              bool *skip_rstr, CeedOperator op, CeedVector out_vec, CeedOperator_Opt *impl, CeedRequest *request) {
+static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt block_size, CeedInt num_output_fields, CeedOperator op, CeedScalar alpha,
+                                              CeedVector out_vec, CeedOperator_Opt *impl, CeedRequest *request) {
   for (CeedInt i = 0; i < num_output_fields; i++) {
-    bool         is_active;
-    CeedEvalMode eval_mode;
-    CeedVector   vec;
-    CeedBasis    basis;
+    const CeedOperatorFieldCache_Opt *cache = &impl->field_cache_out[i];
 
-    // Get eval_mode
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
     // Basis action
-    switch (eval_mode) {
+    switch (cache->eval_mode) {
       case CEED_EVAL_NONE:
         break;  // No action
       case CEED_EVAL_INTERP:
       case CEED_EVAL_GRAD:
       case CEED_EVAL_DIV:
       case CEED_EVAL_CURL:
-        CeedCallBackend(CeedOperatorFieldGetBasis(op_output_fields[i], &basis));
-        if (apply_add_basis[i]) {
-          CeedCallBackend(CeedBasisApplyAdd(basis, block_size, CEED_TRANSPOSE, eval_mode, impl->q_vecs_out[i], impl->e_vecs_out[i]));
+        if (impl->apply_add_basis_out[i]) {
+          CeedCallBackend(
+              cache->basis_apply_add(cache->basis, block_size, CEED_TRANSPOSE, cache->eval_mode, impl->q_vecs_out[i], impl->e_vecs_out[i]));
         } else {
-          CeedCallBackend(CeedBasisApply(basis, block_size, CEED_TRANSPOSE, eval_mode, impl->q_vecs_out[i], impl->e_vecs_out[i]));
+          CeedCallBackend(cache->basis_apply(cache->basis, block_size, CEED_TRANSPOSE, cache->eval_mode, impl->q_vecs_out[i], impl->e_vecs_out[i]));
         }
-        CeedCallBackend(CeedBasisDestroy(&basis));
         break;
       // LCOV_EXCL_START
       case CEED_EVAL_WEIGHT: {
@@ -404,15 +531,17 @@ static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunctio
       }
     }
     // Restrict output block
-    if (skip_rstr[i]) continue;
-    // Get output vector
-    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
-    is_active = vec == CEED_VECTOR_ACTIVE;
-    if (is_active) vec = out_vec;
-    // Restrict
-    CeedCallBackend(
-        CeedElemRestrictionApplyBlock(impl->block_rstr[i + impl->num_inputs], e / block_size, CEED_TRANSPOSE, impl->e_vecs_out[i], vec, request));
-    if (!is_active) CeedCallBackend(CeedVectorDestroy(&vec));
+    if (impl->skip_rstr_out[i]) continue;
+    // Elements not selected by the mask do not contribute to the outputs
+    if (impl->elem_mask) CeedCallBackend(CeedOperatorZeroMaskedLanes_Opt(e, block_size, impl->num_elem, impl->e_vecs_out[i], impl));
+    // Restrict, scaling active output
+    if (cache->is_active && alpha != 1.0) {
+      CeedCallBackend(CeedElemRestrictionApplyRangeScaled(impl->block_rstr[i + impl->num_inputs], e / block_size, e / block_size + 1, alpha,
+                                                          impl->e_vecs_out[i], out_vec, request));
+    } else {
+      CeedCallBackend(cache->apply_block(impl->block_rstr[i + impl->num_inputs], e / block_size, CEED_TRANSPOSE, impl->e_vecs_out[i],
+                                         cache->is_active ? out_vec : cache->vec, request));
+    }
   }
   return CEED_ERROR_SUCCESS;
 }
@@ -420,94 +549,270 @@ static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunctio
 //------------------------------------------------------------------------------
 // Restore Input Vectors
 //------------------------------------------------------------------------------
-static inline int CeedOperatorRestoreInputs_Opt(CeedInt num_input_fields, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-                                                CeedScalar *e_data[2 * CEED_FIELD_MAX], CeedOperator_Opt *impl) {
+static inline int CeedOperatorRestoreInputs_Opt(CeedInt num_input_fields, CeedScalar *e_data[2 * CEED_FIELD_MAX], CeedOperator_Opt *impl) {
   for (CeedInt i = 0; i < num_input_fields; i++) {
-    CeedEvalMode eval_mode;
-    CeedVector   vec;
+    const CeedOperatorFieldCache_Opt *cache = &impl->field_cache_in[i];
 
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
-    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-    if (eval_mode != CEED_EVAL_WEIGHT && vec != CEED_VECTOR_ACTIVE) {
-      CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_full[i], (const CeedScalar **)&e_data[i]));
+    if (cache->eval_mode == CEED_EVAL_WEIGHT || cache->is_active) continue;
+    CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_full[i], (const CeedScalar **)&e_data[i]));
+    if (impl->q_data_full_in[i]) {
+      CeedCallBackend(CeedVectorRestoreArrayRead(impl->q_vecs_full_in[i], (const CeedScalar **)&impl->q_data_full_in[i]));
     }
-    CeedCallBackend(CeedVectorDestroy(&vec));
   }
   return CEED_ERROR_SUCCESS;
 }
 
 //------------------------------------------------------------------------------
-// Operator Apply
+// Setup Output Q-vectors
 //------------------------------------------------------------------------------
-static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
-  Ceed                ceed;
-  Ceed_Opt           *ceed_impl;
-  CeedInt             Q, num_input_fields, num_output_fields, num_elem;
-  CeedEvalMode        eval_mode;
-  CeedScalar         *e_data[2 * CEED_FIELD_MAX] = {0};
-  CeedQFunctionField *qf_input_fields, *qf_output_fields;
-  CeedQFunction       qf;
-  CeedOperatorField  *op_input_fields, *op_output_fields;
-  CeedOperator_Opt   *impl;
+static inline int CeedOperatorSetupOutputs_Opt(CeedInt num_input_fields, CeedInt num_output_fields, CeedScalar *e_data[2 * CEED_FIELD_MAX],
+                                               CeedOperator_Opt *impl) {
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    // Set Qvec if needed
+    if (impl->field_cache_out[i].eval_mode == CEED_EVAL_NONE) {
+      // Set qvec to single block evec
+      CeedCallBackend(CeedVectorGetArrayWrite(impl->e_vecs_out[i], CEED_MEM_HOST, &e_data[i + num_input_fields]));
+      CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, e_data[i + num_input_fields]));
+      CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_out[i], &e_data[i + num_input_fields]));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Core code for operator application
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddScaledCore_Opt(CeedOperator op, CeedScalar alpha, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  CeedInt           Q;
+  CeedScalar       *e_data[2 * CEED_FIELD_MAX] = {0};
+  CeedQFunction     qf;
+  CeedOperator_Opt *impl;
 
   // Setup
   CeedCallBackend(CeedOperatorSetup_Opt(op));
 
-  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
-  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
-  CeedCallBackend(CeedDestroy(&ceed));
   CeedCallBackend(CeedOperatorGetData(op, &impl));
-  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
-  const CeedInt block_size = ceed_impl->block_size;
+  const CeedInt block_size = impl->block_size;
+  const CeedInt num_elem   = impl->num_elem;
   const CeedInt num_blocks = (num_elem / block_size) + !!(num_elem % block_size);
 
   // Restriction only operator
   if (impl->is_identity_rstr_op) {
     for (CeedInt b = 0; b < num_blocks; b++) {
-      CeedCallBackend(CeedElemRestrictionApplyBlock(impl->block_rstr[0], b, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_in[0], request));
-      CeedCallBackend(CeedElemRestrictionApplyBlock(impl->block_rstr[1], b, CEED_TRANSPOSE, impl->e_vecs_in[0], out_vec, request));
+      if (!CeedOperatorIsBlockActive_Opt(b * block_size, block_size, num_elem, impl)) continue;
+      CeedCallBackend(impl->field_cache_in[0].apply_block(impl->block_rstr[0], b, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_in[0], request));
+      if (impl->elem_mask) CeedCallBackend(CeedOperatorZeroMaskedLanes_Opt(b * block_size, block_size, num_elem, impl->e_vecs_in[0], impl));
+      if (alpha != 1.0) {
+        CeedCallBackend(CeedElemRestrictionApplyRangeScaled(impl->block_rstr[1], b, b + 1, alpha, impl->e_vecs_in[0], out_vec, request));
+      } else {
+        CeedCallBackend(impl->field_cache_out[0].apply_block(impl->block_rstr[1], b, CEED_TRANSPOSE, impl->e_vecs_in[0], out_vec, request));
+      }
     }
     return CEED_ERROR_SUCCESS;
   }
 
   CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
   CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
-  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
-  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
 
   // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Opt(num_input_fields, qf_input_fields, op_input_fields, in_vec, e_data, impl, request));
+  CeedCallBackend(CeedOperatorSetupInputs_Opt(impl->num_inputs, e_data, impl, request));
 
-  // Output Lvecs, Evecs, and Qvecs
-  for (CeedInt i = 0; i < num_output_fields; i++) {
-    // Set Qvec if needed
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
-    if (eval_mode == CEED_EVAL_NONE) {
-      // Set qvec to single block evec
-      CeedCallBackend(CeedVectorGetArrayWrite(impl->e_vecs_out[i], CEED_MEM_HOST, &e_data[i + num_input_fields]));
-      CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, e_data[i + num_input_fields]));
-      CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_out[i], &e_data[i + num_input_fields]));
-    }
-  }
+  // Output Evecs and Qvecs
+  CeedCallBackend(CeedOperatorSetupOutputs_Opt(impl->num_inputs, impl->num_outputs, e_data, impl));
 
   // Loop through elements
   for (CeedInt e = 0; e < num_blocks * block_size; e += block_size) {
+    // Skip element blocks without selected elements
+    if (!CeedOperatorIsBlockActive_Opt(e, block_size, num_elem, impl)) continue;
+
     // Input basis apply
-    CeedCallBackend(
-        CeedOperatorInputBasis_Opt(e, Q, qf_input_fields, op_input_fields, num_input_fields, block_size, in_vec, false, e_data, impl, request));
+    CeedCallBackend(CeedOperatorInputBasis_Opt(e, impl->num_inputs, block_size, in_vec, false, false, e_data, impl, request));
 
     // Q function
     if (!impl->is_identity_qf) {
-      CeedCallBackend(CeedQFunctionApply(qf, Q * block_size, impl->q_vecs_in, impl->q_vecs_out));
+      CeedCallBackend(impl->qf_apply(qf, Q * block_size, impl->q_vecs_in, impl->q_vecs_out));
     }
 
     // Output basis apply and restriction
-    CeedCallBackend(CeedOperatorOutputBasis_Opt(e, Q, qf_output_fields, op_output_fields, block_size, num_input_fields, num_output_fields,
-                                                impl->apply_add_basis_out, impl->skip_rstr_out, op, out_vec, impl, request));
+    CeedCallBackend(CeedOperatorOutputBasis_Opt(e, block_size, impl->num_outputs, op, alpha, out_vec, impl, request));
+  }
+
+  // Restore input arrays
+  CeedCallBackend(CeedOperatorRestoreInputs_Opt(impl->num_inputs, e_data, impl));
+  CeedCallBackend(CeedQFunctionDestroy(&qf));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Wall-Clock Time in Seconds
+//------------------------------------------------------------------------------
+static double CeedGetWallTime_Opt(void) {
+  struct timespec time;
+
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (double)time.tv_sec + 1e-9 * (double)time.tv_nsec;
+}
+
+//------------------------------------------------------------------------------
+// Autotune Element Block Size
+//------------------------------------------------------------------------------
+static int CeedOperatorAutotuneBlockSize_Opt(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  const CeedInt     candidates[] = {1, 4, 8, 16, 32}, num_candidates = sizeof(candidates) / sizeof(candidates[0]);
+  Ceed              ceed;
+  CeedInt           best_block_size = 8;
+  CeedSize          out_length;
+  double            best_time = -1.0;
+  CeedVector        out_tmp;
+  CeedOperator_Opt *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorSetupBlocks_Opt(op, best_block_size));
+  CeedCallBackend(CeedOperatorSetSetupDone(op));
+
+  // Timed applications write to a scratch output, so passive outputs or a missing active output keep the default block size
+  {
+    bool has_passive_output = out_vec == CEED_VECTOR_NONE;
+
+    for (CeedInt i = 0; i < impl->num_outputs; i++) has_passive_output |= !impl->field_cache_out[i].is_active;
+    if (has_passive_output || impl->is_identity_rstr_op) return CEED_ERROR_SUCCESS;
+  }
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedVectorGetLength(out_vec, &out_length));
+  CeedCallBackend(CeedVectorCreate(ceed, out_length, &out_tmp));
+  CeedCallBackend(CeedVectorSetValue(out_tmp, 0.0));
+  CeedCallBackend(CeedDestroy(&ceed));
+
+  for (CeedInt c = 0; c < num_candidates; c++) {
+    CeedInt num_reps = 0;
+    double  start, elapsed = 0.0;
+
+    // Blocks larger than the mesh only pad with unused lanes
+    if (c > 0 && candidates[c - 1] >= impl->num_elem) break;
+    if (impl->block_size != candidates[c]) {
+      CeedCallBackend(CeedOperatorSetupDestroy_Opt(impl));
+      CeedCallBackend(CeedOperatorSetupBlocks_Opt(op, candidates[c]));
+    }
+    // Warm up, filling passive input caches
+    CeedCallBackend(CeedOperatorApplyAddScaledCore_Opt(op, 1.0, in_vec, out_tmp, request));
+    // Operators slower than the minimum time are timed with a single application; faster ones repeat to resolve the timer
+    start = CeedGetWallTime_Opt();
+    while (num_reps < CEED_OPT_AUTOTUNE_MAX_REPS && (num_reps == 0 || elapsed < CEED_OPT_AUTOTUNE_MIN_TIME)) {
+      CeedCallBackend(CeedOperatorApplyAddScaledCore_Opt(op, 1.0, in_vec, out_tmp, request));
+      elapsed = CeedGetWallTime_Opt() - start;
+      num_reps++;
+    }
+    const double rep_time = elapsed / num_reps;
+
+    if (best_time < 0.0 || rep_time < best_time) {
+      best_time       = rep_time;
+      best_block_size = candidates[c];
+    }
+  }
+  CeedCallBackend(CeedVectorDestroy(&out_tmp));
+
+  // Keep the fastest block size
+  if (impl->block_size != best_block_size) {
+    CeedCallBackend(CeedOperatorSetupDestroy_Opt(impl));
+    CeedCallBackend(CeedOperatorSetupBlocks_Opt(op, best_block_size));
+  }
+  impl->is_autotuned = true;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddScaled_Opt(CeedOperator op, CeedScalar alpha, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  bool      is_setup_done;
+  Ceed      ceed;
+  Ceed_Opt *ceed_impl;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
+  CeedCallBackend(CeedDestroy(&ceed));
+  CeedCallBackend(CeedOperatorIsSetupDone(op, &is_setup_done));
+  if (!ceed_impl->block_size && !is_setup_done) CeedCallBackend(CeedOperatorAutotuneBlockSize_Opt(op, in_vec, out_vec, request));
+  CeedCallBackend(CeedOperatorApplyAddScaledCore_Opt(op, alpha, in_vec, out_vec, request));
+  return CEED_ERROR_SUCCESS;
+}
+
+static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  return CeedOperatorApplyAddScaled_Opt(op, 1.0, in_vec, out_vec, request);
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply to Multiple Vectors
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddMulti_Opt(CeedOperator op, CeedInt num_vecs, CeedVector *in_vecs, CeedVector *out_vecs, CeedRequest *request) {
+  bool              is_setup_done;
+  Ceed              ceed;
+  CeedInt           Q;
+  CeedScalar       *e_data[2 * CEED_FIELD_MAX] = {0};
+  CeedQFunction     qf;
+  Ceed_Opt         *ceed_impl;
+  CeedOperator_Opt *impl;
+
+  // Setup, autotuning the block size on the first vector pair if requested
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
+  CeedCallBackend(CeedDestroy(&ceed));
+  CeedCallBackend(CeedOperatorIsSetupDone(op, &is_setup_done));
+  if (!ceed_impl->block_size && !is_setup_done && num_vecs > 0) {
+    CeedCallBackend(CeedOperatorAutotuneBlockSize_Opt(op, in_vecs[0], out_vecs[0], request));
+  }
+  CeedCallBackend(CeedOperatorSetup_Opt(op));
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  const CeedInt block_size = impl->block_size;
+  const CeedInt num_elem   = impl->num_elem;
+  const CeedInt num_blocks = (num_elem / block_size) + !!(num_elem % block_size);
+
+  // Restriction only operator
+  if (impl->is_identity_rstr_op) {
+    for (CeedInt b = 0; b < num_blocks; b++) {
+      if (!CeedOperatorIsBlockActive_Opt(b * block_size, block_size, num_elem, impl)) continue;
+      for (CeedInt v = 0; v < num_vecs; v++) {
+        CeedCallBackend(impl->field_cache_in[0].apply_block(impl->block_rstr[0], b, CEED_NOTRANSPOSE, in_vecs[v], impl->e_vecs_in[0], request));
+        if (impl->elem_mask) CeedCallBackend(CeedOperatorZeroMaskedLanes_Opt(b * block_size, block_size, num_elem, impl->e_vecs_in[0], impl));
+        CeedCallBackend(impl->field_cache_out[0].apply_block(impl->block_rstr[1], b, CEED_TRANSPOSE, impl->e_vecs_in[0], out_vecs[v], request));
+      }
+    }
+    return CEED_ERROR_SUCCESS;
+  }
+
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+
+  // Input Evecs and Restriction
+  CeedCallBackend(CeedOperatorSetupInputs_Opt(impl->num_inputs, e_data, impl, request));
+
+  // Output Evecs and Qvecs
+  CeedCallBackend(CeedOperatorSetupOutputs_Opt(impl->num_inputs, impl->num_outputs, e_data, impl));
+
+  // Loop through elements
+  for (CeedInt e = 0; e < num_blocks * block_size; e += block_size) {
+    // Skip element blocks without selected elements
+    if (!CeedOperatorIsBlockActive_Opt(e, block_size, num_elem, impl)) continue;
+
+    // Passive input basis apply, shared by all vectors
+    CeedCallBackend(CeedOperatorInputBasis_Opt(e, impl->num_inputs, block_size, NULL, true, false, e_data, impl, request));
+
+    for (CeedInt v = 0; v < num_vecs; v++) {
+      // Active input restriction and basis apply
+      CeedCallBackend(CeedOperatorInputBasis_Opt(e, impl->num_inputs, block_size, in_vecs[v], false, true, e_data, impl, request));
+
+      // Q function
+      if (!impl->is_identity_qf) {
+        CeedCallBackend(impl->qf_apply(qf, Q * block_size, impl->q_vecs_in, impl->q_vecs_out));
+      }
+
+      // Output basis apply and restriction
+      CeedCallBackend(CeedOperatorOutputBasis_Opt(e, block_size, impl->num_outputs, op, 1.0, out_vecs[v], impl, request));
+    }
   }
 
   // Restore input arrays
-  CeedCallBackend(CeedOperatorRestoreInputs_Opt(num_input_fields, qf_input_fields, op_input_fields, e_data, impl));
+  CeedCallBackend(CeedOperatorRestoreInputs_Opt(impl->num_inputs, e_data, impl));
   CeedCallBackend(CeedQFunctionDestroy(&qf));
   return CEED_ERROR_SUCCESS;
 }
@@ -518,7 +823,6 @@ static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVect
 static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, bool build_objects, CeedVector *assembled, CeedElemRestriction *rstr,
                                                               CeedRequest *request) {
   Ceed                ceed;
-  Ceed_Opt           *ceed_impl;
   CeedInt             qf_size_in, qf_size_out, Q, num_input_fields, num_output_fields, num_elem;
   CeedScalar         *l_vec_array, *e_data[2 * CEED_FIELD_MAX] = {0};
   CeedQFunctionField *qf_input_fields, *qf_output_fields;
@@ -526,8 +830,10 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, b
   CeedOperatorField  *op_input_fields, *op_output_fields;
   CeedOperator_Opt   *impl;
 
+  // Setup
+  CeedCallBackend(CeedOperatorSetup_Opt(op));
+
   CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
-  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
   CeedCallBackend(CeedOperatorGetData(op, &impl));
   qf_size_in  = impl->qf_size_in;
   qf_size_out = impl->qf_size_out;
@@ -537,19 +843,16 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, b
   CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
   CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
   CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
-  const CeedInt       block_size = ceed_impl->block_size;
+  const CeedInt       block_size = impl->block_size;
   const CeedInt       num_blocks = (num_elem / block_size) + !!(num_elem % block_size);
   CeedVector          l_vec      = impl->qf_l_vec;
   CeedElemRestriction block_rstr = impl->qf_block_rstr;
 
-  // Setup
-  CeedCallBackend(CeedOperatorSetup_Opt(op));
-
   // Check for restriction only operator
   CeedCheck(!impl->is_identity_rstr_op, ceed, CEED_ERROR_BACKEND, "Assembling restriction only operators is not supported");
 
   // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Opt(num_input_fields, qf_input_fields, op_input_fields, NULL, e_data, impl, request));
+  CeedCallBackend(CeedOperatorSetupInputs_Opt(num_input_fields, e_data, impl, request));
 
   // Count number of active input fields
   if (qf_size_in == 0) {
@@ -561,7 +864,6 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, b
       CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
       if (vec == CEED_VECTOR_ACTIVE) {
         CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &field_size));
-        CeedCallBackend(CeedVectorSetValue(impl->q_vecs_in[i], 0.0));
         qf_size_in += field_size;
       }
       CeedCallBackend(CeedVectorDestroy(&vec));
@@ -570,6 +872,15 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, b
     impl->qf_size_in = qf_size_in;
   }
 
+  // Clear active input Q-vectors, which may hold data from an application of the operator since the last assembly
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedVector vec;
+
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    if (vec == CEED_VECTOR_ACTIVE) CeedCallBackend(CeedVectorSetValue(impl->q_vecs_in[i], 0.0));
+    CeedCallBackend(CeedVectorDestroy(&vec));
+  }
+
   // Count number of active output fields
   if (qf_size_out == 0) {
     for (CeedInt i = 0; i < num_output_fields; i++) {
@@ -624,22 +935,13 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, b
     CeedCallBackend(CeedVectorGetArray(l_vec, CEED_MEM_HOST, &l_vec_array));
 
     // Input basis apply
-    CeedCallBackend(
-        CeedOperatorInputBasis_Opt(e, Q, qf_input_fields, op_input_fields, num_input_fields, block_size, NULL, true, e_data, impl, request));
+    CeedCallBackend(CeedOperatorInputBasis_Opt(e, num_input_fields, block_size, NULL, true, false, e_data, impl, request));
 
     // Assemble QFunction
     for (CeedInt i = 0; i < num_input_fields; i++) {
-      bool       is_active;
-      CeedInt    field_size;
-      CeedVector vec;
-
       // Check if active input
-      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-      is_active = vec == CEED_VECTOR_ACTIVE;
-      CeedCallBackend(CeedVectorDestroy(&vec));
-      if (!is_active) continue;
-      CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &field_size));
-      for (CeedInt field = 0; field < field_size; field++) {
+      if (!impl->field_cache_in[i].is_active) continue;
+      for (CeedInt field = 0; field < impl->field_cache_in[i].size; field++) {
         // Set current portion of input to 1.0
         {
           CeedScalar *array;
@@ -652,21 +954,14 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, b
         if (!impl->is_identity_qf) {
           // Set Outputs
           for (CeedInt out = 0; out < num_output_fields; out++) {
-            CeedVector vec;
-
             // Check if active output
-            CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
-            if (vec == CEED_VECTOR_ACTIVE) {
-              CeedInt field_size;
-
+            if (impl->field_cache_out[out].is_active) {
               CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[out], CEED_MEM_HOST, CEED_USE_POINTER, l_vec_array));
-              CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[out], &field_size));
-              l_vec_array += field_size * Q * block_size;  // Advance the pointer by the size of the output
+              l_vec_array += impl->field_cache_out[out].size * Q * block_size;  // Advance the pointer by the size of the output
             }
-            CeedCallBackend(CeedVectorDestroy(&vec));
           }
           // Apply QFunction
-          CeedCallBackend(CeedQFunctionApply(qf, Q * block_size, impl->q_vecs_in, impl->q_vecs_out));
+          CeedCallBackend(impl->qf_apply(qf, Q * block_size, impl->q_vecs_in, impl->q_vecs_out));
         } else {
           CeedInt           field_size;
           const CeedScalar *array;
@@ -692,14 +987,10 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, b
     // Un-set output Qvecs to prevent accidental overwrite of Assembled
     if (!impl->is_identity_qf) {
       for (CeedInt out = 0; out < num_output_fields; out++) {
-        CeedVector vec;
-
         // Check if active output
-        CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
-        if (vec == CEED_VECTOR_ACTIVE && num_elem > 0) {
+        if (impl->field_cache_out[out].is_active && num_elem > 0) {
           CeedCallBackend(CeedVectorTakeArray(impl->q_vecs_out[out], CEED_MEM_HOST, NULL));
         }
-        CeedCallBackend(CeedVectorDestroy(&vec));
       }
     }
 
@@ -719,7 +1010,7 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, b
   }
 
   // Restore input arrays
-  CeedCallBackend(CeedOperatorRestoreInputs_Opt(num_input_fields, qf_input_fields, op_input_fields, e_data, impl));
+  CeedCallBackend(CeedOperatorRestoreInputs_Opt(num_input_fields, e_data, impl));
   CeedCallBackend(CeedDestroy(&ceed));
   CeedCallBackend(CeedQFunctionDestroy(&qf));
   return CEED_ERROR_SUCCESS;
@@ -740,40 +1031,41 @@ static int CeedOperatorLinearAssembleQFunctionUpdate_Opt(CeedOperator op, CeedVe
 }
 
 //------------------------------------------------------------------------------
-// Operator Destroy
+// Set Element Mask
 //------------------------------------------------------------------------------
-static int CeedOperatorDestroy_Opt(CeedOperator op) {
+static int CeedOperatorSetElementMask_Opt(CeedOperator op, const bool *mask) {
+  CeedInt           num_elem;
   CeedOperator_Opt *impl;
 
   CeedCallBackend(CeedOperatorGetData(op, &impl));
-  for (CeedInt i = 0; i < impl->num_inputs + impl->num_outputs; i++) {
-    CeedCallBackend(CeedElemRestrictionDestroy(&impl->block_rstr[i]));
-    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_full[i]));
-  }
-  CeedCallBackend(CeedFree(&impl->block_rstr));
-  CeedCallBackend(CeedFree(&impl->e_vecs_full));
-  CeedCallBackend(CeedFree(&impl->input_states));
-  CeedCallBackend(CeedFree(&impl->skip_rstr_in));
-  CeedCallBackend(CeedFree(&impl->skip_rstr_out));
-  CeedCallBackend(CeedFree(&impl->apply_add_basis_out));
+  CeedCallBackend(CeedFree(&impl->elem_mask));
+  if (!mask) return CEED_ERROR_SUCCESS;
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedCalloc(num_elem, &impl->elem_mask));
+  memcpy(impl->elem_mask, mask, num_elem * sizeof(bool));
+  return CEED_ERROR_SUCCESS;
+}
 
-  for (CeedInt i = 0; i < impl->num_inputs; i++) {
-    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_in[i]));
-    CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_in[i]));
-  }
-  CeedCallBackend(CeedFree(&impl->e_vecs_in));
-  CeedCallBackend(CeedFree(&impl->q_vecs_in));
+//------------------------------------------------------------------------------
+// Operator View
+//------------------------------------------------------------------------------
+static int CeedOperatorView_Opt(CeedOperator op, bool sub, FILE *stream) {
+  CeedOperator_Opt *impl;
 
-  for (CeedInt i = 0; i < impl->num_outputs; i++) {
-    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_out[i]));
-    CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_out[i]));
-  }
-  CeedCallBackend(CeedFree(&impl->e_vecs_out));
-  CeedCallBackend(CeedFree(&impl->q_vecs_out));
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  if (impl->is_autotuned) fprintf(stream, "%s  Autotuned element block size: %" CeedInt_FMT "\n", sub ? "  " : "", impl->block_size);
+  return CEED_ERROR_SUCCESS;
+}
 
-  // QFunction assembly data
-  CeedCallBackend(CeedVectorDestroy(&impl->qf_l_vec));
-  CeedCallBackend(CeedElemRestrictionDestroy(&impl->qf_block_rstr));
+//------------------------------------------------------------------------------
+// Operator Destroy
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroy_Opt(CeedOperator op) {
+  CeedOperator_Opt *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorSetupDestroy_Opt(impl));
+  CeedCallBackend(CeedFree(&impl->elem_mask));
 
   CeedCallBackend(CeedFree(&impl));
   return CEED_ERROR_SUCCESS;
@@ -794,11 +1086,22 @@ int CeedOperatorCreate_Opt(CeedOperator op) {
   CeedCallBackend(CeedCalloc(1, &impl));
   CeedCallBackend(CeedOperatorSetData(op, impl));
 
-  CeedCheck(block_size == 1 || block_size == 8, ceed, CEED_ERROR_BACKEND, "Opt backend cannot use blocksize: %" CeedInt_FMT, block_size);
+  CeedCheck(block_size == 0 || block_size == 1 || block_size == 8, ceed, CEED_ERROR_BACKEND, "Opt backend cannot use blocksize: %" CeedInt_FMT,
+            block_size);
 
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction", CeedOperatorLinearAssembleQFunction_Opt));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunctionUpdate", CeedOperatorLinearAssembleQFunctionUpdate_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleAddDiagonal", CeedOperatorLinearAssembleAddDiagonal_Ref));
+  CeedCallBackend(
+      CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleAddPointBlockDiagonal", CeedOperatorLinearAssembleAddPointBlockDiagonal_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleSingle", CeedSingleOperatorAssemble_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleSingleRange", CeedSingleOperatorAssembleRange_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleSingleAddSparse", CeedSingleOperatorAssembleAddSparse_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd", CeedOperatorApplyAdd_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddScaled", CeedOperatorApplyAddScaled_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddMulti", CeedOperatorApplyAddMulti_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "SetElementMask", CeedOperatorSetElementMask_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "View", CeedOperatorView_Opt));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroy_Opt));
   CeedCallBackend(CeedDestroy(&ceed));
   return CEED_ERROR_SUCCESS;
@@ -53,6 +53,7 @@ static int CeedTensorContractApply_Opt(CeedTensorContract contract, CeedInt A, C
 //------------------------------------------------------------------------------
 int CeedTensorContractCreate_Opt(CeedTensorContract contract) {
   CeedCallBackend(CeedSetBackendFunction(CeedTensorContractReturnCeed(contract), "TensorContract", contract, "Apply", CeedTensorContractApply_Opt));
+  CeedCallBackend(CeedTensorContractSetUseEvenOdd(contract, true));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -11,8 +11,13 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+// Wall-clock seconds of timed applications per candidate block size before the autotuner stops repeating
+#define CEED_OPT_AUTOTUNE_MIN_TIME 1e-4
+// Cap on timed applications per candidate block size, reached only by operators faster than the minimum time
+#define CEED_OPT_AUTOTUNE_MAX_REPS 16
+
 typedef struct {
-  CeedInt block_size;
+  CeedInt block_size; /* Element block size, 0 to autotune per operator */
 } Ceed_Opt;
 
 typedef struct {
@@ -20,19 +25,40 @@ typedef struct {
 } CeedBasis_Opt;
 
 typedef struct {
-  bool                 is_identity_qf, is_identity_rstr_op;
-  bool                *skip_rstr_in, *skip_rstr_out, *apply_add_basis_out;
-  CeedElemRestriction *block_rstr;   /* Blocked versions of restrictions */
-  CeedVector          *e_vecs_full;  /* Full E-vectors, inputs followed by outputs */
-  uint64_t            *input_states; /* State counter of inputs */
-  CeedVector          *e_vecs_in;    /* Element block input E-vectors  */
-  CeedVector          *e_vecs_out;   /* Element block output E-vectors */
-  CeedVector          *q_vecs_in;    /* Element block input Q-vectors  */
-  CeedVector          *q_vecs_out;   /* Element block output Q-vectors */
-  CeedInt              num_inputs, num_outputs;
-  CeedInt              qf_size_in, qf_size_out;
-  CeedVector           qf_l_vec;
-  CeedElemRestriction  qf_block_rstr;
+  bool                                  is_active;
+  bool                                  is_elem_shared; /* Passive input shared by all elements, with zero strides into one element block */
+  CeedEvalMode                          eval_mode;
+  CeedInt                               size;                         /* QFunction field size */
+  CeedSize                              e_stride;                     /* Entries per element in full E-vector */
+  CeedSize                              q_stride;                     /* Entries per element in full Q-vector */
+  CeedBasis                             basis;                        /* Operator field basis, not referenced */
+  CeedVector                            vec;                          /* Operator field vector, not referenced */
+  CeedElemRestrictionApplyBlockFunction apply_block;                  /* Backend block restriction, NULL without blocked restriction */
+  CeedBasisApplyFunction                basis_apply, basis_apply_add; /* Backend basis actions, NULL without basis action */
+} CeedOperatorFieldCache_Opt;
+
+typedef struct {
+  bool                        is_identity_qf, is_identity_rstr_op;
+  bool                        is_autotuned; /* Block size chosen by timing candidate block sizes */
+  CeedInt                     block_size;   /* Element block size, set at setup */
+  CeedInt                     num_elem;
+  CeedOperatorFieldCache_Opt *field_cache_in, *field_cache_out; /* Field data and backend functions resolved at setup for the element block loop */
+  CeedQFunctionApplyFunction  qf_apply;                         /* Backend QFunction action resolved at setup */
+  bool                       *skip_rstr_in, *skip_rstr_out, *apply_add_basis_out;
+  CeedElemRestriction        *block_rstr;                     /* Blocked versions of restrictions */
+  CeedVector                 *e_vecs_full;                    /* Full E-vectors, inputs followed by outputs */
+  CeedVector                 *q_vecs_full_in;                 /* Full passive input Q-vectors, reused while the input state is unchanged */
+  CeedScalar                 *q_data_full_in[CEED_FIELD_MAX]; /* Arrays of full passive input Q-vectors during application */
+  uint64_t                   *input_states;                   /* State counter of inputs */
+  CeedVector                 *e_vecs_in;                      /* Element block input E-vectors  */
+  CeedVector                 *e_vecs_out;                     /* Element block output E-vectors */
+  CeedVector                 *q_vecs_in;                      /* Element block input Q-vectors  */
+  CeedVector                 *q_vecs_out;                     /* Element block output Q-vectors */
+  CeedInt                     num_inputs, num_outputs;
+  CeedInt                     qf_size_in, qf_size_out;
+  CeedVector                  qf_l_vec;
+  CeedElemRestriction         qf_block_rstr;
+  bool                       *elem_mask; /* Elements to apply the operator on, NULL for all elements */
 } CeedOperator_Opt;
 
 CEED_INTERN int CeedTensorContractCreate_Opt(CeedTensorContract contract);
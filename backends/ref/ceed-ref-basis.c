@@ -13,6 +13,144 @@
 
 #include "ceed-ref.h"
 
+//------------------------------------------------------------------------------
+// Basis Even-Odd Setup
+//------------------------------------------------------------------------------
+// Modal bases, such as the eigenvectors of a symmetric 1D generalized eigenproblem used by the fast diagonalization method, have interp_1d rows
+//   that are each even or odd about the center node.
+// Folding the nodes into sums and differences halves the 1D contractions for these bases.
+// The fold and unfold passes only pay off against the full contractions for 8 or more nodes in 1D.
+static int CeedBasisCreateEvenOdd_Ref(CeedInt P_1d, CeedInt Q_1d, const CeedScalar *interp_1d, CeedBasis_Ref *impl) {
+  const CeedInt num_half_even = (P_1d + 1) / 2, num_half_odd = P_1d / 2;
+  CeedInt       num_even = 0, num_odd = 0;
+  CeedScalar    max_abs = 0.0, tol;
+  bool          is_odd[Q_1d];
+
+  if (P_1d < 8) return CEED_ERROR_SUCCESS;
+  for (CeedInt i = 0; i < P_1d * Q_1d; i++) max_abs = fmax(max_abs, fabs(interp_1d[i]));
+  tol = 1000 * CEED_EPSILON * max_abs;
+
+  // Classify rows by parity
+  for (CeedInt q = 0; q < Q_1d; q++) {
+    CeedScalar even_error = 0.0, odd_error = 0.0;
+
+    for (CeedInt p = 0; p < P_1d; p++) {
+      even_error = fmax(even_error, fabs(interp_1d[q * P_1d + p] - interp_1d[q * P_1d + P_1d - 1 - p]));
+      odd_error  = fmax(odd_error, fabs(interp_1d[q * P_1d + p] + interp_1d[q * P_1d + P_1d - 1 - p]));
+    }
+    if (even_error > tol && odd_error > tol) return CEED_ERROR_SUCCESS;
+    is_odd[q] = even_error > tol;
+    if (is_odd[q]) num_odd++;
+    else num_even++;
+  }
+
+  // Fold rows
+  impl->num_even_1d = num_even;
+  impl->num_odd_1d  = num_odd;
+  CeedCallBackend(CeedCalloc(Q_1d, &impl->even_odd_rows_1d));
+  CeedCallBackend(CeedCalloc(num_even * num_half_even, &impl->interp_even_1d));
+  CeedCallBackend(CeedCalloc(num_odd * num_half_odd, &impl->interp_odd_1d));
+  num_even = 0;
+  num_odd  = 0;
+  for (CeedInt q = 0; q < Q_1d; q++) {
+    const CeedScalar *row = &interp_1d[q * P_1d];
+
+    if (is_odd[q]) {
+      impl->even_odd_rows_1d[impl->num_even_1d + num_odd] = q;
+      for (CeedInt p = 0; p < num_half_odd; p++) impl->interp_odd_1d[num_odd * num_half_odd + p] = (row[p] - row[P_1d - 1 - p]) / 2;
+      num_odd++;
+    } else {
+      impl->even_odd_rows_1d[num_even] = q;
+      for (CeedInt p = 0; p < num_half_even; p++) impl->interp_even_1d[num_even * num_half_even + p] = (row[p] + row[P_1d - 1 - p]) / 2;
+      num_even++;
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Basis Even-Odd Interpolation
+//------------------------------------------------------------------------------
+// Contract one dimension of shape [A, P_1d, C] to [A, Q_1d, C], or [A, Q_1d, C] to [A, P_1d, C] in transpose, with the folded interp_1d rows
+// The work array holds A * (P_1d + Q_1d) * C entries and is owned by the caller, so a shared CeedBasis can be applied concurrently
+static int CeedBasisInterpEvenOdd_Ref(CeedBasis_Ref *impl, CeedTensorContract contract, CeedInt A, CeedInt P_1d, CeedInt C, CeedInt Q_1d,
+                                      CeedTransposeMode t_mode, bool add, const CeedScalar *u, CeedScalar *v, CeedScalar *work) {
+  const CeedInt num_half_even = (P_1d + 1) / 2, num_half_odd = P_1d / 2, num_even = impl->num_even_1d, num_odd = impl->num_odd_1d;
+  // Nodes folded into sums and differences, and modes split by parity
+  CeedScalar *u_even = work, *u_odd = &u_even[A * num_half_even * C], *v_even = &u_odd[A * num_half_odd * C],
+             *v_odd = &v_even[A * num_even * C];
+
+  if (t_mode == CEED_NOTRANSPOSE) {
+    for (CeedInt a = 0; a < A; a++) {
+      for (CeedInt p = 0; p < num_half_even; p++) {
+        const CeedScalar *u_p = &u[(a * P_1d + p) * C], *u_r = &u[(a * P_1d + P_1d - 1 - p) * C];
+        CeedScalar       *u_e = &u_even[(a * num_half_even + p) * C];
+
+        if (p < num_half_odd) {
+          CeedScalar *u_o = &u_odd[(a * num_half_odd + p) * C];
+
+          CeedPragmaSIMD for (CeedInt c = 0; c < C; c++) {
+            u_e[c] = u_p[c] + u_r[c];
+            u_o[c] = u_p[c] - u_r[c];
+          }
+        } else {
+          CeedPragmaSIMD for (CeedInt c = 0; c < C; c++) u_e[c] = u_p[c];
+        }
+      }
+    }
+    if (num_even) {
+      CeedCallBackend(CeedTensorContractApply(contract, A, num_half_even, C, num_even, impl->interp_even_1d, t_mode, false, u_even, v_even));
+    }
+    if (num_odd) CeedCallBackend(CeedTensorContractApply(contract, A, num_half_odd, C, num_odd, impl->interp_odd_1d, t_mode, false, u_odd, v_odd));
+    for (CeedInt a = 0; a < A; a++) {
+      for (CeedInt k = 0; k < num_even + num_odd; k++) {
+        const CeedScalar *v_k = k < num_even ? &v_even[(a * num_even + k) * C] : &v_odd[(a * num_odd + k - num_even) * C];
+        CeedScalar       *v_q = &v[(a * Q_1d + impl->even_odd_rows_1d[k]) * C];
+
+        if (add) {
+          CeedPragmaSIMD for (CeedInt c = 0; c < C; c++) v_q[c] += v_k[c];
+        } else {
+          CeedPragmaSIMD for (CeedInt c = 0; c < C; c++) v_q[c] = v_k[c];
+        }
+      }
+    }
+  } else {
+    for (CeedInt a = 0; a < A; a++) {
+      for (CeedInt k = 0; k < num_even + num_odd; k++) {
+        const CeedScalar *u_q = &u[(a * Q_1d + impl->even_odd_rows_1d[k]) * C];
+        CeedScalar       *u_k = k < num_even ? &v_even[(a * num_even + k) * C] : &v_odd[(a * num_odd + k - num_even) * C];
+
+        CeedPragmaSIMD for (CeedInt c = 0; c < C; c++) u_k[c] = u_q[c];
+      }
+    }
+    if (num_even) {
+      CeedCallBackend(CeedTensorContractApply(contract, A, num_even, C, num_half_even, impl->interp_even_1d, t_mode, false, v_even, u_even));
+    }
+    if (num_odd) CeedCallBackend(CeedTensorContractApply(contract, A, num_odd, C, num_half_odd, impl->interp_odd_1d, t_mode, false, v_odd, u_odd));
+    if (!add) {
+      for (CeedInt i = 0; i < A * P_1d * C; i++) v[i] = 0.0;
+    }
+    for (CeedInt a = 0; a < A; a++) {
+      for (CeedInt p = 0; p < num_half_even; p++) {
+        const CeedScalar *u_e = &u_even[(a * num_half_even + p) * C];
+        CeedScalar       *v_p = &v[(a * P_1d + p) * C], *v_r = &v[(a * P_1d + P_1d - 1 - p) * C];
+
+        if (p < num_half_odd) {
+          const CeedScalar *u_o = &u_odd[(a * num_half_odd + p) * C];
+
+          CeedPragmaSIMD for (CeedInt c = 0; c < C; c++) {
+            v_p[c] += u_e[c] + u_o[c];
+            v_r[c] += u_e[c] - u_o[c];
+          }
+        } else {
+          CeedPragmaSIMD for (CeedInt c = 0; c < C; c++) v_p[c] += u_e[c];
+        }
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Basis Apply
 //------------------------------------------------------------------------------
@@ -66,12 +204,19 @@ static int CeedBasisApplyCore_Ref(CeedBasis basis, bool apply_add, CeedInt num_e
           }
           CeedInt           pre = num_comp * CeedIntPow(P, dim - 1), post = num_elem;
           CeedScalar        tmp[2][num_elem * num_comp * Q * CeedIntPow(P > Q ? P : Q, dim - 1)];
+          // Folded work for the elements of this application only, like tmp
+          CeedScalar        even_odd_work[impl->even_odd_rows_1d ? num_elem * (P + Q) * num_comp * CeedIntPow(P > Q ? P : Q, dim - 1) : 1];
           const CeedScalar *interp_1d;
 
           CeedCallBackend(CeedBasisGetInterp1D(basis, &interp_1d));
           for (CeedInt d = 0; d < dim; d++) {
-            CeedCallBackend(CeedTensorContractApply(contract, pre, P, post, Q, interp_1d, t_mode, add && (d == dim - 1), d == 0 ? u : tmp[d % 2],
-                                                    d == dim - 1 ? v : tmp[(d + 1) % 2]));
+            if (impl->even_odd_rows_1d) {
+              CeedCallBackend(CeedBasisInterpEvenOdd_Ref(impl, contract, pre, P_1d, post, Q_1d, t_mode, add && (d == dim - 1),
+                                                         d == 0 ? u : tmp[d % 2], d == dim - 1 ? v : tmp[(d + 1) % 2], even_odd_work));
+            } else {
+              CeedCallBackend(CeedTensorContractApply(contract, pre, P, post, Q, interp_1d, t_mode, add && (d == dim - 1), d == 0 ? u : tmp[d % 2],
+                                                      d == dim - 1 ? v : tmp[(d + 1) % 2]));
+            }
             pre /= P;
             post *= Q;
           }
@@ -268,6 +413,9 @@ static int CeedBasisDestroyTensor_Ref(CeedBasis basis) {
 
   CeedCallBackend(CeedBasisGetData(basis, &impl));
   CeedCallBackend(CeedFree(&impl->collo_grad_1d));
+  CeedCallBackend(CeedFree(&impl->even_odd_rows_1d));
+  CeedCallBackend(CeedFree(&impl->interp_even_1d));
+  CeedCallBackend(CeedFree(&impl->interp_odd_1d));
   CeedCallBackend(CeedFree(&impl));
   return CEED_ERROR_SUCCESS;
 }
@@ -291,10 +439,16 @@ int CeedBasisCreateTensorH1_Ref(CeedInt dim, CeedInt P_1d, CeedInt Q_1d, const C
     CeedCallBackend(CeedMalloc(Q_1d * Q_1d, &impl->collo_grad_1d));
     CeedCallBackend(CeedBasisGetCollocatedGrad(basis, impl->collo_grad_1d));
   }
-  CeedCallBackend(CeedBasisSetData(basis, impl));
-
   CeedCallBackend(CeedTensorContractCreate(ceed_parent, &contract));
   CeedCallBackend(CeedBasisSetTensorContract(basis, contract));
+  // Fold interpolation rows with even-odd symmetry, if the backend contraction benefits from smaller 1D matrices
+  if (!impl->is_collocated) {
+    bool use_even_odd;
+
+    CeedCallBackend(CeedTensorContractGetUseEvenOdd(contract, &use_even_odd));
+    if (use_even_odd) CeedCallBackend(CeedBasisCreateEvenOdd_Ref(P_1d, Q_1d, interp_1d, impl));
+  }
+  CeedCallBackend(CeedBasisSetData(basis, impl));
 
   CeedCallBackend(CeedSetBackendFunction(ceed, "Basis", basis, "Apply", CeedBasisApply_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Basis", basis, "ApplyAdd", CeedBasisApplyAdd_Ref));
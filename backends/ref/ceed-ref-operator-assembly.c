@@ -0,0 +1,741 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "ceed-ref.h"
+
+// Elements are assembled in blocks of this many lanes, with the lane index fastest
+#define BLOCK_SIZE CEED_ELEM_ASSEMBLY_BLOCK_SIZE
+
+//------------------------------------------------------------------------------
+// Check if Sum Factorization Applies
+//
+// Tensor-product active bases with only interpolation and gradient eval modes can be assembled by sum factorization.
+//------------------------------------------------------------------------------
+static int CeedOperatorAssemblyUseTensor_Ref(bool has_tensor_bases, CeedBasis basis_in, CeedBasis basis_out, CeedInt num_eval_modes_in,
+                                             const CeedEvalMode *eval_modes_in, CeedInt num_eval_modes_out, const CeedEvalMode *eval_modes_out,
+                                             bool *use_tensor) {
+  CeedInt            dim_in, dim_out, Q_1d_in, Q_1d_out;
+  CeedTensorContract contract;
+
+  *use_tensor = false;
+  if (!has_tensor_bases || basis_in == CEED_BASIS_NONE || basis_out == CEED_BASIS_NONE) return CEED_ERROR_SUCCESS;
+  CeedCallBackend(CeedBasisGetTensorContract(basis_in, &contract));
+  if (!contract) return CEED_ERROR_SUCCESS;
+  CeedCallBackend(CeedBasisGetDimension(basis_in, &dim_in));
+  CeedCallBackend(CeedBasisGetDimension(basis_out, &dim_out));
+  CeedCallBackend(CeedBasisGetNumQuadraturePoints1D(basis_in, &Q_1d_in));
+  CeedCallBackend(CeedBasisGetNumQuadraturePoints1D(basis_out, &Q_1d_out));
+  if (dim_in != dim_out || Q_1d_in != Q_1d_out) return CEED_ERROR_SUCCESS;
+
+  *use_tensor = true;
+  for (CeedInt e_in = 0; e_in < num_eval_modes_in; e_in++) {
+    *use_tensor = *use_tensor && (eval_modes_in[e_in] == CEED_EVAL_INTERP || eval_modes_in[e_in] == CEED_EVAL_GRAD);
+  }
+  for (CeedInt e_out = 0; e_out < num_eval_modes_out; e_out++) {
+    *use_tensor = *use_tensor && (eval_modes_out[e_out] == CEED_EVAL_INTERP || eval_modes_out[e_out] == CEED_EVAL_GRAD);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Products of 1D Basis Matrices
+//
+// M[e_out][e_in][d] is the Q_1d x J_1d product of the 1D matrices of the output and input eval modes in dimension d.
+//   For diagonals, M_d[q][p] = A_out[q][p] A_in[q][p] with J_1d = P_1d.
+//   For element matrices, M_d[q][i * P_1d_in + j] = A_out[q][i] A_in[q][j] with J_1d = P_1d_out * P_1d_in.
+//------------------------------------------------------------------------------
+static int CeedOperatorAssemblyTensorBasisProducts_Ref(CeedBasis basis_in, CeedBasis basis_out, CeedInt num_eval_modes_in,
+                                                       const CeedEvalMode *eval_modes_in, CeedInt num_eval_modes_out,
+                                                       const CeedEvalMode *eval_modes_out, bool is_diagonal, CeedScalar **M) {
+  CeedInt           dim, Q_1d, P_1d_in, P_1d_out, J_1d, dir_in = 0, dir_out = 0;
+  const CeedScalar *interp_1d_in, *grad_1d_in, *interp_1d_out, *grad_1d_out;
+
+  CeedCallBackend(CeedBasisGetDimension(basis_in, &dim));
+  CeedCallBackend(CeedBasisGetNumQuadraturePoints1D(basis_in, &Q_1d));
+  CeedCallBackend(CeedBasisGetNumNodes1D(basis_in, &P_1d_in));
+  CeedCallBackend(CeedBasisGetNumNodes1D(basis_out, &P_1d_out));
+  CeedCallBackend(CeedBasisGetInterp1D(basis_in, &interp_1d_in));
+  CeedCallBackend(CeedBasisGetGrad1D(basis_in, &grad_1d_in));
+  CeedCallBackend(CeedBasisGetInterp1D(basis_out, &interp_1d_out));
+  CeedCallBackend(CeedBasisGetGrad1D(basis_out, &grad_1d_out));
+  J_1d = is_diagonal ? P_1d_in : P_1d_out * P_1d_in;
+
+  CeedCallBackend(CeedCalloc(num_eval_modes_out * num_eval_modes_in * dim * Q_1d * J_1d, M));
+  for (CeedInt e_out = 0; e_out < num_eval_modes_out; e_out++) {
+    // Consecutive gradient eval modes are the derivative directions of one field
+    if (e_out > 0 && eval_modes_out[e_out] == eval_modes_out[e_out - 1]) dir_out = (dir_out + 1) % dim;
+    else dir_out = 0;
+    for (CeedInt e_in = 0; e_in < num_eval_modes_in; e_in++) {
+      if (e_in > 0 && eval_modes_in[e_in] == eval_modes_in[e_in - 1]) dir_in = (dir_in + 1) % dim;
+      else dir_in = 0;
+      for (CeedInt d = 0; d < dim; d++) {
+        const bool        is_grad_out = eval_modes_out[e_out] == CEED_EVAL_GRAD && dir_out == d;
+        const bool        is_grad_in  = eval_modes_in[e_in] == CEED_EVAL_GRAD && dir_in == d;
+        const CeedScalar *A_out       = is_grad_out ? grad_1d_out : interp_1d_out;
+        const CeedScalar *A_in        = is_grad_in ? grad_1d_in : interp_1d_in;
+        CeedScalar       *M_d         = &(*M)[((e_out * num_eval_modes_in + e_in) * dim + d) * Q_1d * J_1d];
+
+        for (CeedInt q = 0; q < Q_1d; q++) {
+          if (is_diagonal) {
+            for (CeedInt p = 0; p < P_1d_in; p++) M_d[q * J_1d + p] = A_out[q * P_1d_out + p] * A_in[q * P_1d_in + p];
+          } else {
+            for (CeedInt i = 0; i < P_1d_out; i++) {
+              for (CeedInt j = 0; j < P_1d_in; j++) M_d[q * J_1d + i * P_1d_in + j] = A_out[q * P_1d_out + i] * A_in[q * P_1d_in + j];
+            }
+          }
+        }
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Sum-factorized Assembly for Tensor-Product Bases
+//
+// The pointwise product of rows of tensor-product basis matrices is the tensor product of the 1D products M_d.
+//   Each pair of eval modes adds out[m][c] += sum_q prod_d M_d[q_d][m_d] D[q][c], contracted one dimension at a time.
+//   This is O(P^d Q) work for diagonals and O(P^{2d} Q) for element matrices, with output index m_d = i_d * P_1d_in + j_d.
+//
+// With M_last_t, the transposed J_1d x Q_1d products of the last dimension, the last contraction only forms the rows m = i * P_1d + j with i <= j.
+//   As the last dimension is the slowest node index, these contain the upper triangle of symmetric element matrices, at about half the cost.
+//------------------------------------------------------------------------------
+static int CeedOperatorAssembleTensor_Ref(CeedTensorContract contract, CeedInt dim, CeedInt Q_1d, CeedInt J_1d, CeedInt num_pairs, CeedInt num_cols,
+                                          const CeedScalar *M, const CeedScalar *M_last_t, CeedInt P_1d, const CeedScalar *D, CeedScalar *work_0,
+                                          CeedScalar *work_1, CeedScalar *out) {
+  const CeedInt num_qpts = CeedIntPow(Q_1d, dim);
+
+  for (CeedInt pair = 0; pair < num_pairs; pair++) {
+    CeedInt           pre = num_qpts / Q_1d, post = num_cols;
+    const CeedScalar *u   = &D[pair * num_qpts * num_cols];
+
+    for (CeedInt d = 0; d < dim; d++) {
+      const bool  is_last = d == dim - 1;
+      CeedScalar *v       = is_last ? out : (d % 2 ? work_1 : work_0);
+
+      if (is_last && M_last_t) {
+        // Upper triangle in the last dimension, rows i * P_1d + j for j >= i
+        for (CeedInt i = 0; i < P_1d; i++) {
+          const CeedInt m = i * P_1d + i;
+
+          CeedCallBackend(CeedTensorContractApply(contract, 1, Q_1d, post, P_1d - i, &M_last_t[(pair * J_1d + m) * Q_1d], CEED_NOTRANSPOSE,
+                                                  pair > 0, u, &v[m * post]));
+        }
+      } else {
+        CeedCallBackend(CeedTensorContractApply(contract, pre, Q_1d, post, J_1d, &M[(pair * dim + d) * Q_1d * J_1d], CEED_TRANSPOSE,
+                                                is_last && pair > 0, u, v));
+      }
+      u = v;
+      pre /= Q_1d;
+      post *= J_1d;
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Operator Diagonal or Point Block Diagonal
+//
+// For each matched pair of active bases, the products B_out^T B_in are formed once at each quadrature point and node.
+//   The element diagonals for a block of elements are then a single tensor contraction of these products with the assembled QFunction values.
+//   Tensor-product bases with only interpolation and gradient eval modes are instead sum-factorized.
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleAddDiagonalCore_Ref(CeedOperator op, bool is_point_block, CeedVector assembled, CeedRequest *request) {
+  bool                     has_tensor_bases, is_symmetric;
+  Ceed                     ceed;
+  CeedInt                  layout_qf[3], num_active_bases_in, num_active_bases_out, *num_eval_modes_in, *num_eval_modes_out;
+  CeedSize               **eval_mode_offsets_in, **eval_mode_offsets_out, num_output_components;
+  const CeedEvalMode     **eval_modes_in, **eval_modes_out;
+  const CeedScalar        *assembled_qf_array, **B_mats_in, **B_mats_out;
+  CeedVector               assembled_qf   = NULL;
+  CeedElemRestriction      assembled_rstr = NULL, *active_elem_rstrs_in, *active_elem_rstrs_out;
+  CeedBasis               *active_bases_in, *active_bases_out;
+  CeedOperatorAssemblyData data;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedOperatorHasTensorBases(op, &has_tensor_bases));
+  CeedCallBackend(CeedOperatorIsSymmetric(op, &is_symmetric));
+
+  // Assemble QFunction
+  CeedCallBackend(CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, &assembled_qf, &assembled_rstr, request));
+  CeedCallBackend(CeedElemRestrictionGetELayout(assembled_rstr, layout_qf));
+  CeedCallBackend(CeedElemRestrictionDestroy(&assembled_rstr));
+  CeedCallBackend(CeedVectorGetArrayRead(assembled_qf, CEED_MEM_HOST, &assembled_qf_array));
+
+  // Get assembly data
+  CeedCallBackend(CeedOperatorGetOperatorAssemblyData(op, &data));
+  CeedCallBackend(CeedOperatorAssemblyDataGetEvalModes(data, &num_active_bases_in, &num_eval_modes_in, &eval_modes_in, &eval_mode_offsets_in,
+                                                       &num_active_bases_out, &num_eval_modes_out, &eval_modes_out, &eval_mode_offsets_out,
+                                                       &num_output_components));
+  CeedCallBackend(CeedOperatorAssemblyDataGetBases(data, NULL, &active_bases_in, &B_mats_in, NULL, &active_bases_out, &B_mats_out));
+  CeedCallBackend(CeedOperatorAssemblyDataGetElemRestrictions(data, NULL, &active_elem_rstrs_in, NULL, &active_elem_rstrs_out));
+
+  // Loop over all active bases (find matching input/output pairs)
+  for (CeedInt b = 0; b < CeedIntMin(num_active_bases_in, num_active_bases_out); b++) {
+    bool                use_tensor = false;
+    CeedInt             b_in, b_out, num_elem, num_nodes, num_qpts, num_comp, num_comp_diag, num_comp_pairs, num_k, dim = 0, P_1d = 0, Q_1d = 0;
+    CeedInt            *pair_comps_out, *pair_comps_in;
+    CeedScalar         *elem_diag_array, *BB = NULL, *M = NULL, *work_0 = NULL, *work_1 = NULL, *D, *diag;
+    CeedTensorContract  contract = NULL;
+    CeedVector          elem_diag;
+    CeedElemRestriction diag_rstr;
+
+    if (num_active_bases_in <= num_active_bases_out) {
+      b_in = b;
+      for (b_out = 0; b_out < num_active_bases_out; b_out++) {
+        if (active_bases_in[b_in] == active_bases_out[b_out]) break;
+      }
+      if (b_out == num_active_bases_out) continue;
+    } else {
+      b_out = b;
+      for (b_in = 0; b_in < num_active_bases_in; b_in++) {
+        if (active_bases_in[b_in] == active_bases_out[b_out]) break;
+      }
+      if (b_in == num_active_bases_in) continue;
+    }
+    CeedCheck(active_elem_rstrs_in[b_in] == active_elem_rstrs_out[b_out], ceed, CEED_ERROR_UNSUPPORTED,
+              "Cannot assemble operator diagonal with different input and output active element restrictions");
+
+    // Diagonal restriction and E-vector
+    if (is_point_block) CeedCallBackend(CeedOperatorCreateActivePointBlockRestriction(active_elem_rstrs_in[b_in], &diag_rstr));
+    else CeedCallBackend(CeedElemRestrictionCreateUnsignedCopy(active_elem_rstrs_in[b_in], &diag_rstr));
+    CeedCallBackend(CeedElemRestrictionCreateVector(diag_rstr, NULL, &elem_diag));
+    CeedCallBackend(CeedElemRestrictionGetNumElements(diag_rstr, &num_elem));
+    CeedCallBackend(CeedElemRestrictionGetElementSize(active_elem_rstrs_in[b_in], &num_nodes));
+    CeedCallBackend(CeedElemRestrictionGetNumComponents(active_elem_rstrs_in[b_in], &num_comp));
+    if (active_bases_in[b_in] == CEED_BASIS_NONE) num_qpts = num_nodes;
+    else {
+      CeedCallBackend(CeedBasisGetNumQuadraturePoints(active_bases_in[b_in], &num_qpts));
+      CeedCallBackend(CeedBasisGetTensorContract(active_bases_in[b_in], &contract));
+    }
+    num_k = num_eval_modes_out[b_out] * num_eval_modes_in[b_in] * num_qpts;
+
+    // Component pairs to compute; point blocks of a symmetric operator are symmetric, so only c_out <= c_in is computed
+    num_comp_diag  = is_point_block ? num_comp * num_comp : num_comp;
+    num_comp_pairs = 0;
+    CeedCallBackend(CeedCalloc(num_comp_diag, &pair_comps_out));
+    CeedCallBackend(CeedCalloc(num_comp_diag, &pair_comps_in));
+    for (CeedInt c_out = 0; c_out < num_comp; c_out++) {
+      for (CeedInt c_in = 0; c_in < num_comp; c_in++) {
+        if (is_point_block ? (is_symmetric && c_out > c_in) : c_out != c_in) continue;
+        pair_comps_out[num_comp_pairs] = c_out;
+        pair_comps_in[num_comp_pairs]  = c_in;
+        num_comp_pairs++;
+      }
+    }
+
+    CeedCallBackend(CeedOperatorAssemblyUseTensor_Ref(has_tensor_bases, active_bases_in[b_in], active_bases_out[b_out], num_eval_modes_in[b_in],
+                                                      eval_modes_in[b_in], num_eval_modes_out[b_out], eval_modes_out[b_out], &use_tensor));
+    if (use_tensor) {
+      CeedCallBackend(CeedBasisGetDimension(active_bases_in[b_in], &dim));
+      CeedCallBackend(CeedBasisGetNumNodes1D(active_bases_in[b_in], &P_1d));
+      CeedCallBackend(CeedBasisGetNumQuadraturePoints1D(active_bases_in[b_in], &Q_1d));
+      CeedCallBackend(CeedOperatorAssemblyTensorBasisProducts_Ref(active_bases_in[b_in], active_bases_out[b_out], num_eval_modes_in[b_in],
+                                                                  eval_modes_in[b_in], num_eval_modes_out[b_out], eval_modes_out[b_out], true, &M));
+      CeedCallBackend(CeedCalloc(CeedIntPow(CeedIntMax(P_1d, Q_1d), dim) * num_comp_pairs * BLOCK_SIZE, &work_0));
+      CeedCallBackend(CeedCalloc(CeedIntPow(CeedIntMax(P_1d, Q_1d), dim) * num_comp_pairs * BLOCK_SIZE, &work_1));
+    } else {
+      // Products of basis values, BB[k][n] for k = (e_out, e_in, q)
+      CeedCallBackend(CeedCalloc(num_k * num_nodes, &BB));
+      for (CeedInt e_out = 0; e_out < num_eval_modes_out[b_out]; e_out++) {
+        for (CeedInt e_in = 0; e_in < num_eval_modes_in[b_in]; e_in++) {
+          for (CeedInt q = 0; q < num_qpts; q++) {
+            const CeedInt     k     = (e_out * num_eval_modes_in[b_in] + e_in) * num_qpts + q;
+            const CeedScalar *B_out = &B_mats_out[b_out][(q * num_eval_modes_out[b_out] + e_out) * num_nodes];
+            const CeedScalar *B_in  = &B_mats_in[b_in][(q * num_eval_modes_in[b_in] + e_in) * num_nodes];
+
+            for (CeedInt n = 0; n < num_nodes; n++) BB[k * num_nodes + n] = B_out[n] * B_in[n];
+          }
+        }
+      }
+    }
+
+    // Compute element diagonals, one block of elements at a time
+    CeedCallBackend(CeedCalloc(num_k * num_comp_pairs * BLOCK_SIZE, &D));
+    CeedCallBackend(CeedCalloc(num_nodes * num_comp_pairs * BLOCK_SIZE, &diag));
+    CeedCallBackend(CeedVectorSetValue(elem_diag, 0.0));
+    CeedCallBackend(CeedVectorGetArray(elem_diag, CEED_MEM_HOST, &elem_diag_array));
+    for (CeedInt e_start = 0; e_start < num_elem; e_start += BLOCK_SIZE) {
+      const CeedInt num_lanes = CeedIntMin(BLOCK_SIZE, num_elem - e_start);
+
+      // Gather QFunction values, D[k][c][lane] for c = (c_out, c_in)
+      for (CeedInt e_out = 0; e_out < num_eval_modes_out[b_out]; e_out++) {
+        for (CeedInt e_in = 0; e_in < num_eval_modes_in[b_in]; e_in++) {
+          for (CeedInt q = 0; q < num_qpts; q++) {
+            const CeedInt k = (e_out * num_eval_modes_in[b_in] + e_in) * num_qpts + q;
+
+            for (CeedInt c = 0; c < num_comp_pairs; c++) {
+              const CeedInt     c_out = pair_comps_out[c], c_in = pair_comps_in[c];
+              const CeedSize    c_offset =
+                  (eval_mode_offsets_in[b_in][e_in] + c_in) * num_output_components + eval_mode_offsets_out[b_out][e_out] + c_out;
+              const CeedScalar *qf_value = &assembled_qf_array[q * layout_qf[0] + c_offset * layout_qf[1] + (CeedSize)e_start * layout_qf[2]];
+              CeedScalar       *D_k      = &D[(k * num_comp_pairs + c) * BLOCK_SIZE];
+
+              for (CeedInt lane = 0; lane < num_lanes; lane++) D_k[lane] = qf_value[lane * layout_qf[2]];
+              for (CeedInt lane = num_lanes; lane < BLOCK_SIZE; lane++) D_k[lane] = 0.0;
+            }
+          }
+        }
+      }
+
+      // diag[n][c][lane] = sum_k BB[k][n] D[k][c][lane]
+      if (use_tensor) {
+        CeedCallBackend(CeedOperatorAssembleTensor_Ref(contract, dim, Q_1d, P_1d, num_eval_modes_out[b_out] * num_eval_modes_in[b_in],
+                                                       num_comp_pairs * BLOCK_SIZE, M, NULL, P_1d, D, work_0, work_1, diag));
+      } else if (contract) {
+        CeedCallBackend(CeedTensorContractApply(contract, 1, num_k, num_comp_pairs * BLOCK_SIZE, num_nodes, BB, CEED_TRANSPOSE, false, D, diag));
+      } else {
+        for (CeedInt i = 0; i < num_nodes * num_comp_pairs * BLOCK_SIZE; i++) diag[i] = 0.0;
+        for (CeedInt k = 0; k < num_k; k++) {
+          for (CeedInt n = 0; n < num_nodes; n++) {
+            const CeedScalar  bb     = BB[k * num_nodes + n];
+            const CeedScalar *D_k    = &D[k * num_comp_pairs * BLOCK_SIZE];
+            CeedScalar       *diag_n = &diag[n * num_comp_pairs * BLOCK_SIZE];
+
+            CeedPragmaSIMD for (CeedInt i = 0; i < num_comp_pairs * BLOCK_SIZE; i++) diag_n[i] += bb * D_k[i];
+          }
+        }
+      }
+
+      // Scatter into element diagonal E-vector
+      for (CeedInt lane = 0; lane < num_lanes; lane++) {
+        const CeedSize e = e_start + lane;
+
+        for (CeedInt c = 0; c < num_comp_pairs; c++) {
+          const CeedInt c_out = pair_comps_out[c], c_in = pair_comps_in[c];
+          const CeedInt c_diag = is_point_block ? c_out * num_comp + c_in : c_out, c_diag_mirror = is_point_block ? c_in * num_comp + c_out : c_out;
+          const bool    mirror = is_symmetric && c_diag_mirror != c_diag;
+
+          for (CeedInt n = 0; n < num_nodes; n++) {
+            const CeedScalar value = diag[(n * num_comp_pairs + c) * BLOCK_SIZE + lane];
+
+            elem_diag_array[(e * num_comp_diag + c_diag) * num_nodes + n] += value;
+            if (mirror) elem_diag_array[(e * num_comp_diag + c_diag_mirror) * num_nodes + n] += value;
+          }
+        }
+      }
+    }
+    CeedCallBackend(CeedVectorRestoreArray(elem_diag, &elem_diag_array));
+
+    // Assemble local operator diagonal
+    CeedCallBackend(CeedElemRestrictionApply(diag_rstr, CEED_TRANSPOSE, elem_diag, assembled, request));
+
+    // Cleanup
+    CeedCallBackend(CeedFree(&pair_comps_out));
+    CeedCallBackend(CeedFree(&pair_comps_in));
+    CeedCallBackend(CeedFree(&BB));
+    CeedCallBackend(CeedFree(&M));
+    CeedCallBackend(CeedFree(&work_0));
+    CeedCallBackend(CeedFree(&work_1));
+    CeedCallBackend(CeedFree(&D));
+    CeedCallBackend(CeedFree(&diag));
+    CeedCallBackend(CeedElemRestrictionDestroy(&diag_rstr));
+    CeedCallBackend(CeedVectorDestroy(&elem_diag));
+  }
+  CeedCallBackend(CeedVectorRestoreArrayRead(assembled_qf, &assembled_qf_array));
+  CeedCallBackend(CeedVectorDestroy(&assembled_qf));
+  CeedCallBackend(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Operator Diagonal
+//------------------------------------------------------------------------------
+int CeedOperatorLinearAssembleAddDiagonal_Ref(CeedOperator op, CeedVector assembled, CeedRequest *request) {
+  return CeedOperatorLinearAssembleAddDiagonalCore_Ref(op, false, assembled, request);
+}
+
+//------------------------------------------------------------------------------
+// Assemble Operator Point Block Diagonal
+//------------------------------------------------------------------------------
+int CeedOperatorLinearAssembleAddPointBlockDiagonal_Ref(CeedOperator op, CeedVector assembled, CeedRequest *request) {
+  return CeedOperatorLinearAssembleAddDiagonalCore_Ref(op, true, assembled, request);
+}
+
+//------------------------------------------------------------------------------
+// Assemble Operator Core
+//
+// Element matrices B_out^T D B_in for a block of elements in [elem_start, elem_stop) are formed with the lane index fastest.
+//   The product with B_in is a single tensor contraction per component pair and block.
+//   Tensor-product bases with only interpolation and gradient eval modes are instead sum-factorized.
+// The element matrices of a block are gathered in coordinate order and then either copied into the coordinate values at offset, counted from
+//   elem_start, or, with a scatter table, summed into compressed sparse values.
+//------------------------------------------------------------------------------
+static int CeedSingleOperatorAssembleCore_Ref(CeedOperator op, CeedInt elem_start, CeedInt elem_stop, CeedInt offset, const CeedSize *scatter,
+                                              CeedVector values) {
+  bool                     has_tensor_bases, use_tensor, is_symmetric;
+  Ceed                     ceed;
+  CeedInt                  layout_qf[3], num_elem, elem_size_in, elem_size_out, num_comp_in, num_comp_out, num_qpts, num_k, elem_entries;
+  CeedInt                  num_active_bases_in, num_active_bases_out, *num_eval_modes_in, *num_eval_modes_out;
+  CeedInt                  dim = 0, Q_1d = 0, P_1d = 0, J_1d = 0, num_pairs = 0, *tensor_index = NULL;
+  const CeedEvalMode     **eval_modes_in, **eval_modes_out;
+  const CeedScalar        *assembled_qf_array, **B_mats_in, **B_mats_out, *B_mat_in, *B_mat_out;
+  CeedScalar              *vals, *BTD = NULL, *M = NULL, *D = NULL, *work_0 = NULL, *work_1 = NULL, *block_mat, *block_vals, *elem_mat;
+  CeedScalar              *elem_mat_b = NULL, *M_last_t = NULL, *B_mat_in_t = NULL;
+  const bool              *orients_in = NULL, *orients_out = NULL;
+  const CeedInt8          *curl_orients_in = NULL, *curl_orients_out = NULL;
+  CeedVector               assembled_qf   = NULL;
+  CeedElemRestriction      assembled_rstr = NULL, rstr_in, rstr_out;
+  CeedRestrictionType      rstr_type_in, rstr_type_out;
+  CeedBasis               *active_bases_in, *active_bases_out;
+  CeedTensorContract       contract = NULL;
+  CeedOperatorAssemblyData data;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+
+  // Assemble QFunction
+  CeedCallBackend(CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, &assembled_qf, &assembled_rstr, CEED_REQUEST_IMMEDIATE));
+  CeedCallBackend(CeedElemRestrictionGetELayout(assembled_rstr, layout_qf));
+  CeedCallBackend(CeedElemRestrictionDestroy(&assembled_rstr));
+  CeedCallBackend(CeedVectorGetArrayRead(assembled_qf, CEED_MEM_HOST, &assembled_qf_array));
+
+  // Get assembly data
+  CeedCallBackend(CeedOperatorGetOperatorAssemblyData(op, &data));
+  CeedCallBackend(CeedOperatorAssemblyDataGetEvalModes(data, &num_active_bases_in, &num_eval_modes_in, &eval_modes_in, NULL, &num_active_bases_out,
+                                                       &num_eval_modes_out, &eval_modes_out, NULL, NULL));
+  CeedCheck(num_active_bases_in == 1 && num_active_bases_out == 1, ceed, CEED_ERROR_UNSUPPORTED,
+            "Cannot assemble operator with multiple active bases");
+  CeedCheck(num_eval_modes_in[0] > 0 && num_eval_modes_out[0] > 0, ceed, CEED_ERROR_UNSUPPORTED,
+            "Cannot assemble operator without inputs/outputs");
+  CeedCallBackend(CeedOperatorAssemblyDataGetBases(data, NULL, &active_bases_in, &B_mats_in, NULL, &active_bases_out, &B_mats_out));
+  B_mat_in  = B_mats_in[0];
+  B_mat_out = B_mats_out[0];
+
+  // Active restrictions
+  CeedCallBackend(CeedOperatorGetActiveElemRestrictions(op, &rstr_in, &rstr_out));
+  CeedCallBackend(CeedElemRestrictionGetNumElements(rstr_in, &num_elem));
+  CeedCallBackend(CeedElemRestrictionGetElementSize(rstr_in, &elem_size_in));
+  CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr_in, &num_comp_in));
+  CeedCallBackend(CeedElemRestrictionGetElementSize(rstr_out, &elem_size_out));
+  CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr_out, &num_comp_out));
+  {
+    CeedInt num_elem_out, num_qpts_out;
+
+    CeedCallBackend(CeedElemRestrictionGetNumElements(rstr_out, &num_elem_out));
+    CeedCheck(num_elem == num_elem_out, ceed, CEED_ERROR_UNSUPPORTED,
+              "Active input and output operator restrictions must have the same number of elements."
+              " Input has %" CeedInt_FMT " elements; output has %" CeedInt_FMT "elements.",
+              num_elem, num_elem_out);
+    if (active_bases_in[0] == CEED_BASIS_NONE) num_qpts = elem_size_in;
+    else CeedCallBackend(CeedBasisGetNumQuadraturePoints(active_bases_in[0], &num_qpts));
+    if (active_bases_out[0] == CEED_BASIS_NONE) num_qpts_out = elem_size_out;
+    else CeedCallBackend(CeedBasisGetNumQuadraturePoints(active_bases_out[0], &num_qpts_out));
+    CeedCheck(num_qpts == num_qpts_out, ceed, CEED_ERROR_UNSUPPORTED,
+              "Active input and output bases must have the same number of quadrature points."
+              " Input has %" CeedInt_FMT " points; output has %" CeedInt_FMT "points.",
+              num_qpts, num_qpts_out);
+  }
+  CeedCallBackend(CeedElemRestrictionGetType(rstr_in, &rstr_type_in));
+  if (rstr_type_in == CEED_RESTRICTION_ORIENTED) CeedCallBackend(CeedElemRestrictionGetOrientations(rstr_in, CEED_MEM_HOST, &orients_in));
+  else if (rstr_type_in == CEED_RESTRICTION_CURL_ORIENTED) {
+    CeedCallBackend(CeedElemRestrictionGetCurlOrientations(rstr_in, CEED_MEM_HOST, &curl_orients_in));
+  }
+  CeedCallBackend(CeedElemRestrictionGetType(rstr_out, &rstr_type_out));
+  if (rstr_type_out == CEED_RESTRICTION_ORIENTED) CeedCallBackend(CeedElemRestrictionGetOrientations(rstr_out, CEED_MEM_HOST, &orients_out));
+  else if (rstr_type_out == CEED_RESTRICTION_CURL_ORIENTED) {
+    CeedCallBackend(CeedElemRestrictionGetCurlOrientations(rstr_out, CEED_MEM_HOST, &curl_orients_out));
+  }
+  if (active_bases_in[0] != CEED_BASIS_NONE) CeedCallBackend(CeedBasisGetTensorContract(active_bases_in[0], &contract));
+  CeedCallBackend(CeedOperatorHasTensorBases(op, &has_tensor_bases));
+  CeedCallBackend(CeedOperatorAssemblyUseTensor_Ref(has_tensor_bases, active_bases_in[0], active_bases_out[0], num_eval_modes_in[0], eval_modes_in[0],
+                                                    num_eval_modes_out[0], eval_modes_out[0], &use_tensor));
+  CeedCallBackend(CeedOperatorIsSymmetric(op, &is_symmetric));
+  is_symmetric = is_symmetric && rstr_in == rstr_out && active_bases_in[0] == active_bases_out[0];
+
+  // Work arrays, with the lane index fastest
+  num_k = num_qpts * num_eval_modes_in[0];
+  if (use_tensor) {
+    CeedInt P_1d_in, P_1d_out, work_size = 1;
+
+    CeedCallBackend(CeedBasisGetDimension(active_bases_in[0], &dim));
+    CeedCallBackend(CeedBasisGetNumQuadraturePoints1D(active_bases_in[0], &Q_1d));
+    CeedCallBackend(CeedBasisGetNumNodes1D(active_bases_in[0], &P_1d_in));
+    CeedCallBackend(CeedBasisGetNumNodes1D(active_bases_out[0], &P_1d_out));
+    J_1d      = P_1d_out * P_1d_in;
+    num_pairs = num_eval_modes_out[0] * num_eval_modes_in[0];
+    CeedCallBackend(CeedOperatorAssemblyTensorBasisProducts_Ref(active_bases_in[0], active_bases_out[0], num_eval_modes_in[0], eval_modes_in[0],
+                                                                num_eval_modes_out[0], eval_modes_out[0], false, &M));
+    // Transposed products of the last dimension, to contract only the upper triangle of symmetric element matrices
+    if (is_symmetric) {
+      P_1d = P_1d_in;
+      CeedCallBackend(CeedCalloc(num_pairs * J_1d * Q_1d, &M_last_t));
+      for (CeedInt pair = 0; pair < num_pairs; pair++) {
+        const CeedScalar *M_d = &M[(pair * dim + dim - 1) * Q_1d * J_1d];
+
+        for (CeedInt q = 0; q < Q_1d; q++) {
+          for (CeedInt m = 0; m < J_1d; m++) M_last_t[(pair * J_1d + m) * Q_1d + q] = M_d[q * J_1d + m];
+        }
+      }
+    }
+    CeedCallBackend(CeedCalloc(num_pairs * num_qpts * BLOCK_SIZE, &D));
+    for (CeedInt d = 0; d < dim - 1; d++) work_size = CeedIntMax(work_size, CeedIntPow(Q_1d, dim - 1 - d) * CeedIntPow(J_1d, d + 1));
+    CeedCallBackend(CeedCalloc(work_size * BLOCK_SIZE, &work_0));
+    CeedCallBackend(CeedCalloc(work_size * BLOCK_SIZE, &work_1));
+
+    // Position of each element matrix entry in the sum-factorized output, with m_d = i_d * P_1d_in + j_d
+    CeedCallBackend(CeedCalloc(elem_size_out * elem_size_in, &tensor_index));
+    for (CeedInt i = 0; i < elem_size_out; i++) {
+      for (CeedInt j = 0; j < elem_size_in; j++) {
+        CeedInt index = 0;
+
+        for (CeedInt d = dim - 1; d >= 0; d--) {
+          const CeedInt i_d = (i / CeedIntPow(P_1d_out, d)) % P_1d_out, j_d = (j / CeedIntPow(P_1d_in, d)) % P_1d_in;
+
+          index = index * J_1d + i_d * P_1d_in + j_d;
+        }
+        tensor_index[i * elem_size_in + j] = index;
+      }
+    }
+  } else {
+    CeedCallBackend(CeedCalloc(elem_size_out * num_k * BLOCK_SIZE, &BTD));
+    // Transposed input basis, to contract only the upper triangle of symmetric element matrices one row at a time
+    if (is_symmetric && contract) {
+      CeedCallBackend(CeedCalloc(elem_size_in * num_k, &B_mat_in_t));
+      for (CeedInt k = 0; k < num_k; k++) {
+        for (CeedInt j = 0; j < elem_size_in; j++) B_mat_in_t[j * num_k + k] = B_mat_in[k * elem_size_in + j];
+      }
+    }
+  }
+  elem_entries = num_comp_in * num_comp_out * elem_size_out * elem_size_in;
+  CeedCallBackend(CeedCalloc(elem_size_out * elem_size_in * BLOCK_SIZE, &block_mat));
+  CeedCallBackend(CeedCalloc(elem_entries * BLOCK_SIZE, &block_vals));
+  CeedCallBackend(CeedCalloc(elem_size_out * elem_size_in, &elem_mat));
+  if (curl_orients_in || curl_orients_out) CeedCallBackend(CeedCalloc(elem_size_out * elem_size_in, &elem_mat_b));
+
+  // Loop over blocks of elements
+  CeedCallBackend(CeedVectorGetArray(values, CEED_MEM_HOST, &vals));
+  for (CeedInt e_start = elem_start; e_start < elem_stop; e_start += BLOCK_SIZE) {
+    const CeedInt num_lanes = CeedIntMin(BLOCK_SIZE, elem_stop - e_start);
+
+    for (CeedInt comp_in = 0; comp_in < num_comp_in; comp_in++) {
+      for (CeedInt comp_out = 0; comp_out < num_comp_out; comp_out++) {
+        // Symmetric diagonal blocks only form the upper triangle, and the lower triangle is mirrored when storing the element matrices
+        const bool is_triangle = is_symmetric && comp_in == comp_out;
+
+        if (is_symmetric && comp_out < comp_in) {
+          // Symmetric operator, copy the transpose of the element matrix for (comp_in, comp_out) = (comp_out, comp_in)
+          for (CeedInt lane = 0; lane < num_lanes; lane++) {
+            const CeedScalar *vals_t = &block_vals[((lane * num_comp_in + comp_out) * num_comp_out + comp_in) * elem_size_out * elem_size_in];
+            CeedScalar       *vals_e = &block_vals[((lane * num_comp_in + comp_in) * num_comp_out + comp_out) * elem_size_out * elem_size_in];
+
+            for (CeedInt i = 0; i < elem_size_out; i++) {
+              for (CeedInt j = 0; j < elem_size_in; j++) vals_e[i * elem_size_in + j] = vals_t[j * elem_size_in + i];
+            }
+          }
+          continue;
+        }
+        if (use_tensor) {
+          // Gather QFunction values, D[pair][q][lane] for pair = (e_out, e_in)
+          for (CeedInt e_out = 0; e_out < num_eval_modes_out[0]; e_out++) {
+            for (CeedInt e_in = 0; e_in < num_eval_modes_in[0]; e_in++) {
+              const CeedSize eval_mode_index = ((e_in * num_comp_in + comp_in) * num_eval_modes_out[0] + e_out) * num_comp_out + comp_out;
+
+              for (CeedInt q = 0; q < num_qpts; q++) {
+                const CeedScalar *qf_value =
+                    &assembled_qf_array[q * layout_qf[0] + eval_mode_index * layout_qf[1] + (CeedSize)e_start * layout_qf[2]];
+                CeedScalar *D_q = &D[((e_out * num_eval_modes_in[0] + e_in) * num_qpts + q) * BLOCK_SIZE];
+
+                for (CeedInt lane = 0; lane < num_lanes; lane++) D_q[lane] = qf_value[lane * layout_qf[2]];
+                for (CeedInt lane = num_lanes; lane < BLOCK_SIZE; lane++) D_q[lane] = 0.0;
+              }
+            }
+          }
+
+          // Form element matrices by sum factorization, block_mat[m][lane]
+          CeedCallBackend(CeedOperatorAssembleTensor_Ref(contract, dim, Q_1d, J_1d, num_pairs, BLOCK_SIZE, M, is_triangle ? M_last_t : NULL, P_1d, D,
+                                                         work_0, work_1, block_mat));
+        } else {
+          // Compute B^T*D, BTD[n][k][lane] for k = (q, e_in)
+          for (CeedInt n = 0; n < elem_size_out; n++) {
+            for (CeedInt q = 0; q < num_qpts; q++) {
+              for (CeedInt e_in = 0; e_in < num_eval_modes_in[0]; e_in++) {
+                CeedScalar *BTD_k = &BTD[(n * num_k + q * num_eval_modes_in[0] + e_in) * BLOCK_SIZE];
+
+                for (CeedInt lane = 0; lane < BLOCK_SIZE; lane++) BTD_k[lane] = 0.0;
+                for (CeedInt e_out = 0; e_out < num_eval_modes_out[0]; e_out++) {
+                  const CeedScalar  b_out           = B_mat_out[(q * num_eval_modes_out[0] + e_out) * elem_size_out + n];
+                  const CeedSize    eval_mode_index = ((e_in * num_comp_in + comp_in) * num_eval_modes_out[0] + e_out) * num_comp_out + comp_out;
+                  const CeedScalar *qf_value =
+                      &assembled_qf_array[q * layout_qf[0] + eval_mode_index * layout_qf[1] + (CeedSize)e_start * layout_qf[2]];
+
+                  for (CeedInt lane = 0; lane < num_lanes; lane++) BTD_k[lane] += b_out * qf_value[lane * layout_qf[2]];
+                }
+              }
+            }
+          }
+
+          // Form element matrices, block_mat[i][j][lane] = sum_k BTD[i][k][lane] B_in[k][j]
+          if (contract && is_triangle) {
+            // Upper triangle, contracting row i with the transposed input basis rows j >= i
+            for (CeedInt i = 0; i < elem_size_out; i++) {
+              CeedCallBackend(CeedTensorContractApply(contract, 1, num_k, BLOCK_SIZE, elem_size_in - i, &B_mat_in_t[i * num_k], CEED_NOTRANSPOSE,
+                                                      false, &BTD[i * num_k * BLOCK_SIZE], &block_mat[(i * elem_size_in + i) * BLOCK_SIZE]));
+            }
+          } else if (contract) {
+            CeedCallBackend(
+                CeedTensorContractApply(contract, elem_size_out, num_k, BLOCK_SIZE, elem_size_in, B_mat_in, CEED_TRANSPOSE, false, BTD, block_mat));
+          } else if (is_triangle) {
+            // Upper triangle
+            for (CeedInt i = 0; i < elem_size_out * elem_size_in * BLOCK_SIZE; i++) block_mat[i] = 0.0;
+            for (CeedInt i = 0; i < elem_size_out; i++) {
+              for (CeedInt k = 0; k < num_k; k++) {
+                const CeedScalar *BTD_k = &BTD[(i * num_k + k) * BLOCK_SIZE];
+
+                for (CeedInt j = i; j < elem_size_in; j++) {
+                  const CeedScalar b_in     = B_mat_in[k * elem_size_in + j];
+                  CeedScalar      *block_ij = &block_mat[(i * elem_size_in + j) * BLOCK_SIZE];
+
+                  CeedPragmaSIMD for (CeedInt lane = 0; lane < BLOCK_SIZE; lane++) block_ij[lane] += BTD_k[lane] * b_in;
+                }
+              }
+            }
+          } else {
+            for (CeedInt i = 0; i < elem_size_out * elem_size_in * BLOCK_SIZE; i++) block_mat[i] = 0.0;
+            for (CeedInt i = 0; i < elem_size_out; i++) {
+              for (CeedInt k = 0; k < num_k; k++) {
+                const CeedScalar *BTD_k = &BTD[(i * num_k + k) * BLOCK_SIZE];
+
+                for (CeedInt j = 0; j < elem_size_in; j++) {
+                  const CeedScalar b_in     = B_mat_in[k * elem_size_in + j];
+                  CeedScalar      *block_ij = &block_mat[(i * elem_size_in + j) * BLOCK_SIZE];
+
+                  CeedPragmaSIMD for (CeedInt lane = 0; lane < BLOCK_SIZE; lane++) block_ij[lane] += BTD_k[lane] * b_in;
+                }
+              }
+            }
+          }
+        }
+
+        // Transform and store each element matrix
+        for (CeedInt lane = 0; lane < num_lanes; lane++) {
+          const CeedSize e      = e_start + lane;
+          CeedScalar    *vals_e = &block_vals[((lane * num_comp_in + comp_in) * num_comp_out + comp_out) * elem_size_out * elem_size_in];
+
+          for (CeedInt i = 0; i < elem_size_out; i++) {
+            for (CeedInt j = 0; j < elem_size_in; j++) {
+              // Mirror the lower triangle of symmetric diagonal blocks
+              const CeedInt ij = is_triangle && j < i ? j * elem_size_in + i : i * elem_size_in + j;
+
+              elem_mat[i * elem_size_in + j] = block_mat[(tensor_index ? tensor_index[ij] : ij) * BLOCK_SIZE + lane];
+            }
+          }
+          if (orients_out) {
+            const bool *elem_orients = &orients_out[e * elem_size_out];
+
+            for (CeedInt i = 0; i < elem_size_out; i++) {
+              if (!elem_orients[i]) continue;
+              for (CeedInt j = 0; j < elem_size_in; j++) elem_mat[i * elem_size_in + j] *= -1.0;
+            }
+          } else if (curl_orients_out) {
+            const CeedInt8 *elem_curl_orients = &curl_orients_out[e * 3 * elem_size_out];
+
+            // T^T*(B^T*D*B)
+            memcpy(elem_mat_b, elem_mat, elem_size_out * elem_size_in * sizeof(CeedScalar));
+            for (CeedInt i = 0; i < elem_size_out; i++) {
+              for (CeedInt j = 0; j < elem_size_in; j++) {
+                elem_mat[i * elem_size_in + j] =
+                    elem_mat_b[i * elem_size_in + j] * elem_curl_orients[3 * i + 1] +
+                    (i > 0 ? elem_mat_b[(i - 1) * elem_size_in + j] * elem_curl_orients[3 * i - 1] : 0.0) +
+                    (i < elem_size_out - 1 ? elem_mat_b[(i + 1) * elem_size_in + j] * elem_curl_orients[3 * i + 3] : 0.0);
+              }
+            }
+          }
+          if (orients_in) {
+            const bool *elem_orients = &orients_in[e * elem_size_in];
+
+            for (CeedInt i = 0; i < elem_size_out; i++) {
+              for (CeedInt j = 0; j < elem_size_in; j++) elem_mat[i * elem_size_in + j] *= elem_orients[j] ? -1.0 : 1.0;
+            }
+          } else if (curl_orients_in) {
+            const CeedInt8 *elem_curl_orients = &curl_orients_in[e * 3 * elem_size_in];
+
+            // (B^T*D*B)*T
+            memcpy(elem_mat_b, elem_mat, elem_size_out * elem_size_in * sizeof(CeedScalar));
+            for (CeedInt i = 0; i < elem_size_out; i++) {
+              for (CeedInt j = 0; j < elem_size_in; j++) {
+                elem_mat[i * elem_size_in + j] = elem_mat_b[i * elem_size_in + j] * elem_curl_orients[3 * j + 1] +
+                                                 (j > 0 ? elem_mat_b[i * elem_size_in + j - 1] * elem_curl_orients[3 * j - 1] : 0.0) +
+                                                 (j < elem_size_in - 1 ? elem_mat_b[i * elem_size_in + j + 1] * elem_curl_orients[3 * j + 3] : 0.0);
+              }
+            }
+          }
+          memcpy(vals_e, elem_mat, elem_size_out * elem_size_in * sizeof(CeedScalar));
+        }
+      }
+    }
+
+    // Store the element matrices of the block
+    if (scatter) {
+      const CeedSize *scatter_block = &scatter[(CeedSize)e_start * elem_entries];
+
+      for (CeedInt i = 0; i < num_lanes * elem_entries; i++) {
+        if (scatter_block[i] >= 0) vals[scatter_block[i]] += block_vals[i];
+      }
+    } else {
+      memcpy(&vals[offset + (CeedSize)(e_start - elem_start) * elem_entries], block_vals, num_lanes * elem_entries * sizeof(CeedScalar));
+    }
+  }
+  CeedCallBackend(CeedVectorRestoreArray(values, &vals));
+
+  // Cleanup
+  CeedCallBackend(CeedFree(&BTD));
+  CeedCallBackend(CeedFree(&M));
+  CeedCallBackend(CeedFree(&M_last_t));
+  CeedCallBackend(CeedFree(&B_mat_in_t));
+  CeedCallBackend(CeedFree(&D));
+  CeedCallBackend(CeedFree(&work_0));
+  CeedCallBackend(CeedFree(&work_1));
+  CeedCallBackend(CeedFree(&tensor_index));
+  CeedCallBackend(CeedFree(&block_mat));
+  CeedCallBackend(CeedFree(&block_vals));
+  CeedCallBackend(CeedFree(&elem_mat));
+  CeedCallBackend(CeedFree(&elem_mat_b));
+  if (orients_in) CeedCallBackend(CeedElemRestrictionRestoreOrientations(rstr_in, &orients_in));
+  else if (curl_orients_in) CeedCallBackend(CeedElemRestrictionRestoreCurlOrientations(rstr_in, &curl_orients_in));
+  if (orients_out) CeedCallBackend(CeedElemRestrictionRestoreOrientations(rstr_out, &orients_out));
+  else if (curl_orients_out) CeedCallBackend(CeedElemRestrictionRestoreCurlOrientations(rstr_out, &curl_orients_out));
+  CeedCallBackend(CeedElemRestrictionDestroy(&rstr_in));
+  CeedCallBackend(CeedElemRestrictionDestroy(&rstr_out));
+  CeedCallBackend(CeedVectorRestoreArrayRead(assembled_qf, &assembled_qf_array));
+  CeedCallBackend(CeedVectorDestroy(&assembled_qf));
+  CeedCallBackend(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Operator
+//------------------------------------------------------------------------------
+int CeedSingleOperatorAssemble_Ref(CeedOperator op, CeedInt offset, CeedVector values) {
+  CeedInt num_elem;
+
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  return CeedSingleOperatorAssembleCore_Ref(op, 0, num_elem, offset, NULL, values);
+}
+
+//------------------------------------------------------------------------------
+// Assemble Operator for a Range of Elements
+//------------------------------------------------------------------------------
+int CeedSingleOperatorAssembleRange_Ref(CeedOperator op, CeedInt elem_start, CeedInt elem_stop, CeedVector values) {
+  return CeedSingleOperatorAssembleCore_Ref(op, elem_start, elem_stop, 0, NULL, values);
+}
+
+//------------------------------------------------------------------------------
+// Assemble Operator into Compressed Sparse Storage
+//------------------------------------------------------------------------------
+int CeedSingleOperatorAssembleAddSparse_Ref(CeedOperator op, const CeedSize *scatter, CeedVector values) {
+  CeedInt num_elem;
+
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  return CeedSingleOperatorAssembleCore_Ref(op, 0, num_elem, 0, scatter, values);
+}
+
+//------------------------------------------------------------------------------
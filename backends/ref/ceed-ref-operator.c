@@ -10,6 +10,7 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "ceed-ref.h"
 
@@ -17,11 +18,11 @@
 // Setup Input/Output Fields
 //------------------------------------------------------------------------------
 static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op, bool is_input, bool *skip_rstr, CeedInt *e_data_out_indices,
-                                       bool *apply_add_basis, CeedVector *e_vecs_full, CeedVector *e_vecs, CeedVector *q_vecs, CeedInt start_e,
-                                       CeedInt num_fields, CeedInt Q) {
+                                       bool *apply_add_basis, bool *is_elem_shared, CeedVector *e_vecs_full, CeedVector *e_vecs, CeedVector *q_vecs,
+                                       CeedInt start_e, CeedInt num_fields, CeedInt Q, CeedInt chunk_size) {
   Ceed                ceed;
   CeedSize            e_size, q_size;
-  CeedInt             num_comp, size, P;
+  CeedInt             num_comp, size, P, elem_size;
   CeedQFunctionField *qf_fields;
   CeedOperatorField  *op_fields;
 
@@ -49,8 +50,24 @@ static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op, bool i
 
     CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_fields[i], &eval_mode));
     if (eval_mode != CEED_EVAL_WEIGHT) {
+      bool       is_active, is_chunked;
+      CeedVector vec;
+
+      // Active inputs and all outputs only hold one chunk of elements; passive inputs are kept in full, unless shared by all elements
+      CeedCallBackend(CeedOperatorFieldGetVector(op_fields[i], &vec));
+      is_active = vec == CEED_VECTOR_ACTIVE;
+      CeedCallBackend(CeedVectorDestroy(&vec));
+      is_chunked = chunk_size > 0 && (!is_input || is_active);
       CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_fields[i], &elem_rstr));
-      CeedCallBackend(CeedElemRestrictionCreateVector(elem_rstr, NULL, &e_vecs_full[i + start_e]));
+      if (is_input && !is_active) CeedCallBackend(CeedElemRestrictionIsElementShared(elem_rstr, &is_elem_shared[i]));
+      if (is_chunked || (is_input && is_elem_shared[i])) {
+        CeedCallBackend(CeedElemRestrictionGetElementSize(elem_rstr, &elem_size));
+        CeedCallBackend(CeedElemRestrictionGetNumComponents(elem_rstr, &num_comp));
+        e_size = (CeedSize)(is_chunked ? chunk_size : 1) * elem_size * num_comp;
+        CeedCallBackend(CeedVectorCreate(ceed, e_size, &e_vecs_full[i + start_e]));
+      } else {
+        CeedCallBackend(CeedElemRestrictionCreateVector(elem_rstr, NULL, &e_vecs_full[i + start_e]));
+      }
       CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
     }
 
@@ -144,7 +161,7 @@ static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op, bool i
 //------------------------------------------------------------------------------/*
 static int CeedOperatorSetup_Ref(CeedOperator op) {
   bool                is_setup_done;
-  CeedInt             Q, num_input_fields, num_output_fields;
+  CeedInt             Q, num_elem, num_input_fields, num_output_fields, chunk_size;
   CeedQFunctionField *qf_input_fields, *qf_output_fields;
   CeedQFunction       qf;
   CeedOperatorField  *op_input_fields, *op_output_fields;
@@ -162,6 +179,7 @@ static int CeedOperatorSetup_Ref(CeedOperator op) {
 
   // Allocate
   CeedCallBackend(CeedCalloc(num_input_fields + num_output_fields, &impl->e_vecs_full));
+  CeedCallBackend(CeedCalloc(num_input_fields, &impl->q_vecs_full_in));
 
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->skip_rstr_in));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->skip_rstr_out));
@@ -176,13 +194,71 @@ static int CeedOperatorSetup_Ref(CeedOperator op) {
   impl->num_inputs  = num_input_fields;
   impl->num_outputs = num_output_fields;
 
+  // Chunk size
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedOperatorGetChunkSize(op, &chunk_size));
+  {
+    CeedInt impl_chunk_size = chunk_size;
+
+    if (impl_chunk_size == -1) {
+      CeedSize elem_bytes = 0;
+
+      // Size chunks so the active input and output E-vectors fit in cache
+      for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+        bool                is_input = i < num_input_fields;
+        CeedInt             elem_size, num_comp;
+        CeedEvalMode        eval_mode;
+        CeedVector          vec;
+        CeedElemRestriction elem_rstr;
+        CeedOperatorField   op_field = is_input ? op_input_fields[i] : op_output_fields[i - num_input_fields];
+
+        CeedCallBackend(CeedQFunctionFieldGetEvalMode(is_input ? qf_input_fields[i] : qf_output_fields[i - num_input_fields], &eval_mode));
+        if (eval_mode == CEED_EVAL_WEIGHT) continue;
+        CeedCallBackend(CeedOperatorFieldGetVector(op_field, &vec));
+        if (!is_input || vec == CEED_VECTOR_ACTIVE) {
+          CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_field, &elem_rstr));
+          CeedCallBackend(CeedElemRestrictionGetElementSize(elem_rstr, &elem_size));
+          CeedCallBackend(CeedElemRestrictionGetNumComponents(elem_rstr, &num_comp));
+          CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
+          elem_bytes += (CeedSize)elem_size * num_comp * sizeof(CeedScalar);
+        }
+        CeedCallBackend(CeedVectorDestroy(&vec));
+      }
+      impl_chunk_size = elem_bytes > 0 ? CeedIntMax(1, (CeedInt)(CEED_REF_CHUNK_BYTES / elem_bytes)) : num_elem;
+    }
+    impl->chunk_size = (impl_chunk_size <= 0 || impl_chunk_size > num_elem) ? num_elem : impl_chunk_size;
+  }
+
   // Set up infield and outfield e_vecs and q_vecs
   // Infields
-  CeedCallBackend(CeedOperatorSetupFields_Ref(qf, op, true, impl->skip_rstr_in, NULL, NULL, impl->e_vecs_full, impl->e_vecs_in, impl->q_vecs_in, 0,
-                                              num_input_fields, Q));
+  CeedCallBackend(CeedOperatorSetupFields_Ref(qf, op, true, impl->skip_rstr_in, NULL, NULL, impl->is_elem_shared_in, impl->e_vecs_full,
+                                              impl->e_vecs_in, impl->q_vecs_in, 0, num_input_fields, Q,
+                                              impl->chunk_size < num_elem ? impl->chunk_size : 0));
   // Outfields
-  CeedCallBackend(CeedOperatorSetupFields_Ref(qf, op, false, impl->skip_rstr_out, impl->e_data_out_indices, impl->apply_add_basis_out,
-                                              impl->e_vecs_full, impl->e_vecs_out, impl->q_vecs_out, num_input_fields, num_output_fields, Q));
+  CeedCallBackend(CeedOperatorSetupFields_Ref(qf, op, false, impl->skip_rstr_out, impl->e_data_out_indices, impl->apply_add_basis_out, NULL,
+                                              impl->e_vecs_full, impl->e_vecs_out, impl->q_vecs_out, num_input_fields, num_output_fields, Q,
+                                              impl->chunk_size < num_elem ? impl->chunk_size : 0));
+
+  // Full Q-vectors for passive inputs with basis action, unless a chunk size asks to bound the working set
+  for (CeedInt i = 0; i < num_input_fields && chunk_size == 0; i++) {
+    bool         is_passive;
+    CeedEvalMode eval_mode;
+    CeedVector   vec;
+
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    is_passive = vec != CEED_VECTOR_ACTIVE && !impl->is_elem_shared_in[i];
+    CeedCallBackend(CeedVectorDestroy(&vec));
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    if (is_passive && eval_mode != CEED_EVAL_NONE && eval_mode != CEED_EVAL_WEIGHT) {
+      Ceed    ceed;
+      CeedInt size;
+
+      CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+      CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
+      CeedCallBackend(CeedVectorCreate(ceed, (CeedSize)num_elem * Q * size, &impl->q_vecs_full_in[i]));
+      CeedCallBackend(CeedDestroy(&ceed));
+    }
+  }
 
   // Identity QFunctions
   if (impl->is_identity_qf) {
@@ -229,19 +305,55 @@ static inline int CeedOperatorSetupInputs_Ref(CeedInt num_input_fields, CeedQFun
     // Restrict and Evec
     if (eval_mode == CEED_EVAL_WEIGHT) {  // Skip
     } else {
+      bool is_updated;
+
       // Restrict
       CeedCallBackend(CeedVectorGetState(vec, &state));
+      is_updated = state != impl->input_states[i] || vec == in_vec;
       // Skip restriction if input is unchanged
-      if ((state != impl->input_states[i] || vec == in_vec) && !impl->skip_rstr_in[i]) {
+      if (is_updated && !impl->skip_rstr_in[i]) {
         CeedElemRestriction elem_rstr;
 
         CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_rstr));
-        CeedCallBackend(CeedElemRestrictionApply(elem_rstr, CEED_NOTRANSPOSE, vec, impl->e_vecs_full[i], request));
+        if (impl->is_elem_shared_in[i]) {
+          // Inputs shared by all elements only restrict the first element
+          CeedCallBackend(CeedElemRestrictionApplyRange(elem_rstr, 0, 1, CEED_NOTRANSPOSE, vec, impl->e_vecs_full[i], request));
+        } else {
+          CeedCallBackend(CeedElemRestrictionApply(elem_rstr, CEED_NOTRANSPOSE, vec, impl->e_vecs_full[i], request));
+        }
         CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
       }
       impl->input_states[i] = state;
       // Get evec
       CeedCallBackend(CeedVectorGetArrayRead(impl->e_vecs_full[i], CEED_MEM_HOST, (const CeedScalar **)&e_data_full[i]));
+      // Passive basis action, skipped if input is unchanged
+      if (is_updated && impl->q_vecs_full_in && impl->q_vecs_full_in[i]) {
+        CeedInt             num_elem, elem_size, num_comp, size, Q;
+        CeedScalar         *q_data_full;
+        CeedElemRestriction elem_rstr;
+        CeedBasis           basis;
+
+        CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_rstr));
+        CeedCallBackend(CeedElemRestrictionGetNumElements(elem_rstr, &num_elem));
+        CeedCallBackend(CeedElemRestrictionGetElementSize(elem_rstr, &elem_size));
+        CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
+        CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[i], &basis));
+        CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
+        CeedCallBackend(CeedBasisGetNumQuadraturePoints(basis, &Q));
+        CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
+        CeedCallBackend(CeedVectorGetArrayWrite(impl->q_vecs_full_in[i], CEED_MEM_HOST, &q_data_full));
+        for (CeedInt e = 0; e < num_elem; e++) {
+          CeedCallBackend(
+              CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * elem_size * num_comp]));
+          CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &q_data_full[(CeedSize)e * Q * size]));
+          CeedCallBackend(CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, eval_mode, impl->e_vecs_in[i], impl->q_vecs_in[i]));
+        }
+        CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_full_in[i], &q_data_full));
+        CeedCallBackend(CeedBasisDestroy(&basis));
+      }
+      if (impl->q_vecs_full_in && impl->q_vecs_full_in[i] && !impl->q_data_full_in[i]) {
+        CeedCallBackend(CeedVectorGetArrayRead(impl->q_vecs_full_in[i], CEED_MEM_HOST, (const CeedScalar **)&impl->q_data_full_in[i]));
+      }
     }
     if (!is_active) CeedCallBackend(CeedVectorDestroy(&vec));
   }
@@ -251,25 +363,24 @@ static inline int CeedOperatorSetupInputs_Ref(CeedInt num_input_fields, CeedQFun
 //------------------------------------------------------------------------------
 // Input Basis Action
 //------------------------------------------------------------------------------
-static inline int CeedOperatorInputBasis_Ref(CeedInt e, CeedInt Q, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-                                             CeedInt num_input_fields, const bool skip_active, CeedScalar *e_data_full[2 * CEED_FIELD_MAX],
-                                             CeedOperator_Ref *impl) {
+static inline int CeedOperatorInputBasis_Ref(CeedInt e, CeedInt e_start, CeedInt Q, CeedQFunctionField *qf_input_fields,
+                                             CeedOperatorField *op_input_fields, CeedInt num_input_fields, const bool skip_active,
+                                             CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedOperator_Ref *impl) {
   for (CeedInt i = 0; i < num_input_fields; i++) {
-    CeedInt             elem_size, size, num_comp;
+    bool                is_active;
+    CeedInt             e_field, elem_size, size, num_comp;
     CeedEvalMode        eval_mode;
+    CeedVector          vec;
     CeedElemRestriction elem_rstr;
     CeedBasis           basis;
 
     // Skip active input
-    if (skip_active) {
-      bool       is_active;
-      CeedVector vec;
-
-      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-      is_active = vec == CEED_VECTOR_ACTIVE;
-      CeedCallBackend(CeedVectorDestroy(&vec));
-      if (is_active) continue;
-    }
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    is_active = vec == CEED_VECTOR_ACTIVE;
+    CeedCallBackend(CeedVectorDestroy(&vec));
+    if (skip_active && is_active) continue;
+    // Active E-vectors only hold the current chunk of elements, and E-vectors of inputs shared by all elements only hold one element
+    e_field = is_active ? e - e_start : (impl->is_elem_shared_in[i] ? 0 : e);
     // Get elem_size, eval_mode, size
     CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_rstr));
     CeedCallBackend(CeedElemRestrictionGetElementSize(elem_rstr, &elem_size));
@@ -279,15 +390,21 @@ static inline int CeedOperatorInputBasis_Ref(CeedInt e, CeedInt Q, CeedQFunction
     // Basis action
     switch (eval_mode) {
       case CEED_EVAL_NONE:
-        CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * Q * size]));
+        CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e_field * Q * size]));
         break;
       case CEED_EVAL_INTERP:
       case CEED_EVAL_GRAD:
       case CEED_EVAL_DIV:
       case CEED_EVAL_CURL:
+        // Passive basis action computed in CeedOperatorSetupInputs_Ref
+        if (!is_active && impl->q_data_full_in[i]) {
+          CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &impl->q_data_full_in[i][(CeedSize)e * Q * size]));
+          break;
+        }
         CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[i], &basis));
         CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * elem_size * num_comp]));
+        CeedCallBackend(
+            CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e_field * elem_size * num_comp]));
         CeedCallBackend(CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, eval_mode, impl->e_vecs_in[i], impl->q_vecs_in[i]));
         CeedCallBackend(CeedBasisDestroy(&basis));
         break;
@@ -368,49 +485,87 @@ static inline int CeedOperatorRestoreInputs_Ref(CeedInt num_input_fields, CeedQF
     } else {
       CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_full[i], (const CeedScalar **)&e_data_full[i]));
     }
+    if (impl->q_data_full_in[i]) {
+      CeedCallBackend(CeedVectorRestoreArrayRead(impl->q_vecs_full_in[i], (const CeedScalar **)&impl->q_data_full_in[i]));
+    }
   }
   return CEED_ERROR_SUCCESS;
 }
 
 //------------------------------------------------------------------------------
-// Operator Apply
+// Get the Next Range of Elements Selected by the Element Mask
 //------------------------------------------------------------------------------
-static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
-  CeedInt             Q, num_elem, num_input_fields, num_output_fields, size;
-  CeedEvalMode        eval_mode;
-  CeedScalar         *e_data_full[2 * CEED_FIELD_MAX] = {NULL};
-  CeedQFunctionField *qf_input_fields, *qf_output_fields;
-  CeedQFunction       qf;
-  CeedOperatorField  *op_input_fields, *op_output_fields;
-  CeedOperator_Ref   *impl;
-
-  // Setup
-  CeedCallBackend(CeedOperatorSetup_Ref(op));
+// Advances e_start to the next selected element and sets e_stop to the end of its run of selected elements, at most one chunk long.
+// An empty range, e_start == e_stop, marks the end of the elements.
+static inline void CeedOperatorGetNextRange_Ref(CeedInt num_elem, CeedInt chunk_size, const bool *elem_mask, CeedInt *e_start, CeedInt *e_stop) {
+  if (elem_mask) {
+    while (*e_start < num_elem && !elem_mask[*e_start]) (*e_start)++;
+  }
+  *e_stop = CeedIntMin(*e_start + chunk_size, num_elem);
+  if (elem_mask) {
+    for (CeedInt e = *e_start; e < *e_stop; e++) {
+      if (!elem_mask[e]) {
+        *e_stop = e;
+        break;
+      }
+    }
+  }
+}
 
-  CeedCallBackend(CeedOperatorGetData(op, &impl));
-  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+//------------------------------------------------------------------------------
+// Restrict Active Inputs for a Chunk of Elements
+//------------------------------------------------------------------------------
+static inline int CeedOperatorSetupActiveInputs_Ref(CeedInt e_start, CeedInt e_stop, CeedInt num_input_fields, CeedQFunctionField *qf_input_fields,
+                                                    CeedOperatorField *op_input_fields, CeedVector in_vec,
+                                                    CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedOperator_Ref *impl, CeedRequest *request) {
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedEvalMode eval_mode;
+    CeedVector   vec;
 
-  // Restriction only operator
-  if (impl->is_identity_rstr_op) {
-    CeedElemRestriction elem_rstr;
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    if (vec == CEED_VECTOR_ACTIVE && eval_mode != CEED_EVAL_WEIGHT) {
+      if (!impl->skip_rstr_in[i]) {
+        CeedElemRestriction elem_rstr;
 
-    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[0], &elem_rstr));
-    CeedCallBackend(CeedElemRestrictionApply(elem_rstr, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_full[0], request));
-    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
-    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[0], &elem_rstr));
-    CeedCallBackend(CeedElemRestrictionApply(elem_rstr, CEED_TRANSPOSE, impl->e_vecs_full[0], out_vec, request));
-    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
-    return CEED_ERROR_SUCCESS;
+        CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_rstr));
+        CeedCallBackend(CeedElemRestrictionApplyRange(elem_rstr, e_start, e_stop, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_full[i], request));
+        CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
+      }
+      CeedCallBackend(CeedVectorGetArrayRead(impl->e_vecs_full[i], CEED_MEM_HOST, (const CeedScalar **)&e_data_full[i]));
+    }
+    CeedCallBackend(CeedVectorDestroy(&vec));
   }
+  return CEED_ERROR_SUCCESS;
+}
 
-  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
-  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
-  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
-  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+//------------------------------------------------------------------------------
+// Restore Active Input Arrays for a Chunk of Elements
+//------------------------------------------------------------------------------
+static inline int CeedOperatorRestoreActiveInputs_Ref(CeedInt num_input_fields, CeedQFunctionField *qf_input_fields,
+                                                      CeedOperatorField *op_input_fields, CeedScalar *e_data_full[2 * CEED_FIELD_MAX],
+                                                      CeedOperator_Ref *impl) {
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedEvalMode eval_mode;
+    CeedVector   vec;
 
-  // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, in_vec, false, e_data_full, impl, request));
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    if (vec == CEED_VECTOR_ACTIVE && eval_mode != CEED_EVAL_WEIGHT) {
+      CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_full[i], (const CeedScalar **)&e_data_full[i]));
+    }
+    CeedCallBackend(CeedVectorDestroy(&vec));
+  }
+  return CEED_ERROR_SUCCESS;
+}
 
+//------------------------------------------------------------------------------
+// Apply Operator on a Chunk of Elements into the Output E-vectors
+//------------------------------------------------------------------------------
+static inline int CeedOperatorApplyElements_Ref(CeedOperator op, CeedInt e_start, CeedInt e_stop, CeedInt Q, CeedQFunction qf,
+                                                CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields, CeedInt num_input_fields,
+                                                CeedQFunctionField *qf_output_fields, CeedOperatorField *op_output_fields, CeedInt num_output_fields,
+                                                CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedOperator_Ref *impl) {
   // Output Evecs
   for (CeedInt i = num_output_fields - 1; i >= 0; i--) {
     if (impl->skip_rstr_out[i]) {
@@ -421,19 +576,23 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec, CeedVect
   }
 
   // Loop through elements
-  for (CeedInt e = 0; e < num_elem; e++) {
+  for (CeedInt e = e_start; e < e_stop; e++) {
     // Output pointers
     for (CeedInt i = 0; i < num_output_fields; i++) {
+      CeedEvalMode eval_mode;
+
       CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
       if (eval_mode == CEED_EVAL_NONE) {
+        CeedInt size;
+
         CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[i], &size));
-        CeedCallBackend(
-            CeedVectorSetArray(impl->q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i + num_input_fields][(CeedSize)e * Q * size]));
+        CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER,
+                                           &e_data_full[i + num_input_fields][(CeedSize)(e - e_start) * Q * size]));
       }
     }
 
     // Input basis apply
-    CeedCallBackend(CeedOperatorInputBasis_Ref(e, Q, qf_input_fields, op_input_fields, num_input_fields, false, e_data_full, impl));
+    CeedCallBackend(CeedOperatorInputBasis_Ref(e, e_start, Q, qf_input_fields, op_input_fields, num_input_fields, false, e_data_full, impl));
 
     // Q function
     if (!impl->is_identity_qf) {
@@ -441,11 +600,18 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec, CeedVect
     }
 
     // Output basis apply
-    CeedCallBackend(CeedOperatorOutputBasis_Ref(e, Q, qf_output_fields, op_output_fields, num_input_fields, num_output_fields,
+    CeedCallBackend(CeedOperatorOutputBasis_Ref(e - e_start, Q, qf_output_fields, op_output_fields, num_input_fields, num_output_fields,
                                                 impl->apply_add_basis_out, op, e_data_full, impl));
   }
+  return CEED_ERROR_SUCCESS;
+}
 
-  // Output restriction
+//------------------------------------------------------------------------------
+// Restrict Outputs for a Chunk of Elements
+//------------------------------------------------------------------------------
+static inline int CeedOperatorRestrictOutputs_Ref(CeedInt e_start, CeedInt e_stop, CeedScalar alpha, CeedOperatorField *op_output_fields,
+                                                  CeedInt num_input_fields, CeedInt num_output_fields, CeedVector out_vec,
+                                                  CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedOperator_Ref *impl, CeedRequest *request) {
   for (CeedInt i = 0; i < num_output_fields; i++) {
     bool                is_active;
     CeedVector          vec;
@@ -459,19 +625,595 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec, CeedVect
     // Active
     is_active = vec == CEED_VECTOR_ACTIVE;
     if (is_active) vec = out_vec;
-    // Restrict
+    // Restrict, scaling active output
     CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[i], &elem_rstr));
-    CeedCallBackend(CeedElemRestrictionApply(elem_rstr, CEED_TRANSPOSE, impl->e_vecs_full[i + impl->num_inputs], vec, request));
+    CeedCallBackend(CeedElemRestrictionApplyRangeScaled(elem_rstr, e_start, e_stop, is_active ? alpha : 1.0, impl->e_vecs_full[i + impl->num_inputs],
+                                                        vec, request));
     if (!is_active) CeedCallBackend(CeedVectorDestroy(&vec));
     CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
   }
+  return CEED_ERROR_SUCCESS;
+}
 
-  // Restore input arrays
-  CeedCallBackend(CeedOperatorRestoreInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, false, e_data_full, impl));
+//------------------------------------------------------------------------------
+// Operator Apply to One or More Vectors
+//   Passive inputs are restricted once and each chunk of elements is applied to every vector before the next chunk
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddScaledMulti_Ref(CeedOperator op, CeedScalar alpha, CeedInt num_vecs, CeedVector *in_vecs, CeedVector *out_vecs,
+                                               CeedRequest *request) {
+  CeedInt             Q, num_elem, num_input_fields, num_output_fields;
+  CeedScalar         *e_data_full[2 * CEED_FIELD_MAX] = {NULL};
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  CeedQFunction       qf;
+  CeedOperatorField  *op_input_fields, *op_output_fields;
+  CeedOperator_Ref   *impl;
+
+  // Setup
+  CeedCallBackend(CeedOperatorSetup_Ref(op));
+  if (num_vecs == 0) return CEED_ERROR_SUCCESS;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+
+  // Restriction only operator
+  if (impl->is_identity_rstr_op) {
+    CeedElemRestriction elem_rstr_in, elem_rstr_out;
+
+    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[0], &elem_rstr_in));
+    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[0], &elem_rstr_out));
+    for (CeedInt e_start = 0, e_stop; e_start < num_elem; e_start = e_stop) {
+      CeedOperatorGetNextRange_Ref(num_elem, impl->chunk_size, impl->elem_mask, &e_start, &e_stop);
+      if (e_start == e_stop) break;
+      for (CeedInt v = 0; v < num_vecs; v++) {
+        CeedCallBackend(CeedElemRestrictionApplyRange(elem_rstr_in, e_start, e_stop, CEED_NOTRANSPOSE, in_vecs[v], impl->e_vecs_full[0], request));
+        CeedCallBackend(CeedElemRestrictionApplyRangeScaled(elem_rstr_out, e_start, e_stop, alpha, impl->e_vecs_full[0], out_vecs[v], request));
+      }
+    }
+    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr_in));
+    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr_out));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+
+  // Passive input Evecs and Restriction
+  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, in_vecs[0], true, e_data_full, impl, request));
+
+  // Loop through chunks of elements selected by the element mask
+  for (CeedInt e_start = 0, e_stop; e_start < num_elem; e_start = e_stop) {
+    CeedOperatorGetNextRange_Ref(num_elem, impl->chunk_size, impl->elem_mask, &e_start, &e_stop);
+    if (e_start == e_stop) break;
+
+    for (CeedInt v = 0; v < num_vecs; v++) {
+      // Active input Evecs and Restriction
+      CeedCallBackend(CeedOperatorSetupActiveInputs_Ref(e_start, e_stop, num_input_fields, qf_input_fields, op_input_fields, in_vecs[v], e_data_full,
+                                                        impl, request));
+
+      // Apply elements
+      CeedCallBackend(CeedOperatorApplyElements_Ref(op, e_start, e_stop, Q, qf, qf_input_fields, op_input_fields, num_input_fields, qf_output_fields,
+                                                    op_output_fields, num_output_fields, e_data_full, impl));
+
+      // Output restriction
+      CeedCallBackend(CeedOperatorRestrictOutputs_Ref(e_start, e_stop, alpha, op_output_fields, num_input_fields, num_output_fields, out_vecs[v],
+                                                      e_data_full, impl, request));
+
+      // Restore active input arrays
+      CeedCallBackend(CeedOperatorRestoreActiveInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, e_data_full, impl));
+    }
+  }
+
+  // Restore passive input arrays
+  CeedCallBackend(CeedOperatorRestoreInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, true, e_data_full, impl));
   CeedCallBackend(CeedQFunctionDestroy(&qf));
   return CEED_ERROR_SUCCESS;
 }
 
+static int CeedOperatorApplyAddScaled_Ref(CeedOperator op, CeedScalar alpha, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  return CeedOperatorApplyAddScaledMulti_Ref(op, alpha, 1, &in_vec, &out_vec, request);
+}
+
+static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  return CeedOperatorApplyAddScaledMulti_Ref(op, 1.0, 1, &in_vec, &out_vec, request);
+}
+
+static int CeedOperatorApplyAddMulti_Ref(CeedOperator op, CeedInt num_vecs, CeedVector *in_vecs, CeedVector *out_vecs, CeedRequest *request) {
+  return CeedOperatorApplyAddScaledMulti_Ref(op, 1.0, num_vecs, in_vecs, out_vecs, request);
+}
+
+//------------------------------------------------------------------------------
+// Get active fields of a sub-operator that can be fused with others
+//------------------------------------------------------------------------------
+static int CeedOperatorGetFusableFields_Ref(CeedOperator op, bool *is_fusable, CeedInt *active_in, CeedInt *active_out) {
+  bool                is_at_points, is_identity_qf;
+  CeedInt             num_elem, num_input_fields, num_output_fields, num_active_in = 0;
+  CeedEvalMode        eval_mode;
+  CeedVector          vec;
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  CeedQFunction       qf;
+  CeedOperatorField  *op_input_fields, *op_output_fields;
+  CeedOperator_Ref   *impl;
+
+  *is_fusable = false;
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorIsAtPoints(op, &is_at_points));
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  if (is_at_points || impl->elem_mask || num_elem == 0 || num_output_fields != 1) return CEED_ERROR_SUCCESS;
+
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedQFunctionIsIdentity(qf, &is_identity_qf));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+
+  // Single active input
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    if (vec == CEED_VECTOR_ACTIVE) {
+      *active_in = i;
+      num_active_in++;
+    }
+    CeedCallBackend(CeedVectorDestroy(&vec));
+  }
+
+  // Single active output with basis action
+  CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[0], &vec));
+  CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[0], &eval_mode));
+  *active_out = 0;
+  *is_fusable = !is_identity_qf && num_active_in == 1 && vec == CEED_VECTOR_ACTIVE && eval_mode != CEED_EVAL_NONE;
+  CeedCallBackend(CeedVectorDestroy(&vec));
+  CeedCallBackend(CeedQFunctionDestroy(&qf));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Check if two sub-operators share active restrictions, bases, and evaluation modes
+//------------------------------------------------------------------------------
+static int CeedOperatorFieldsMatch_Ref(CeedOperator op_a, CeedInt field_a, CeedOperator op_b, CeedInt field_b, bool is_input, bool *is_match) {
+  CeedEvalMode        eval_mode_a, eval_mode_b;
+  CeedElemRestriction elem_rstr_a, elem_rstr_b;
+  CeedBasis           basis_a, basis_b;
+  CeedOperatorField  *op_fields_a, *op_fields_b;
+  CeedQFunctionField *qf_fields_a, *qf_fields_b;
+  CeedQFunction       qf_a, qf_b;
+
+  CeedCallBackend(CeedOperatorGetQFunction(op_a, &qf_a));
+  CeedCallBackend(CeedOperatorGetQFunction(op_b, &qf_b));
+  if (is_input) {
+    CeedCallBackend(CeedOperatorGetFields(op_a, NULL, &op_fields_a, NULL, NULL));
+    CeedCallBackend(CeedOperatorGetFields(op_b, NULL, &op_fields_b, NULL, NULL));
+    CeedCallBackend(CeedQFunctionGetFields(qf_a, NULL, &qf_fields_a, NULL, NULL));
+    CeedCallBackend(CeedQFunctionGetFields(qf_b, NULL, &qf_fields_b, NULL, NULL));
+  } else {
+    CeedCallBackend(CeedOperatorGetFields(op_a, NULL, NULL, NULL, &op_fields_a));
+    CeedCallBackend(CeedOperatorGetFields(op_b, NULL, NULL, NULL, &op_fields_b));
+    CeedCallBackend(CeedQFunctionGetFields(qf_a, NULL, NULL, NULL, &qf_fields_a));
+    CeedCallBackend(CeedQFunctionGetFields(qf_b, NULL, NULL, NULL, &qf_fields_b));
+  }
+  CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_fields_a[field_a], &eval_mode_a));
+  CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_fields_b[field_b], &eval_mode_b));
+  CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_fields_a[field_a], &elem_rstr_a));
+  CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_fields_b[field_b], &elem_rstr_b));
+  CeedCallBackend(CeedOperatorFieldGetBasis(op_fields_a[field_a], &basis_a));
+  CeedCallBackend(CeedOperatorFieldGetBasis(op_fields_b[field_b], &basis_b));
+  *is_match = eval_mode_a == eval_mode_b && elem_rstr_a == elem_rstr_b && basis_a == basis_b;
+  CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr_a));
+  CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr_b));
+  CeedCallBackend(CeedBasisDestroy(&basis_a));
+  CeedCallBackend(CeedBasisDestroy(&basis_b));
+  CeedCallBackend(CeedQFunctionDestroy(&qf_a));
+  CeedCallBackend(CeedQFunctionDestroy(&qf_b));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Fused Apply for sub-operators sharing active restrictions and bases
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddFused_Ref(CeedInt num_fused, CeedOperator *sub_operators, CeedInt *active_in, CeedInt *active_out, CeedScalar alpha,
+                                         CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  CeedInt             Q, num_elem, num_input_fields, num_output_fields;
+  CeedScalar        **e_data_full;
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  CeedQFunction      *qfs;
+  CeedOperatorField  *op_input_fields, *op_output_fields;
+  CeedElemRestriction elem_rstr_in, elem_rstr_out;
+  CeedOperator        op = sub_operators[0];
+  CeedOperator_Ref   *impl;
+
+  CeedCallBackend(CeedCalloc(num_fused * 2 * CEED_FIELD_MAX, &e_data_full));
+  CeedCallBackend(CeedCalloc(num_fused, &qfs));
+
+  // Setup and passive inputs for each sub-operator
+  for (CeedInt s = 0; s < num_fused; s++) {
+    CeedOperator_Ref *sub_impl;
+
+    CeedCallBackend(CeedOperatorSetup_Ref(sub_operators[s]));
+    CeedCallBackend(CeedOperatorGetData(sub_operators[s], &sub_impl));
+    CeedCallBackend(CeedOperatorGetQFunction(sub_operators[s], &qfs[s]));
+    CeedCallBackend(CeedOperatorGetFields(sub_operators[s], &num_input_fields, &op_input_fields, NULL, NULL));
+    CeedCallBackend(CeedQFunctionGetFields(qfs[s], NULL, &qf_input_fields, NULL, NULL));
+    CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, in_vec, true,
+                                                &e_data_full[s * 2 * CEED_FIELD_MAX], sub_impl, request));
+  }
+
+  // Active fields of the first sub-operator are shared by the group
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  CeedCallBackend(CeedQFunctionGetFields(qfs[0], NULL, &qf_input_fields, NULL, &qf_output_fields));
+  CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[active_in[0]], &elem_rstr_in));
+  CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[active_out[0]], &elem_rstr_out));
+
+  // Loop through chunks of elements
+  for (CeedInt e_start = 0; e_start < num_elem; e_start += impl->chunk_size) {
+    const CeedInt e_stop = CeedIntMin(e_start + impl->chunk_size, num_elem);
+    const CeedInt i_in   = active_in[0], i_out = active_out[0] + num_input_fields;
+
+    // Active input restriction, once for the group
+    CeedCallBackend(CeedElemRestrictionApplyRange(elem_rstr_in, e_start, e_stop, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_full[i_in], request));
+    CeedCallBackend(CeedVectorGetArrayRead(impl->e_vecs_full[i_in], CEED_MEM_HOST, (const CeedScalar **)&e_data_full[i_in]));
+    CeedCallBackend(CeedVectorGetArrayWrite(impl->e_vecs_full[i_out], CEED_MEM_HOST, &e_data_full[i_out]));
+
+    // Loop through elements
+    for (CeedInt e = e_start; e < e_stop; e++) {
+      // Input basis apply, including active input for the group
+      CeedCallBackend(CeedOperatorInputBasis_Ref(e, e_start, Q, qf_input_fields, op_input_fields, num_input_fields, false, e_data_full, impl));
+      CeedCallBackend(CeedQFunctionApply(qfs[0], Q, impl->q_vecs_in, impl->q_vecs_out));
+
+      // Remaining sub-operators share the active input and sum into the active output at quadrature points
+      for (CeedInt s = 1; s < num_fused; s++) {
+        CeedInt             sub_num_input_fields;
+        CeedVector          q_vecs_in[CEED_FIELD_MAX];
+        CeedQFunctionField *sub_qf_input_fields;
+        CeedOperatorField  *sub_op_input_fields;
+        CeedOperator_Ref   *sub_impl;
+
+        CeedCallBackend(CeedOperatorGetData(sub_operators[s], &sub_impl));
+        CeedCallBackend(CeedOperatorGetFields(sub_operators[s], &sub_num_input_fields, &sub_op_input_fields, NULL, NULL));
+        CeedCallBackend(CeedQFunctionGetFields(qfs[s], NULL, &sub_qf_input_fields, NULL, NULL));
+        CeedCallBackend(CeedOperatorInputBasis_Ref(e, e_start, Q, sub_qf_input_fields, sub_op_input_fields, sub_num_input_fields, true,
+                                                   &e_data_full[s * 2 * CEED_FIELD_MAX], sub_impl));
+        for (CeedInt i = 0; i < sub_num_input_fields; i++) q_vecs_in[i] = sub_impl->q_vecs_in[i];
+        q_vecs_in[active_in[s]] = impl->q_vecs_in[i_in];
+        CeedCallBackend(CeedQFunctionApply(qfs[s], Q, q_vecs_in, sub_impl->q_vecs_out));
+        CeedCallBackend(CeedVectorAXPY(impl->q_vecs_out[active_out[0]], 1.0, sub_impl->q_vecs_out[active_out[s]]));
+      }
+
+      // Output basis apply, once for the group
+      CeedCallBackend(CeedOperatorOutputBasis_Ref(e - e_start, Q, qf_output_fields, op_output_fields, num_input_fields, num_output_fields,
+                                                  impl->apply_add_basis_out, op, e_data_full, impl));
+    }
+
+    // Active output restriction, once for the group
+    CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_full[i_out], &e_data_full[i_out]));
+    CeedCallBackend(CeedElemRestrictionApplyRangeScaled(elem_rstr_out, e_start, e_stop, alpha, impl->e_vecs_full[i_out], out_vec, request));
+    CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_full[i_in], (const CeedScalar **)&e_data_full[i_in]));
+  }
+
+  // Restore passive input arrays
+  for (CeedInt s = 0; s < num_fused; s++) {
+    CeedOperator_Ref *sub_impl;
+
+    CeedCallBackend(CeedOperatorGetData(sub_operators[s], &sub_impl));
+    CeedCallBackend(CeedOperatorGetFields(sub_operators[s], &num_input_fields, &op_input_fields, NULL, NULL));
+    CeedCallBackend(CeedQFunctionGetFields(qfs[s], NULL, &qf_input_fields, NULL, NULL));
+    CeedCallBackend(CeedOperatorRestoreInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, true, &e_data_full[s * 2 * CEED_FIELD_MAX],
+                                                  sub_impl));
+    CeedCallBackend(CeedQFunctionDestroy(&qfs[s]));
+  }
+  CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr_in));
+  CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr_out));
+  CeedCallBackend(CeedFree(&e_data_full));
+  CeedCallBackend(CeedFree(&qfs));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Setup, grouping sub-operators that can share an element loop
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupComposite_Ref(CeedOperator op, CeedOperatorComposite_Ref *impl) {
+  bool          is_fusable[CEED_COMPOSITE_MAX];
+  Ceed          ceed;
+  CeedInt       num_sub;
+  CeedOperator *sub_operators;
+
+  // Groups are kept until sub-operators are added
+  CeedCallBackend(CeedCompositeOperatorGetNumSub(op, &num_sub));
+  if (impl->num_sub == num_sub) return CEED_ERROR_SUCCESS;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedCompositeOperatorGetSubList(op, &sub_operators));
+
+  // Only sub-operators created by this backend can be fused
+  for (CeedInt i = 0; i < num_sub; i++) {
+    Ceed ceed_sub;
+
+    CeedCallBackend(CeedOperatorGetCeed(sub_operators[i], &ceed_sub));
+    if (ceed_sub == ceed) {
+      CeedCallBackend(CeedOperatorGetFusableFields_Ref(sub_operators[i], &is_fusable[i], &impl->active_in[i], &impl->active_out[i]));
+    } else {
+      is_fusable[i] = false;
+    }
+    CeedCallBackend(CeedDestroy(&ceed_sub));
+    impl->group[i] = i;
+  }
+  CeedCallBackend(CeedDestroy(&ceed));
+
+  // Group sub-operators with identical active restrictions, bases, and evaluation modes
+  for (CeedInt i = 0; i < num_sub; i++) {
+    if (!is_fusable[i] || impl->group[i] != i) continue;
+    for (CeedInt j = i + 1; j < num_sub; j++) {
+      bool is_match_in = false, is_match_out = false, is_repeated = false;
+
+      if (!is_fusable[j] || impl->group[j] != j) continue;
+      // The same sub-operator cannot share an element loop with itself, as its work vectors would alias
+      for (CeedInt k = i; k < j; k++) is_repeated = is_repeated || (impl->group[k] == i && sub_operators[k] == sub_operators[j]);
+      if (is_repeated) continue;
+      CeedCallBackend(
+          CeedOperatorFieldsMatch_Ref(sub_operators[i], impl->active_in[i], sub_operators[j], impl->active_in[j], true, &is_match_in));
+      if (is_match_in) {
+        CeedCallBackend(
+            CeedOperatorFieldsMatch_Ref(sub_operators[i], impl->active_out[i], sub_operators[j], impl->active_out[j], false, &is_match_out));
+      }
+      if (is_match_in && is_match_out) impl->group[j] = i;
+    }
+  }
+  impl->num_sub = num_sub;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddScaledComposite_Ref(CeedOperator op, CeedScalar alpha, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  CeedInt                    num_sub;
+  CeedOperator              *sub_operators;
+  CeedOperatorComposite_Ref *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorSetupComposite_Ref(op, impl));
+  CeedCallBackend(CeedCompositeOperatorGetNumSub(op, &num_sub));
+  CeedCallBackend(CeedCompositeOperatorGetSubList(op, &sub_operators));
+
+  // Apply each group in a single pass, and remaining sub-operators individually
+  for (CeedInt i = 0; i < num_sub; i++) {
+    bool         has_elem_mask = false;
+    CeedInt      num_fused     = 0, fused_active_in[CEED_COMPOSITE_MAX], fused_active_out[CEED_COMPOSITE_MAX];
+    CeedOperator fused_operators[CEED_COMPOSITE_MAX];
+
+    if (impl->group[i] != i) continue;
+    for (CeedInt j = i; j < num_sub; j++) {
+      if (impl->group[j] != i) continue;
+      fused_operators[num_fused]  = sub_operators[j];
+      fused_active_in[num_fused]  = impl->active_in[j];
+      fused_active_out[num_fused] = impl->active_out[j];
+      num_fused++;
+    }
+    // Element masks set after grouping apply each sub-operator of the group separately
+    for (CeedInt j = 0; j < num_fused && num_fused > 1; j++) {
+      CeedOperator_Ref *sub_impl;
+
+      CeedCallBackend(CeedOperatorGetData(fused_operators[j], &sub_impl));
+      has_elem_mask = has_elem_mask || sub_impl->elem_mask;
+    }
+    if (num_fused > 1 && !has_elem_mask) {
+      CeedCallBackend(
+          CeedOperatorApplyAddFused_Ref(num_fused, fused_operators, fused_active_in, fused_active_out, alpha, in_vec, out_vec, request));
+    } else {
+      for (CeedInt j = 0; j < num_fused; j++) CeedCallBackend(CeedOperatorApplyAddScaled(fused_operators[j], alpha, in_vec, out_vec, request));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+static int CeedOperatorApplyAddComposite_Ref(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  return CeedOperatorApplyAddScaledComposite_Ref(op, 1.0, in_vec, out_vec, request);
+}
+
+//------------------------------------------------------------------------------
+// Check if a restriction maps each E-vector entry to a distinct L-vector entry
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionIsInjective_Ref(CeedElemRestriction rstr, bool *is_injective) {
+  CeedSize            l_size;
+  CeedRestrictionType rstr_type;
+  const CeedScalar   *mult_array;
+  CeedVector          mult;
+
+  *is_injective = false;
+  CeedCallBackend(CeedElemRestrictionGetType(rstr, &rstr_type));
+  if (rstr_type != CEED_RESTRICTION_STANDARD && rstr_type != CEED_RESTRICTION_ORIENTED && rstr_type != CEED_RESTRICTION_STRIDED) {
+    return CEED_ERROR_SUCCESS;
+  }
+  CeedCallBackend(CeedElemRestrictionGetLVectorSize(rstr, &l_size));
+  CeedCallBackend(CeedElemRestrictionCreateVector(rstr, &mult, NULL));
+  CeedCallBackend(CeedElemRestrictionGetMultiplicity(rstr, mult));
+  CeedCallBackend(CeedVectorGetArrayRead(mult, CEED_MEM_HOST, &mult_array));
+  *is_injective = true;
+  for (CeedSize i = 0; i < l_size; i++) {
+    if (mult_array[i] > 1.0) {
+      *is_injective = false;
+      break;
+    }
+  }
+  CeedCallBackend(CeedVectorRestoreArrayRead(mult, &mult_array));
+  CeedCallBackend(CeedVectorDestroy(&mult));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Check if the sub-operators of a product operator can share intermediate E-vectors
+//------------------------------------------------------------------------------
+static int CeedOperatorProductSetup_Ref(CeedOperator op, CeedOperatorProduct_Ref *impl) {
+  bool                is_composite, is_at_points, is_shared = true;
+  Ceed                ceed;
+  CeedInt             num_elem_inner, num_elem_outer, num_input_fields, num_output_fields, num_active_in = 0;
+  CeedOperator       *sub_operators;
+  CeedOperatorField  *op_input_fields, *op_output_fields;
+  CeedElemRestriction rstr_mid;
+
+  impl->is_setup   = true;
+  impl->is_fusable = false;
+  CeedCallBackend(CeedCompositeOperatorGetSubList(op, &sub_operators));
+  if (sub_operators[0] == sub_operators[1]) return CEED_ERROR_SUCCESS;
+
+  // Only single sub-operators created by this backend can be fused
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  for (CeedInt i = 0; i < 2; i++) {
+    bool is_match;
+    Ceed ceed_sub;
+
+    CeedCallBackend(CeedOperatorGetCeed(sub_operators[i], &ceed_sub));
+    is_match = ceed_sub == ceed;
+    CeedCallBackend(CeedDestroy(&ceed_sub));
+    CeedCallBackend(CeedOperatorIsComposite(sub_operators[i], &is_composite));
+    CeedCallBackend(CeedOperatorIsAtPoints(sub_operators[i], &is_at_points));
+    if (!is_match || is_composite || is_at_points) {
+      CeedCallBackend(CeedDestroy(&ceed));
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+  CeedCallBackend(CeedDestroy(&ceed));
+  CeedCallBackend(CeedOperatorGetNumElements(sub_operators[0], &num_elem_inner));
+  CeedCallBackend(CeedOperatorGetNumElements(sub_operators[1], &num_elem_outer));
+  if (num_elem_inner != num_elem_outer || num_elem_inner == 0) return CEED_ERROR_SUCCESS;
+
+  // Inner operator has a single active output
+  CeedCallBackend(CeedOperatorGetFields(sub_operators[0], NULL, NULL, &num_output_fields, &op_output_fields));
+  if (num_output_fields != 1) return CEED_ERROR_SUCCESS;
+  {
+    CeedVector vec;
+
+    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[0], &vec));
+    if (vec != CEED_VECTOR_ACTIVE) {
+      CeedCallBackend(CeedVectorDestroy(&vec));
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+  CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[0], &rstr_mid));
+
+  // Outer operator active inputs use the same restriction
+  CeedCallBackend(CeedOperatorGetFields(sub_operators[1], &num_input_fields, &op_input_fields, NULL, NULL));
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedVector          vec;
+    CeedElemRestriction rstr;
+
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &rstr));
+    if (vec == CEED_VECTOR_ACTIVE) {
+      is_shared = is_shared && rstr == rstr_mid;
+      num_active_in++;
+    }
+    CeedCallBackend(CeedVectorDestroy(&vec));
+    CeedCallBackend(CeedElemRestrictionDestroy(&rstr));
+  }
+
+  // Skipping the restriction round trip requires a one-to-one restriction
+  if (is_shared && num_active_in > 0) CeedCallBackend(CeedElemRestrictionIsInjective_Ref(rstr_mid, &impl->is_fusable));
+  CeedCallBackend(CeedElemRestrictionDestroy(&rstr_mid));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Product Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddProduct_Ref(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  bool                     is_fusable;
+  CeedInt                  Q[2], num_elem, num_input_fields[2], num_output_fields[2];
+  CeedScalar              *e_data_full[2][2 * CEED_FIELD_MAX] = {{NULL}};
+  CeedQFunctionField      *qf_input_fields[2], *qf_output_fields[2];
+  CeedQFunction            qf[2];
+  CeedOperator            *sub_operators;
+  CeedOperatorField       *op_input_fields[2], *op_output_fields[2];
+  CeedOperator_Ref        *impl[2];
+  CeedOperatorProduct_Ref *product_impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &product_impl));
+  CeedCallBackend(CeedCompositeOperatorGetSubList(op, &sub_operators));
+  if (!product_impl->is_setup) CeedCallBackend(CeedOperatorProductSetup_Ref(op, product_impl));
+  is_fusable = product_impl->is_fusable;
+
+  // Element masks and restriction only operators use their own element loops
+  for (CeedInt k = 0; k < 2 && is_fusable; k++) {
+    CeedCallBackend(CeedOperatorSetup_Ref(sub_operators[k]));
+    CeedCallBackend(CeedOperatorGetData(sub_operators[k], &impl[k]));
+    if (impl[k]->elem_mask || impl[k]->is_identity_rstr_op) is_fusable = false;
+  }
+
+  // Fall back to intermediate L-vector
+  if (!is_fusable) {
+    CeedVector l_vec_mid;
+
+    CeedCallBackend(CeedOperatorProductGetIntermediateVector(op, &l_vec_mid));
+    CeedCallBackend(CeedOperatorApplyAdd(sub_operators[0], in_vec, l_vec_mid, request));
+    CeedCallBackend(CeedOperatorApplyAdd(sub_operators[1], l_vec_mid, out_vec, request));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  CeedCallBackend(CeedOperatorGetNumElements(sub_operators[0], &num_elem));
+  for (CeedInt k = 0; k < 2; k++) {
+    CeedCallBackend(CeedOperatorGetQFunction(sub_operators[k], &qf[k]));
+    CeedCallBackend(CeedOperatorGetNumQuadraturePoints(sub_operators[k], &Q[k]));
+    CeedCallBackend(CeedOperatorGetFields(sub_operators[k], &num_input_fields[k], &op_input_fields[k], &num_output_fields[k], &op_output_fields[k]));
+    CeedCallBackend(CeedQFunctionGetFields(qf[k], NULL, &qf_input_fields[k], NULL, &qf_output_fields[k]));
+  }
+  const CeedInt chunk_size = CeedIntMin(impl[0]->chunk_size, impl[1]->chunk_size);
+  CeedVector    e_vec_mid  = impl[0]->e_vecs_full[impl[0]->num_inputs];
+
+  // Passive input Evecs and Restriction
+  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields[0], qf_input_fields[0], op_input_fields[0], in_vec, true, e_data_full[0], impl[0],
+                                              request));
+  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields[1], qf_input_fields[1], op_input_fields[1], CEED_VECTOR_NONE, true, e_data_full[1],
+                                              impl[1], request));
+
+  // Loop through chunks of elements
+  for (CeedInt e_start = 0; e_start < num_elem; e_start += chunk_size) {
+    const CeedInt e_stop = CeedIntMin(e_start + chunk_size, num_elem);
+
+    // Inner operator, leaving its output in the intermediate E-vector
+    CeedCallBackend(CeedOperatorSetupActiveInputs_Ref(e_start, e_stop, num_input_fields[0], qf_input_fields[0], op_input_fields[0], in_vec,
+                                                      e_data_full[0], impl[0], request));
+    CeedCallBackend(CeedOperatorApplyElements_Ref(sub_operators[0], e_start, e_stop, Q[0], qf[0], qf_input_fields[0], op_input_fields[0],
+                                                  num_input_fields[0], qf_output_fields[0], op_output_fields[0], num_output_fields[0],
+                                                  e_data_full[0], impl[0]));
+    CeedCallBackend(CeedVectorRestoreArray(e_vec_mid, &e_data_full[0][num_input_fields[0]]));
+    CeedCallBackend(CeedOperatorRestoreActiveInputs_Ref(num_input_fields[0], qf_input_fields[0], op_input_fields[0], e_data_full[0], impl[0]));
+
+    // Outer operator, reading its active inputs from the intermediate E-vector
+    for (CeedInt i = 0; i < num_input_fields[1]; i++) {
+      CeedVector vec;
+
+      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[1][i], &vec));
+      if (vec == CEED_VECTOR_ACTIVE) {
+        CeedCallBackend(CeedVectorGetArrayRead(e_vec_mid, CEED_MEM_HOST, (const CeedScalar **)&e_data_full[1][i]));
+      }
+      CeedCallBackend(CeedVectorDestroy(&vec));
+    }
+    CeedCallBackend(CeedOperatorApplyElements_Ref(sub_operators[1], e_start, e_stop, Q[1], qf[1], qf_input_fields[1], op_input_fields[1],
+                                                  num_input_fields[1], qf_output_fields[1], op_output_fields[1], num_output_fields[1],
+                                                  e_data_full[1], impl[1]));
+    CeedCallBackend(CeedOperatorRestrictOutputs_Ref(e_start, e_stop, 1.0, op_output_fields[1], num_input_fields[1], num_output_fields[1], out_vec,
+                                                    e_data_full[1], impl[1], request));
+    for (CeedInt i = 0; i < num_input_fields[1]; i++) {
+      CeedVector vec;
+
+      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[1][i], &vec));
+      if (vec == CEED_VECTOR_ACTIVE) {
+        CeedCallBackend(CeedVectorRestoreArrayRead(e_vec_mid, (const CeedScalar **)&e_data_full[1][i]));
+      }
+      CeedCallBackend(CeedVectorDestroy(&vec));
+    }
+  }
+
+  // Restore passive input arrays
+  for (CeedInt k = 0; k < 2; k++) {
+    CeedCallBackend(CeedOperatorRestoreInputs_Ref(num_input_fields[k], qf_input_fields[k], op_input_fields[k], true, e_data_full[k], impl[k]));
+    CeedCallBackend(CeedQFunctionDestroy(&qf[k]));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Core code for assembling linear QFunction
 //------------------------------------------------------------------------------
@@ -515,7 +1257,6 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op, b
       // Check if active input
       if (vec == CEED_VECTOR_ACTIVE) {
         CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &field_size));
-        CeedCallBackend(CeedVectorSetValue(impl->q_vecs_in[i], 0.0));
         qf_size_in += field_size;
       }
       CeedCallBackend(CeedVectorDestroy(&vec));
@@ -524,6 +1265,15 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op, b
     impl->qf_size_in = qf_size_in;
   }
 
+  // Clear active input Q-vectors, which may hold data from an application of the operator since the last assembly
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedVector vec;
+
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    if (vec == CEED_VECTOR_ACTIVE) CeedCallBackend(CeedVectorSetValue(impl->q_vecs_in[i], 0.0));
+    CeedCallBackend(CeedVectorDestroy(&vec));
+  }
+
   // Count number of active output fields
   if (qf_size_out == 0) {
     for (CeedInt i = 0; i < num_output_fields; i++) {
@@ -561,7 +1311,7 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op, b
   // Loop through elements
   for (CeedInt e = 0; e < num_elem; e++) {
     // Input basis apply
-    CeedCallBackend(CeedOperatorInputBasis_Ref(e, Q, qf_input_fields, op_input_fields, num_input_fields, true, e_data_full, impl));
+    CeedCallBackend(CeedOperatorInputBasis_Ref(e, 0, Q, qf_input_fields, op_input_fields, num_input_fields, true, e_data_full, impl));
 
     // Assemble QFunction
 
@@ -1051,6 +1801,13 @@ static int CeedOperatorApplyAddAtPoints_Ref(CeedOperator op, CeedVector in_vec,
   for (CeedInt e = 0; e < num_elem; e++) {
     CeedInt num_points;
 
+    // Skip elements not selected by the mask
+    if (impl->elem_mask && !impl->elem_mask[e]) {
+      CeedCallBackend(CeedElemRestrictionGetNumPointsInElement(rstr_points, e, &num_points));
+      num_points_offset += num_points;
+      continue;
+    }
+
     // Setup points for element
     CeedCallBackend(CeedElemRestrictionApplyAtPointsInElement(rstr_points, e, CEED_NOTRANSPOSE, point_coords, impl->point_coords_elem, request));
     CeedCallBackend(CeedElemRestrictionGetNumPointsInElement(rstr_points, e, &num_points));
@@ -1730,6 +2487,22 @@ static int CeedSingleOperatorAssembleAtPoints_Ref(CeedOperator op, CeedInt offse
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Set Element Mask
+//------------------------------------------------------------------------------
+static int CeedOperatorSetElementMask_Ref(CeedOperator op, const bool *mask) {
+  CeedInt           num_elem;
+  CeedOperator_Ref *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedFree(&impl->elem_mask));
+  if (!mask) return CEED_ERROR_SUCCESS;
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedCalloc(num_elem, &impl->elem_mask));
+  memcpy(impl->elem_mask, mask, num_elem * sizeof(bool));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Operator Destroy
 //------------------------------------------------------------------------------
@@ -1745,6 +2518,12 @@ static int CeedOperatorDestroy_Ref(CeedOperator op) {
     CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_full[i]));
   }
   CeedCallBackend(CeedFree(&impl->e_vecs_full));
+  if (impl->q_vecs_full_in) {
+    for (CeedInt i = 0; i < impl->num_inputs; i++) {
+      CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_full_in[i]));
+    }
+  }
+  CeedCallBackend(CeedFree(&impl->q_vecs_full_in));
   CeedCallBackend(CeedFree(&impl->input_states));
 
   for (CeedInt i = 0; i < impl->num_inputs; i++) {
@@ -1761,6 +2540,7 @@ static int CeedOperatorDestroy_Ref(CeedOperator op) {
   CeedCallBackend(CeedFree(&impl->e_vecs_out));
   CeedCallBackend(CeedFree(&impl->q_vecs_out));
   CeedCallBackend(CeedVectorDestroy(&impl->point_coords_elem));
+  CeedCallBackend(CeedFree(&impl->elem_mask));
 
   CeedCallBackend(CeedFree(&impl));
   return CEED_ERROR_SUCCESS;
@@ -1778,12 +2558,76 @@ int CeedOperatorCreate_Ref(CeedOperator op) {
   CeedCallBackend(CeedOperatorSetData(op, impl));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction", CeedOperatorLinearAssembleQFunction_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunctionUpdate", CeedOperatorLinearAssembleQFunctionUpdate_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleAddDiagonal", CeedOperatorLinearAssembleAddDiagonal_Ref));
+  CeedCallBackend(
+      CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleAddPointBlockDiagonal", CeedOperatorLinearAssembleAddPointBlockDiagonal_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleSingle", CeedSingleOperatorAssemble_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleSingleRange", CeedSingleOperatorAssembleRange_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleSingleAddSparse", CeedSingleOperatorAssembleAddSparse_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd", CeedOperatorApplyAdd_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddScaled", CeedOperatorApplyAddScaled_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddMulti", CeedOperatorApplyAddMulti_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "SetElementMask", CeedOperatorSetElementMask_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroy_Ref));
   CeedCallBackend(CeedDestroy(&ceed));
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Composite Operator Destroy
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroyComposite_Ref(CeedOperator op) {
+  CeedOperatorComposite_Ref *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedFree(&impl));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Create
+//------------------------------------------------------------------------------
+int CeedCompositeOperatorCreate_Ref(CeedOperator op) {
+  Ceed                       ceed;
+  CeedOperatorComposite_Ref *impl;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedCalloc(1, &impl));
+  CeedCallBackend(CeedOperatorSetData(op, impl));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddComposite", CeedOperatorApplyAddComposite_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddScaledComposite", CeedOperatorApplyAddScaledComposite_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroyComposite_Ref));
+  CeedCallBackend(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Product Operator Destroy
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroyProduct_Ref(CeedOperator op) {
+  CeedOperatorProduct_Ref *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedFree(&impl));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Product Operator Create
+//------------------------------------------------------------------------------
+int CeedOperatorCreateProduct_Ref(CeedOperator op) {
+  Ceed                     ceed;
+  CeedOperatorProduct_Ref *impl;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedCalloc(1, &impl));
+  CeedCallBackend(CeedOperatorSetData(op, impl));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddProduct", CeedOperatorApplyAddProduct_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroyProduct_Ref));
+  CeedCallBackend(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Operator Create At Points
 //------------------------------------------------------------------------------
@@ -1800,6 +2644,7 @@ int CeedOperatorCreateAtPoints_Ref(CeedOperator op) {
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleAddDiagonal", CeedOperatorLinearAssembleAddDiagonalAtPoints_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleSingle", CeedSingleOperatorAssembleAtPoints_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd", CeedOperatorApplyAddAtPoints_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "SetElementMask", CeedOperatorSetElementMask_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroy_Ref));
   CeedCallBackend(CeedDestroy(&ceed));
   return CEED_ERROR_SUCCESS;
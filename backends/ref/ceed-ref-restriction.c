@@ -180,7 +180,7 @@ static inline int CeedElemRestrictionApplyCurlOrientedUnsignedNoTranspose_Ref_Co
 
 static inline int CeedElemRestrictionApplyStridedTranspose_Ref_Core(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size,
                                                                     const CeedInt start, const CeedInt stop, const CeedInt num_elem,
-                                                                    const CeedInt elem_size, const CeedSize v_offset,
+                                                                    const CeedInt elem_size, const CeedSize v_offset, const CeedScalar alpha,
                                                                     const CeedScalar *__restrict__ uu, CeedScalar *__restrict__ vv) {
   // No offsets provided, identity restriction
   bool has_backend_strides;
@@ -193,7 +193,8 @@ static inline int CeedElemRestrictionApplyStridedTranspose_Ref_Core(CeedElemRest
       for (CeedSize k = 0; k < num_comp; k++) {
         for (CeedSize n = 0; n < elem_size; n++) {
           CeedPragmaSIMD for (CeedSize j = 0; j < CeedIntMin(block_size, num_elem - e); j++) {
-            vv[n + k * elem_size + (e + j) * elem_size * num_comp] += uu[e * elem_size * num_comp + (k * elem_size + n) * block_size + j - v_offset];
+            vv[n + k * elem_size + (e + j) * elem_size * num_comp] +=
+                alpha * uu[e * elem_size * num_comp + (k * elem_size + n) * block_size + j - v_offset];
           }
         }
       }
@@ -208,7 +209,7 @@ static inline int CeedElemRestrictionApplyStridedTranspose_Ref_Core(CeedElemRest
         for (CeedSize n = 0; n < elem_size; n++) {
           CeedPragmaSIMD for (CeedSize j = 0; j < CeedIntMin(block_size, num_elem - e); j++) {
             vv[n * strides[0] + k * strides[1] + (e + j) * strides[2]] +=
-                uu[e * elem_size * num_comp + (k * elem_size + n) * block_size + j - v_offset];
+                alpha * uu[e * elem_size * num_comp + (k * elem_size + n) * block_size + j - v_offset];
           }
         }
       }
@@ -220,7 +221,8 @@ static inline int CeedElemRestrictionApplyStridedTranspose_Ref_Core(CeedElemRest
 static inline int CeedElemRestrictionApplyOffsetTranspose_Ref_Core(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size,
                                                                    const CeedInt comp_stride, const CeedInt start, const CeedInt stop,
                                                                    const CeedInt num_elem, const CeedInt elem_size, const CeedSize v_offset,
-                                                                   const CeedScalar *__restrict__ uu, CeedScalar *__restrict__ vv) {
+                                                                   const CeedScalar alpha, const CeedScalar *__restrict__ uu,
+                                                                   CeedScalar *__restrict__ vv) {
   // Default restriction with offsets
   CeedElemRestriction_Ref *impl;
 
@@ -232,7 +234,7 @@ static inline int CeedElemRestrictionApplyOffsetTranspose_Ref_Core(CeedElemRestr
         for (CeedSize j = i; j < i + CeedIntMin(block_size, num_elem - e); j++) {
           CeedScalar vv_loc;
 
-          vv_loc = uu[elem_size * (k * block_size + e * num_comp) + j - v_offset];
+          vv_loc = alpha * uu[elem_size * (k * block_size + e * num_comp) + j - v_offset];
           CeedPragmaAtomic vv[impl->offsets[j + e * elem_size] + k * comp_stride] += vv_loc;
         }
       }
@@ -244,7 +246,8 @@ static inline int CeedElemRestrictionApplyOffsetTranspose_Ref_Core(CeedElemRestr
 static inline int CeedElemRestrictionApplyOrientedTranspose_Ref_Core(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size,
                                                                      const CeedInt comp_stride, const CeedInt start, const CeedInt stop,
                                                                      const CeedInt num_elem, const CeedInt elem_size, const CeedSize v_offset,
-                                                                     const CeedScalar *__restrict__ uu, CeedScalar *__restrict__ vv) {
+                                                                     const CeedScalar alpha, const CeedScalar *__restrict__ uu,
+                                                                     CeedScalar *__restrict__ vv) {
   // Restriction with orientations
   CeedElemRestriction_Ref *impl;
 
@@ -256,7 +259,7 @@ static inline int CeedElemRestrictionApplyOrientedTranspose_Ref_Core(CeedElemRes
         for (CeedSize j = i; j < i + CeedIntMin(block_size, num_elem - e); j++) {
           CeedScalar vv_loc;
 
-          vv_loc = uu[elem_size * (k * block_size + e * num_comp) + j - v_offset] * (impl->orients[j + e * elem_size] ? -1.0 : 1.0);
+          vv_loc = alpha * uu[elem_size * (k * block_size + e * num_comp) + j - v_offset] * (impl->orients[j + e * elem_size] ? -1.0 : 1.0);
           CeedPragmaAtomic vv[impl->offsets[j + e * elem_size] + k * comp_stride] += vv_loc;
         }
       }
@@ -268,7 +271,8 @@ static inline int CeedElemRestrictionApplyOrientedTranspose_Ref_Core(CeedElemRes
 static inline int CeedElemRestrictionApplyCurlOrientedTranspose_Ref_Core(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size,
                                                                          const CeedInt comp_stride, const CeedInt start, const CeedInt stop,
                                                                          const CeedInt num_elem, const CeedInt elem_size, const CeedSize v_offset,
-                                                                         const CeedScalar *__restrict__ uu, CeedScalar *__restrict__ vv) {
+                                                                         const CeedScalar alpha, const CeedScalar *__restrict__ uu,
+                                                                         CeedScalar *__restrict__ vv) {
   // Restriction with tridiagonal transformation
   CeedElemRestriction_Ref *impl;
   CeedScalar               vv_loc[block_size];
@@ -287,7 +291,7 @@ static inline int CeedElemRestrictionApplyCurlOrientedTranspose_Ref_Core(CeedEle
                         impl->curl_orients[j + (3 * n + 3) * block_size + e * 3 * elem_size];
       }
       for (CeedSize j = 0; j < block_end; j++) {
-        CeedPragmaAtomic vv[impl->offsets[j + n * block_size + e * elem_size] + k * comp_stride] += vv_loc[j];
+        CeedPragmaAtomic vv[impl->offsets[j + n * block_size + e * elem_size] + k * comp_stride] += alpha * vv_loc[j];
       }
       for (n = 1; n < elem_size - 1; n++) {
         CeedPragmaSIMD for (CeedInt j = 0; j < block_end; j++) {
@@ -299,7 +303,7 @@ static inline int CeedElemRestrictionApplyCurlOrientedTranspose_Ref_Core(CeedEle
                           impl->curl_orients[j + (3 * n + 3) * block_size + e * 3 * elem_size];
         }
         for (CeedSize j = 0; j < block_end; j++) {
-          CeedPragmaAtomic vv[impl->offsets[j + n * block_size + e * elem_size] + k * comp_stride] += vv_loc[j];
+          CeedPragmaAtomic vv[impl->offsets[j + n * block_size + e * elem_size] + k * comp_stride] += alpha * vv_loc[j];
         }
       }
       CeedPragmaSIMD for (CeedSize j = 0; j < block_end; j++) {
@@ -309,7 +313,7 @@ static inline int CeedElemRestrictionApplyCurlOrientedTranspose_Ref_Core(CeedEle
                         impl->curl_orients[j + (3 * n + 1) * block_size + e * 3 * elem_size];
       }
       for (CeedSize j = 0; j < block_end; j++) {
-        CeedPragmaAtomic vv[impl->offsets[j + n * block_size + e * elem_size] + k * comp_stride] += vv_loc[j];
+        CeedPragmaAtomic vv[impl->offsets[j + n * block_size + e * elem_size] + k * comp_stride] += alpha * vv_loc[j];
       }
     }
   }
@@ -320,7 +324,8 @@ static inline int CeedElemRestrictionApplyCurlOrientedUnsignedTranspose_Ref_Core
                                                                                  const CeedInt block_size, const CeedInt comp_stride,
                                                                                  const CeedInt start, const CeedInt stop, const CeedInt num_elem,
                                                                                  const CeedInt elem_size, const CeedSize v_offset,
-                                                                                 const CeedScalar *__restrict__ uu, CeedScalar *__restrict__ vv) {
+                                                                                 const CeedScalar alpha, const CeedScalar *__restrict__ uu,
+                                                                                 CeedScalar *__restrict__ vv) {
   // Restriction with (unsigned) tridiagonal transformation
   CeedElemRestriction_Ref *impl;
   CeedScalar               vv_loc[block_size];
@@ -339,7 +344,7 @@ static inline int CeedElemRestrictionApplyCurlOrientedUnsignedTranspose_Ref_Core
                         abs(impl->curl_orients[j + (3 * n + 3) * block_size + e * 3 * elem_size]);
       }
       for (CeedSize j = 0; j < block_end; j++) {
-        CeedPragmaAtomic vv[impl->offsets[j + n * block_size + e * elem_size] + k * comp_stride] += vv_loc[j];
+        CeedPragmaAtomic vv[impl->offsets[j + n * block_size + e * elem_size] + k * comp_stride] += alpha * vv_loc[j];
       }
       for (n = 1; n < elem_size - 1; n++) {
         CeedPragmaSIMD for (CeedSize j = 0; j < block_end; j++) {
@@ -351,7 +356,7 @@ static inline int CeedElemRestrictionApplyCurlOrientedUnsignedTranspose_Ref_Core
                           abs(impl->curl_orients[j + (3 * n + 3) * block_size + e * 3 * elem_size]);
         }
         for (CeedSize j = 0; j < block_end; j++) {
-          CeedPragmaAtomic vv[impl->offsets[j + n * block_size + e * elem_size] + k * comp_stride] += vv_loc[j];
+          CeedPragmaAtomic vv[impl->offsets[j + n * block_size + e * elem_size] + k * comp_stride] += alpha * vv_loc[j];
         }
       }
       CeedPragmaSIMD for (CeedSize j = 0; j < block_end; j++) {
@@ -361,7 +366,7 @@ static inline int CeedElemRestrictionApplyCurlOrientedUnsignedTranspose_Ref_Core
                         abs(impl->curl_orients[j + (3 * n + 1) * block_size + e * 3 * elem_size]);
       }
       for (CeedSize j = 0; j < block_end; j++) {
-        CeedPragmaAtomic vv[impl->offsets[j + n * block_size + e * elem_size] + k * comp_stride] += vv_loc[j];
+        CeedPragmaAtomic vv[impl->offsets[j + n * block_size + e * elem_size] + k * comp_stride] += alpha * vv_loc[j];
       }
     }
   }
@@ -369,8 +374,8 @@ static inline int CeedElemRestrictionApplyCurlOrientedUnsignedTranspose_Ref_Core
 }
 
 static inline int CeedElemRestrictionApplyAtPointsInElement_Ref_Core(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt start,
-                                                                     const CeedInt stop, CeedTransposeMode t_mode, const CeedScalar *__restrict__ uu,
-                                                                     CeedScalar *__restrict__ vv) {
+                                                                     const CeedInt stop, CeedTransposeMode t_mode, const CeedScalar alpha,
+                                                                     const CeedScalar *__restrict__ uu, CeedScalar *__restrict__ vv) {
   CeedInt                  num_points, l_vec_offset;
   CeedSize                 e_vec_offset = 0;
   CeedElemRestriction_Ref *impl;
@@ -385,7 +390,7 @@ static inline int CeedElemRestrictionApplyAtPointsInElement_Ref_Core(CeedElemRes
       }
     } else {
       for (CeedSize i = 0; i < num_points; i++) {
-        for (CeedSize j = 0; j < num_comp; j++) vv[impl->offsets[i + l_vec_offset] * num_comp + j] += uu[j * num_points + i + e_vec_offset];
+        for (CeedSize j = 0; j < num_comp; j++) vv[impl->offsets[i + l_vec_offset] * num_comp + j] += alpha * uu[j * num_points + i + e_vec_offset];
       }
     }
     e_vec_offset += num_points * (CeedSize)num_comp;
@@ -395,7 +400,8 @@ static inline int CeedElemRestrictionApplyAtPointsInElement_Ref_Core(CeedElemRes
 
 static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size,
                                                     const CeedInt comp_stride, const CeedInt start, const CeedInt stop, CeedTransposeMode t_mode,
-                                                    bool use_signs, bool use_orients, CeedVector u, CeedVector v, CeedRequest *request) {
+                                                    CeedScalar alpha, bool use_signs, bool use_orients, CeedVector u, CeedVector v,
+                                                    CeedRequest *request) {
   CeedInt             num_elem, elem_size;
   CeedSize            v_offset = 0;
   CeedRestrictionType rstr_type;
@@ -424,35 +430,35 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction rstr, co
     switch (rstr_type) {
       case CEED_RESTRICTION_STRIDED:
         CeedCallBackend(
-            CeedElemRestrictionApplyStridedTranspose_Ref_Core(rstr, num_comp, block_size, start, stop, num_elem, elem_size, v_offset, uu, vv));
+            CeedElemRestrictionApplyStridedTranspose_Ref_Core(rstr, num_comp, block_size, start, stop, num_elem, elem_size, v_offset, alpha, uu, vv));
         break;
       case CEED_RESTRICTION_STANDARD:
         CeedCallBackend(CeedElemRestrictionApplyOffsetTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem, elem_size,
-                                                                         v_offset, uu, vv));
+                                                                         v_offset, alpha, uu, vv));
         break;
       case CEED_RESTRICTION_ORIENTED:
         if (use_signs) {
           CeedCallBackend(CeedElemRestrictionApplyOrientedTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem,
-                                                                             elem_size, v_offset, uu, vv));
+                                                                             elem_size, v_offset, alpha, uu, vv));
         } else {
           CeedCallBackend(CeedElemRestrictionApplyOffsetTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem, elem_size,
-                                                                           v_offset, uu, vv));
+                                                                           v_offset, alpha, uu, vv));
         }
         break;
       case CEED_RESTRICTION_CURL_ORIENTED:
         if (use_signs && use_orients) {
           CeedCallBackend(CeedElemRestrictionApplyCurlOrientedTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem,
-                                                                                 elem_size, v_offset, uu, vv));
+                                                                                 elem_size, v_offset, alpha, uu, vv));
         } else if (use_orients) {
           CeedCallBackend(CeedElemRestrictionApplyCurlOrientedUnsignedTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop,
-                                                                                         num_elem, elem_size, v_offset, uu, vv));
+                                                                                         num_elem, elem_size, v_offset, alpha, uu, vv));
         } else {
           CeedCallBackend(CeedElemRestrictionApplyOffsetTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem, elem_size,
-                                                                           v_offset, uu, vv));
+                                                                           v_offset, alpha, uu, vv));
         }
         break;
       case CEED_RESTRICTION_POINTS:
-        CeedCallBackend(CeedElemRestrictionApplyAtPointsInElement_Ref_Core(rstr, num_comp, start, stop, t_mode, uu, vv));
+        CeedCallBackend(CeedElemRestrictionApplyAtPointsInElement_Ref_Core(rstr, num_comp, start, stop, t_mode, alpha, uu, vv));
         break;
     }
   } else {
@@ -492,7 +498,7 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction rstr, co
         }
         break;
       case CEED_RESTRICTION_POINTS:
-        CeedCallBackend(CeedElemRestrictionApplyAtPointsInElement_Ref_Core(rstr, num_comp, start, stop, t_mode, uu, vv));
+        CeedCallBackend(CeedElemRestrictionApplyAtPointsInElement_Ref_Core(rstr, num_comp, start, stop, t_mode, alpha, uu, vv));
         break;
     }
   }
@@ -506,103 +512,103 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction rstr, co
 // ElemRestriction Apply - Common Sizes
 //------------------------------------------------------------------------------
 static int CeedElemRestrictionApply_Ref_110(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
-                                            CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(rstr, 1, 1, comp_stride, start, stop, t_mode, use_signs, use_orients, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedScalar alpha, bool use_signs,
+                                            bool use_orients, CeedVector u, CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 1, 1, comp_stride, start, stop, t_mode, alpha, use_signs, use_orients, u, v, request);
 }
 
 static int CeedElemRestrictionApply_Ref_111(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
-                                            CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(rstr, 1, 1, 1, start, stop, t_mode, use_signs, use_orients, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedScalar alpha, bool use_signs,
+                                            bool use_orients, CeedVector u, CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 1, 1, 1, start, stop, t_mode, alpha, use_signs, use_orients, u, v, request);
 }
 
 static int CeedElemRestrictionApply_Ref_180(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
-                                            CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(rstr, 1, 8, comp_stride, start, stop, t_mode, use_signs, use_orients, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedScalar alpha, bool use_signs,
+                                            bool use_orients, CeedVector u, CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 1, 8, comp_stride, start, stop, t_mode, alpha, use_signs, use_orients, u, v, request);
 }
 
 static int CeedElemRestrictionApply_Ref_181(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
-                                            CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(rstr, 1, 8, 1, start, stop, t_mode, use_signs, use_orients, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedScalar alpha, bool use_signs,
+                                            bool use_orients, CeedVector u, CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 1, 8, 1, start, stop, t_mode, alpha, use_signs, use_orients, u, v, request);
 }
 
 static int CeedElemRestrictionApply_Ref_310(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
-                                            CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(rstr, 3, 1, comp_stride, start, stop, t_mode, use_signs, use_orients, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedScalar alpha, bool use_signs,
+                                            bool use_orients, CeedVector u, CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 3, 1, comp_stride, start, stop, t_mode, alpha, use_signs, use_orients, u, v, request);
 }
 
 static int CeedElemRestrictionApply_Ref_311(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
-                                            CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(rstr, 3, 1, 1, start, stop, t_mode, use_signs, use_orients, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedScalar alpha, bool use_signs,
+                                            bool use_orients, CeedVector u, CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 3, 1, 1, start, stop, t_mode, alpha, use_signs, use_orients, u, v, request);
 }
 
 static int CeedElemRestrictionApply_Ref_380(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
-                                            CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(rstr, 3, 8, comp_stride, start, stop, t_mode, use_signs, use_orients, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedScalar alpha, bool use_signs,
+                                            bool use_orients, CeedVector u, CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 3, 8, comp_stride, start, stop, t_mode, alpha, use_signs, use_orients, u, v, request);
 }
 
 static int CeedElemRestrictionApply_Ref_381(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
-                                            CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(rstr, 3, 8, 1, start, stop, t_mode, use_signs, use_orients, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedScalar alpha, bool use_signs,
+                                            bool use_orients, CeedVector u, CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 3, 8, 1, start, stop, t_mode, alpha, use_signs, use_orients, u, v, request);
 }
 
 // LCOV_EXCL_START
 static int CeedElemRestrictionApply_Ref_410(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
-                                            CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(rstr, 4, 1, comp_stride, start, stop, t_mode, use_signs, use_orients, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedScalar alpha, bool use_signs,
+                                            bool use_orients, CeedVector u, CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 4, 1, comp_stride, start, stop, t_mode, alpha, use_signs, use_orients, u, v, request);
 }
 
 static int CeedElemRestrictionApply_Ref_411(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
-                                            CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(rstr, 4, 1, 1, start, stop, t_mode, use_signs, use_orients, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedScalar alpha, bool use_signs,
+                                            bool use_orients, CeedVector u, CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 4, 1, 1, start, stop, t_mode, alpha, use_signs, use_orients, u, v, request);
 }
 
 static int CeedElemRestrictionApply_Ref_480(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
-                                            CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(rstr, 4, 8, comp_stride, start, stop, t_mode, use_signs, use_orients, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedScalar alpha, bool use_signs,
+                                            bool use_orients, CeedVector u, CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 4, 8, comp_stride, start, stop, t_mode, alpha, use_signs, use_orients, u, v, request);
 }
 
 static int CeedElemRestrictionApply_Ref_481(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
-                                            CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(rstr, 4, 8, 1, start, stop, t_mode, use_signs, use_orients, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedScalar alpha, bool use_signs,
+                                            bool use_orients, CeedVector u, CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 4, 8, 1, start, stop, t_mode, alpha, use_signs, use_orients, u, v, request);
 }
 
 static int CeedElemRestrictionApply_Ref_510(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
-                                            CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(rstr, 5, 1, comp_stride, start, stop, t_mode, use_signs, use_orients, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedScalar alpha, bool use_signs,
+                                            bool use_orients, CeedVector u, CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 5, 1, comp_stride, start, stop, t_mode, alpha, use_signs, use_orients, u, v, request);
 }
 // LCOV_EXCL_STOP
 
 static int CeedElemRestrictionApply_Ref_511(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
-                                            CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(rstr, 5, 1, 1, start, stop, t_mode, use_signs, use_orients, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedScalar alpha, bool use_signs,
+                                            bool use_orients, CeedVector u, CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 5, 1, 1, start, stop, t_mode, alpha, use_signs, use_orients, u, v, request);
 }
 
 // LCOV_EXCL_START
 static int CeedElemRestrictionApply_Ref_580(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
-                                            CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(rstr, 5, 8, comp_stride, start, stop, t_mode, use_signs, use_orients, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedScalar alpha, bool use_signs,
+                                            bool use_orients, CeedVector u, CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 5, 8, comp_stride, start, stop, t_mode, alpha, use_signs, use_orients, u, v, request);
 }
 // LCOV_EXCL_STOP
 
 static int CeedElemRestrictionApply_Ref_581(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs, bool use_orients, CeedVector u,
-                                            CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(rstr, 5, 8, 1, start, stop, t_mode, use_signs, use_orients, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedScalar alpha, bool use_signs,
+                                            bool use_orients, CeedVector u, CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(rstr, 5, 8, 1, start, stop, t_mode, alpha, use_signs, use_orients, u, v, request);
 }
 
 //------------------------------------------------------------------------------
@@ -617,7 +623,7 @@ static int CeedElemRestrictionApply_Ref(CeedElemRestriction rstr, CeedTransposeM
   CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
   CeedCallBackend(CeedElemRestrictionGetCompStride(rstr, &comp_stride));
   CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
-  CeedCallBackend(impl->Apply(rstr, num_comp, block_size, comp_stride, 0, num_block, t_mode, true, true, u, v, request));
+  CeedCallBackend(impl->Apply(rstr, num_comp, block_size, comp_stride, 0, num_block, t_mode, 1.0, true, true, u, v, request));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -634,7 +640,7 @@ static int CeedElemRestrictionApplyUnsigned_Ref(CeedElemRestriction rstr, CeedTr
   CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
   CeedCallBackend(CeedElemRestrictionGetCompStride(rstr, &comp_stride));
   CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
-  CeedCallBackend(impl->Apply(rstr, num_comp, block_size, comp_stride, 0, num_block, t_mode, false, true, u, v, request));
+  CeedCallBackend(impl->Apply(rstr, num_comp, block_size, comp_stride, 0, num_block, t_mode, 1.0, false, true, u, v, request));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -651,7 +657,7 @@ static int CeedElemRestrictionApplyUnoriented_Ref(CeedElemRestriction rstr, Ceed
   CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
   CeedCallBackend(CeedElemRestrictionGetCompStride(rstr, &comp_stride));
   CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
-  CeedCallBackend(impl->Apply(rstr, num_comp, block_size, comp_stride, 0, num_block, t_mode, false, false, u, v, request));
+  CeedCallBackend(impl->Apply(rstr, num_comp, block_size, comp_stride, 0, num_block, t_mode, 1.0, false, false, u, v, request));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -665,7 +671,7 @@ static int CeedElemRestrictionApplyAtPointsInElement_Ref(CeedElemRestriction rst
 
   CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
   CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
-  return impl->Apply(rstr, num_comp, 0, 1, elem, elem + 1, t_mode, false, false, u, v, request);
+  return impl->Apply(rstr, num_comp, 0, 1, elem, elem + 1, t_mode, 1.0, false, false, u, v, request);
 }
 
 //------------------------------------------------------------------------------
@@ -680,7 +686,40 @@ static int CeedElemRestrictionApplyBlock_Ref(CeedElemRestriction rstr, CeedInt b
   CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
   CeedCallBackend(CeedElemRestrictionGetCompStride(rstr, &comp_stride));
   CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
-  CeedCallBackend(impl->Apply(rstr, num_comp, block_size, comp_stride, block, block + 1, t_mode, true, true, u, v, request));
+  CeedCallBackend(impl->Apply(rstr, num_comp, block_size, comp_stride, block, block + 1, t_mode, 1.0, true, true, u, v, request));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Apply Range
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionApplyRange_Ref(CeedElemRestriction rstr, CeedInt start_block, CeedInt stop_block, CeedTransposeMode t_mode,
+                                             bool use_signs, bool use_orients, CeedVector u, CeedVector v, CeedRequest *request) {
+  CeedInt                  block_size, num_comp, comp_stride;
+  CeedElemRestriction_Ref *impl;
+
+  CeedCallBackend(CeedElemRestrictionGetBlockSize(rstr, &block_size));
+  CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
+  CeedCallBackend(CeedElemRestrictionGetCompStride(rstr, &comp_stride));
+  CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
+  CeedCallBackend(impl->Apply(rstr, num_comp, block_size, comp_stride, start_block, stop_block, t_mode, 1.0, use_signs, use_orients, u, v, request));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Apply Range Scaled
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionApplyRangeScaled_Ref(CeedElemRestriction rstr, CeedInt start_block, CeedInt stop_block, CeedScalar alpha,
+                                                   bool use_signs, bool use_orients, CeedVector u, CeedVector v, CeedRequest *request) {
+  CeedInt                  block_size, num_comp, comp_stride;
+  CeedElemRestriction_Ref *impl;
+
+  CeedCallBackend(CeedElemRestrictionGetBlockSize(rstr, &block_size));
+  CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
+  CeedCallBackend(CeedElemRestrictionGetCompStride(rstr, &comp_stride));
+  CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
+  CeedCallBackend(
+      impl->Apply(rstr, num_comp, block_size, comp_stride, start_block, stop_block, CEED_TRANSPOSE, alpha, use_signs, use_orients, u, v, request));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -901,6 +940,10 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode,
     CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "ApplyAtPointsInElement", CeedElemRestrictionApplyAtPointsInElement_Ref));
   }
   CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "ApplyBlock", CeedElemRestrictionApplyBlock_Ref));
+  if (rstr_type != CEED_RESTRICTION_POINTS) {
+    CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "ApplyRange", CeedElemRestrictionApplyRange_Ref));
+    CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "ApplyRangeScaled", CeedElemRestrictionApplyRangeScaled_Ref));
+  }
   CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "GetOffsets", CeedElemRestrictionGetOffsets_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "GetOrientations", CeedElemRestrictionGetOrientations_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "GetCurlOrientations", CeedElemRestrictionGetCurlOrientations_Ref));
@@ -27,13 +27,17 @@ typedef struct {
   const CeedInt8 *curl_orients; /* Tridiagonal matrix (row-major) for a general transformation during restriction */
   const CeedInt8 *curl_orients_borrowed;
   const CeedInt8 *curl_orients_owned;
-  int (*Apply)(CeedElemRestriction, CeedInt, CeedInt, CeedInt, CeedInt, CeedInt, CeedTransposeMode, bool, bool, CeedVector, CeedVector,
-               CeedRequest *);
+  int (*Apply)(CeedElemRestriction, CeedInt, CeedInt, CeedInt, CeedInt, CeedInt, CeedTransposeMode, CeedScalar, bool, bool, CeedVector,
+               CeedVector, CeedRequest *);
 } CeedElemRestriction_Ref;
 
 typedef struct {
   CeedScalar *collo_grad_1d;
   bool        is_collocated;
+  CeedInt     num_even_1d, num_odd_1d; /* Rows of interp_1d that are even and odd about the center node */
+  CeedInt    *even_odd_rows_1d;        /* Even rows followed by odd rows */
+  CeedScalar *interp_even_1d;          /* Folded even rows, num_even_1d x ((P_1d + 1) / 2), row-major */
+  CeedScalar *interp_odd_1d;           /* Folded odd rows, num_odd_1d x (P_1d / 2), row-major */
 } CeedBasis_Ref;
 
 typedef struct {
@@ -47,21 +51,41 @@ typedef struct {
   void *data_owned;
 } CeedQFunctionContext_Ref;
 
+// Target size in bytes of the chunked E-vector working set for automatic chunk sizing
+#define CEED_REF_CHUNK_BYTES (256 * 1024)
+
 typedef struct {
   bool        is_identity_qf, is_identity_rstr_op;
   bool       *skip_rstr_in, *skip_rstr_out, *apply_add_basis_out;
   CeedInt    *e_data_out_indices;
-  uint64_t   *input_states; /* State counter of inputs */
-  CeedVector *e_vecs_full;  /* Full E-vectors, inputs followed by outputs */
-  CeedVector *e_vecs_in;    /* Single element input E-vectors  */
-  CeedVector *e_vecs_out;   /* Single element output E-vectors */
-  CeedVector *q_vecs_in;    /* Single element input Q-vectors  */
-  CeedVector *q_vecs_out;   /* Single element output Q-vectors */
+  uint64_t   *input_states;                   /* State counter of inputs */
+  CeedVector *e_vecs_full;                    /* Full E-vectors, inputs followed by outputs */
+  CeedVector *q_vecs_full_in;                 /* Full passive input Q-vectors, reused while the input state is unchanged */
+  CeedScalar *q_data_full_in[CEED_FIELD_MAX]; /* Arrays of full passive input Q-vectors during application */
+  bool        is_elem_shared_in[CEED_FIELD_MAX]; /* Passive inputs shared by all elements, with E-vectors holding one element */
+  CeedVector *e_vecs_in;                      /* Single element input E-vectors  */
+  CeedVector *e_vecs_out;                     /* Single element output E-vectors */
+  CeedVector *q_vecs_in;                      /* Single element input Q-vectors  */
+  CeedVector *q_vecs_out;                     /* Single element output Q-vectors */
   CeedInt     num_inputs, num_outputs;
+  CeedInt     chunk_size; /* Number of elements per chunk of active input and output E-vectors */
   CeedInt     qf_size_in, qf_size_out;
   CeedVector  point_coords_elem;
+  bool       *elem_mask; /* Elements to apply the operator on, NULL for all elements */
 } CeedOperator_Ref;
 
+typedef struct {
+  CeedInt num_sub;                        /* Number of sub-operators grouped, groups are recomputed when sub-operators are added */
+  CeedInt group[CEED_COMPOSITE_MAX];      /* First sub-operator of the group sharing an element loop */
+  CeedInt active_in[CEED_COMPOSITE_MAX];  /* Active input field of each sub-operator */
+  CeedInt active_out[CEED_COMPOSITE_MAX]; /* Active output field of each sub-operator */
+} CeedOperatorComposite_Ref;
+
+typedef struct {
+  bool is_setup;
+  bool is_fusable; /* Inner operator output E-vector is passed directly to the outer operator, else the interface intermediate L-vector is used */
+} CeedOperatorProduct_Ref;
+
 CEED_INTERN int CeedVectorCreate_Ref(CeedSize n, CeedVector vec);
 
 CEED_INTERN int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode, const CeedInt *offsets, const bool *orients,
@@ -84,3 +108,11 @@ CEED_INTERN int CeedQFunctionContextCreate_Ref(CeedQFunctionContext ctx);
 
 CEED_INTERN int CeedOperatorCreate_Ref(CeedOperator op);
 CEED_INTERN int CeedOperatorCreateAtPoints_Ref(CeedOperator op);
+CEED_INTERN int CeedCompositeOperatorCreate_Ref(CeedOperator op);
+CEED_INTERN int CeedOperatorCreateProduct_Ref(CeedOperator op);
+
+CEED_INTERN int CeedOperatorLinearAssembleAddDiagonal_Ref(CeedOperator op, CeedVector assembled, CeedRequest *request);
+CEED_INTERN int CeedOperatorLinearAssembleAddPointBlockDiagonal_Ref(CeedOperator op, CeedVector assembled, CeedRequest *request);
+CEED_INTERN int CeedSingleOperatorAssemble_Ref(CeedOperator op, CeedInt offset, CeedVector values);
+CEED_INTERN int CeedSingleOperatorAssembleRange_Ref(CeedOperator op, CeedInt elem_start, CeedInt elem_stop, CeedVector values);
+CEED_INTERN int CeedSingleOperatorAssembleAddSparse_Ref(CeedOperator op, const CeedSize *scatter, CeedVector values);
@@ -0,0 +1,46 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <ceed/jit-source/gallery/ceed-assembled-transpose.h>
+#include <stddef.h>
+#include <string.h>
+
+/**
+  @brief Set fields for `CeedQFunction` applying the transpose of a linearized `CeedQFunction`
+**/
+static int CeedQFunctionInit_AssembledTranspose(Ceed ceed, const char *requested, CeedQFunction qf) {
+  // Check QFunction name
+  const char *name = "AssembledTranspose";
+  CeedCheck(!strcmp(name, requested), ceed, CEED_ERROR_UNSUPPORTED, "QFunction '%s' does not match requested name: %s", name, requested);
+
+  // QFunction fields matching the linearized CeedOperator added by the library rather than being added here
+
+  // Context data, field counts and sizes set by the library
+  CeedQFunctionContext  ctx;
+  AssembledTransposeCtx ctx_data = {.num_in = 0, .num_out = 0};
+  CeedCall(CeedQFunctionContextCreate(ceed, &ctx));
+  CeedCall(CeedQFunctionContextSetData(ctx, CEED_MEM_HOST, CEED_COPY_VALUES, sizeof(ctx_data), &ctx_data));
+  CeedCall(CeedQFunctionContextRegisterInt32(ctx, "num inputs", offsetof(AssembledTransposeCtx, num_in), 1, "number of active input fields"));
+  CeedCall(CeedQFunctionContextRegisterInt32(ctx, "num outputs", offsetof(AssembledTransposeCtx, num_out), 1, "number of active output fields"));
+  CeedCall(CeedQFunctionContextRegisterInt32(ctx, "input sizes", offsetof(AssembledTransposeCtx, sizes_in), CEED_FIELD_MAX,
+                                             "sizes of active input fields"));
+  CeedCall(CeedQFunctionContextRegisterInt32(ctx, "output sizes", offsetof(AssembledTransposeCtx, sizes_out), CEED_FIELD_MAX,
+                                             "sizes of active output fields"));
+  CeedCall(CeedQFunctionSetContext(qf, ctx));
+  CeedCall(CeedQFunctionContextDestroy(&ctx));
+
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Register `CeedQFunction` applying the transpose of a linearized `CeedQFunction`
+**/
+CEED_INTERN int CeedQFunctionRegister_AssembledTranspose(void) {
+  return CeedQFunctionRegister("AssembledTranspose", AssembledTranspose_loc, 1, AssembledTranspose, CeedQFunctionInit_AssembledTranspose);
+}
@@ -28,3 +28,4 @@ CEED_GALLERY_QFUNCTION(CeedQFunctionRegister_Vector3Poisson1DApply)
 CEED_GALLERY_QFUNCTION(CeedQFunctionRegister_Vector3Poisson2DApply)
 CEED_GALLERY_QFUNCTION(CeedQFunctionRegister_Vector3Poisson3DApply)
 CEED_GALLERY_QFUNCTION(CeedQFunctionRegister_Scale)
+CEED_GALLERY_QFUNCTION(CeedQFunctionRegister_AssembledTranspose)
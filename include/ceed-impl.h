@@ -15,6 +15,12 @@
 
 CEED_INTERN const char *CeedJitSourceRootDefault;
 
+CEED_INTERN int CeedHashData(const void *data, size_t num_bytes, uint64_t *hash);
+CEED_INTERN int CeedObjectCacheAddElemRestriction(Ceed ceed, CeedElemRestriction rstr);
+CEED_INTERN int CeedObjectCacheRemoveElemRestriction(Ceed ceed, CeedElemRestriction rstr);
+CEED_INTERN int CeedObjectCacheAddBasis(Ceed ceed, CeedBasis basis);
+CEED_INTERN int CeedObjectCacheRemoveBasis(Ceed ceed, CeedBasis basis);
+
 /** @defgroup CeedUser Public API for Ceed
     @ingroup Ceed
 */
@@ -90,6 +96,25 @@ struct CeedWorkVectors_private {
   CeedVector *vecs;
 };
 
+// Object cache tracking, entries are weak references removed on destroy
+typedef struct CeedObjectCache_private *CeedObjectCache;
+struct CeedObjectCache_private {
+  CeedInt              num_rstrs, max_rstrs;
+  CeedElemRestriction *rstrs;
+  CeedInt              num_bases, max_bases;
+  CeedBasis           *bases;
+};
+
+// Scatter map from COO assembly entries to compressed sparse storage
+typedef struct CeedSparseAssembly_private *CeedSparseAssembly;
+struct CeedSparseAssembly_private {
+  CeedSize  num_entries; /* Number of COO entries from CeedOperatorLinearAssembleSymbolic() */
+  CeedSize  num_values;  /* Number of values in compressed storage */
+  CeedSize *scatter;     /* Compressed storage slot of each COO entry, contiguous per element; -1 for entries dropped by symmetric storage */
+};
+
+CEED_INTERN int CeedSparseAssemblyDestroy(CeedSparseAssembly *data);
+
 struct Ceed_private {
   const char  *resource;
   Ceed         delegate;
@@ -125,13 +150,16 @@ struct Ceed_private {
   int (*OperatorCreate)(CeedOperator);
   int (*OperatorCreateAtPoints)(CeedOperator);
   int (*CompositeOperatorCreate)(CeedOperator);
+  int (*ProductOperatorCreate)(CeedOperator);
   int             ref_count;
   void           *data;
   bool            is_debug;
   bool            is_deterministic;
+  bool            is_object_caching;
   char            err_msg[CEED_MAX_RESOURCE_LEN];
   FOffset        *f_offsets;
   CeedWorkVectors work_vectors;
+  CeedObjectCache object_cache;
 };
 
 struct CeedVector_private {
@@ -163,14 +191,21 @@ struct CeedVector_private {
   void    *data;
 };
 
+// Number of block sizes for which blocked copies of a CeedElemRestriction are kept
+#define CEED_ELEMRESTRICTION_BLOCKED_MAX 4
+
 struct CeedElemRestriction_private {
   Ceed                ceed;
   CeedElemRestriction rstr_base;
+  CeedElemRestriction rstr_block[CEED_ELEMRESTRICTION_BLOCKED_MAX]; /* Blocked copies, keyed by block size */
+  CeedInt             num_rstr_block;
   int (*Apply)(CeedElemRestriction, CeedTransposeMode, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyUnsigned)(CeedElemRestriction, CeedTransposeMode, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyUnoriented)(CeedElemRestriction, CeedTransposeMode, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyAtPointsInElement)(CeedElemRestriction, CeedInt, CeedTransposeMode, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyBlock)(CeedElemRestriction, CeedInt, CeedTransposeMode, CeedVector, CeedVector, CeedRequest *);
+  int (*ApplyRange)(CeedElemRestriction, CeedInt, CeedInt, CeedTransposeMode, bool, bool, CeedVector, CeedVector, CeedRequest *);
+  int (*ApplyRangeScaled)(CeedElemRestriction, CeedInt, CeedInt, CeedScalar, bool, bool, CeedVector, CeedVector, CeedRequest *);
   int (*GetAtPointsElementOffset)(CeedElemRestriction, CeedInt, CeedSize *);
   int (*GetOffsets)(CeedElemRestriction, CeedMemType, const CeedInt **);
   int (*GetOrientations)(CeedElemRestriction, CeedMemType, const bool **);
@@ -191,7 +226,10 @@ struct CeedElemRestriction_private {
   CeedInt  e_layout[3]; /* E-vector layout [nodes, components, elements] */
   CeedRestrictionType
            rstr_type;   /* initialized in element restriction constructor for default, oriented, curl-oriented, or strided element restriction */
+  bool     is_unsigned;   /* apply without orientation signs, for unsigned copies */
+  bool     is_unoriented; /* apply without orientations, for unoriented copies */
   uint64_t num_readers; /* number of instances of offset read only access */
+  uint64_t cache_hash;  /* content hash if held in the Ceed object cache, 0 otherwise */
   void    *data;        /* place for the backend to store any data */
 };
 
@@ -213,6 +251,7 @@ struct CeedBasis_private {
   CeedInt            Q;               /* total number of quadrature points */
   CeedFESpace        fe_space;        /* initialized in basis constructor with 1, 2, 3 for H^1, H(div), and H(curl) FE space */
   CeedTensorContract contract;        /* tensor contraction object */
+  uint64_t           cache_hash;      /* content hash if held in the Ceed object cache, 0 otherwise */
   CeedScalar        *q_ref_1d;        /* array of length Q1d holding the locations of quadrature points on the 1D reference element [-1, 1] */
   CeedScalar        *q_weight_1d;     /* array of length Q1d holding the quadrature weights on the reference element */
   CeedScalar *interp; /* row-major matrix of shape [Q, P] or [dim * Q, P] expressing the values of nodal basis functions or vector basis functions at
@@ -234,6 +273,7 @@ struct CeedTensorContract_private {
                const CeedScalar *restrict, CeedScalar *restrict);
   int (*Destroy)(CeedTensorContract);
   int   ref_count;
+  bool  use_even_odd; /* Whether bases fold even-odd symmetric 1D matrices before contracting */
   void *data;
 };
 
@@ -345,6 +385,20 @@ struct CeedOperatorAssemblyData_private {
   CeedSize           **eval_mode_offsets_in, **eval_mode_offsets_out, num_output_components;
 };
 
+struct CeedOperatorElementAssemblyData_private {
+  Ceed                ceed;
+  bool                needs_data_update;
+  CeedInt             num_elem, num_blocks;
+  CeedInt             elem_size_in, num_comp_in, layout_in[3];
+  CeedInt             elem_size_out, num_comp_out, layout_out[3];
+  CeedScalar         *elem_mats;           /* Dense element matrices, interleaved across the elements of each block */
+  CeedScalar         *u_block, *v_block;   /* Interleaved element values of one block, sized for either apply direction */
+  const bool         *elem_mask;           /* Element mask of the operator, not owned, NULL for all elements */
+  uint64_t            galerkin_fine_state; /* Assembly data state of the fine operators when Galerkin element matrices were formed */
+  CeedElemRestriction rstr_in, rstr_out;
+  CeedVector          e_vec_in, e_vec_out;
+};
+
 struct CeedOperator_private {
   Ceed         ceed;
   CeedOperator op_fallback, op_fallback_parent;
@@ -358,37 +412,72 @@ struct CeedOperator_private {
   int (*LinearAssembleSymbolic)(CeedOperator, CeedSize *, CeedInt **, CeedInt **);
   int (*LinearAssemble)(CeedOperator, CeedVector);
   int (*LinearAssembleSingle)(CeedOperator, CeedInt, CeedVector);
+  int (*LinearAssembleSingleAddSparse)(CeedOperator, const CeedSize *, CeedVector);
+  int (*LinearAssembleSingleRange)(CeedOperator, CeedInt, CeedInt, CeedVector);
   int (*CreateFDMElementInverse)(CeedOperator, CeedOperator *, CeedRequest *);
   int (*Apply)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyComposite)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyAdd)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyAddComposite)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
+  int (*ApplyAddProduct)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
+  int (*ApplyAddMulti)(CeedOperator, CeedInt, CeedVector *, CeedVector *, CeedRequest *);
+  int (*ApplyAddScaled)(CeedOperator, CeedScalar, CeedVector, CeedVector, CeedRequest *);
+  int (*ApplyAddScaledComposite)(CeedOperator, CeedScalar, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyJacobian)(CeedOperator, CeedVector, CeedVector, CeedVector, CeedVector, CeedRequest *);
+  int (*SetElementMask)(CeedOperator, const bool *);
+  int (*View)(CeedOperator, bool, FILE *);
   int (*Destroy)(CeedOperator);
-  CeedOperatorField        *input_fields;
-  CeedOperatorField        *output_fields;
-  CeedSize                  input_size, output_size;
-  CeedInt                   num_elem;   /* Number of elements */
-  CeedInt                   num_qpts;   /* Number of quadrature points over all elements */
-  CeedInt                   num_fields; /* Number of fields that have been set */
-  CeedQFunction             qf;
-  CeedQFunction             dqf;
-  CeedQFunction             dqfT;
-  const char               *name;
-  bool                      is_immutable;
-  bool                      is_interface_setup;
-  bool                      is_backend_setup;
-  bool                      is_composite;
-  bool                      is_at_points;
-  bool                      has_restriction;
-  CeedQFunctionAssemblyData qf_assembled;
-  CeedOperatorAssemblyData  op_assembled;
-  CeedOperator             *sub_operators;
-  CeedInt                   num_suboperators;
-  void                     *data;
-  CeedInt                   num_context_labels;
-  CeedInt                   max_context_labels;
-  CeedContextFieldLabel    *context_labels;
-  CeedElemRestriction       rstr_points, first_points_rstr;
-  CeedVector                point_coords;
+  CeedOperatorField              *input_fields;
+  CeedOperatorField              *output_fields;
+  CeedSize                        input_size, output_size;
+  CeedInt                         num_elem;   /* Number of elements */
+  CeedInt                         num_qpts;   /* Number of quadrature points over all elements */
+  CeedInt                         num_fields; /* Number of fields that have been set */
+  CeedInt                         chunk_size; /* Number of elements per chunk of E-vector data, 0 for all elements */
+  CeedQFunction                   qf;
+  CeedQFunction                   dqf;
+  CeedQFunction                   dqfT;
+  const char                     *name;
+  bool                            is_immutable;
+  bool                            is_interface_setup;
+  bool                            is_backend_setup;
+  bool                            is_composite;
+  bool                            is_product;
+  bool                            is_at_points;
+  bool                            has_restriction;
+  CeedQFunctionAssemblyData       qf_assembled;
+  CeedOperatorAssemblyData        op_assembled;
+  bool                            use_elem_assembly;
+  bool                            is_symmetric;
+  bool                            use_fdm_shared_scaling;
+  bool                            use_galerkin_coarse;
+  CeedOperator                    op_galerkin_fine;      /* Fine operator for a Galerkin coarse operator P^T A P */
+  CeedBasis                       basis_galerkin_c_to_f; /* Coarse to fine prolongation basis for a Galerkin coarse operator */
+  uint64_t                        assembly_data_state;   /* Incremented each time the assembly data is marked for update */
+  CeedOperatorElementAssemblyData elem_assembled;
+  bool                           *elem_mask; /* Copy of the element mask, applied with element assembly */
+  CeedSparseAssembly              csr_assembled;
+  CeedSparseAssembly              bsr_assembled;
+  CeedOperator                   *sub_operators;
+  CeedInt                         num_suboperators;
+  CeedVector                      product_mid;  /* Intermediate L-vector for product operators applied through the interface */
+  CeedOperator                    op_transpose; /* Operator applying the transpose of the active action */
+  void                           *data;
+  CeedInt                         num_context_labels;
+  CeedInt                         max_context_labels;
+  CeedContextFieldLabel          *context_labels;
+  CeedElemRestriction             rstr_points, first_points_rstr;
+  CeedVector                      point_coords;
+};
+
+struct CeedMultigrid_private {
+  Ceed          ceed;
+  int           ref_count;
+  CeedInt       num_levels;
+  CeedInt       smoother_degree, coarse_degree; /* Chebyshev iterations per smoothing step and for the coarse solve */
+  CeedInt      *degrees;                        /* Polynomial degree on each level, level 0 is the fine level */
+  CeedScalar   *eig_max;                        /* Estimated largest eigenvalue of the Jacobi preconditioned operator on each level */
+  CeedOperator *ops;
+  CeedOperator *ops_prolong, *ops_restrict; /* Transfer between level l + 1 and level l */
+  CeedVector   *inv_diag, *x, *b, *r, *d;   /* Inverse diagonal and work vectors on each level, x and b are not owned on level 0 */
 };
@@ -28,6 +28,7 @@
 #define CEED_ALIGN 64
 #define CEED_COMPOSITE_MAX 16
 #define CEED_FIELD_MAX 16
+#define CEED_ELEM_ASSEMBLY_BLOCK_SIZE 8
 
 #ifndef CeedPragmaOptimizeOff
 #if defined(__clang__)
@@ -175,6 +176,22 @@ typedef struct CeedQFunctionAssemblyData_private *CeedQFunctionAssemblyData;
 /// @ingroup CeedOperator
 typedef struct CeedOperatorAssemblyData_private *CeedOperatorAssemblyData;
 
+/// Handle for object handling element assembled Operator data
+/// @ingroup CeedOperator
+typedef struct CeedOperatorElementAssemblyData_private *CeedOperatorElementAssemblyData;
+
+/// Backend function applying one block of a `CeedElemRestriction`, see @ref CeedElemRestrictionGetApplyBlockFunction()
+/// @ingroup CeedElemRestriction
+typedef int (*CeedElemRestrictionApplyBlockFunction)(CeedElemRestriction, CeedInt, CeedTransposeMode, CeedVector, CeedVector, CeedRequest *);
+
+/// Backend function applying a `CeedBasis`, see @ref CeedBasisGetApplyFunctions()
+/// @ingroup CeedBasis
+typedef int (*CeedBasisApplyFunction)(CeedBasis, CeedInt, CeedTransposeMode, CeedEvalMode, CeedVector, CeedVector);
+
+/// Backend function applying a `CeedQFunction`, see @ref CeedQFunctionGetApplyFunction()
+/// @ingroup CeedQFunction
+typedef int (*CeedQFunctionApplyFunction)(CeedQFunction, CeedInt, CeedVector *, CeedVector *);
+
 /* In the next 3 functions, p has to be the address of a pointer type, i.e. p has to be a pointer to a pointer. */
 CEED_INTERN int CeedMallocArray(size_t n, size_t unit, void *p);
 CEED_INTERN int CeedCallocArray(size_t n, size_t unit, void *p);
@@ -297,6 +314,7 @@ CEED_EXTERN int CeedElemRestrictionIsAtPoints(CeedElemRestriction rstr, bool *is
 CEED_EXTERN int CeedElemRestrictionAtPointsAreCompatible(CeedElemRestriction rstr_a, CeedElemRestriction rstr_b, bool *are_compatible);
 CEED_EXTERN int CeedElemRestrictionGetStrides(CeedElemRestriction rstr, CeedInt strides[3]);
 CEED_EXTERN int CeedElemRestrictionHasBackendStrides(CeedElemRestriction rstr, bool *has_backend_strides);
+CEED_EXTERN int CeedElemRestrictionIsElementShared(CeedElemRestriction rstr, bool *is_elem_shared);
 CEED_EXTERN int CeedElemRestrictionGetOffsets(CeedElemRestriction rstr, CeedMemType mem_type, const CeedInt **offsets);
 CEED_EXTERN int CeedElemRestrictionRestoreOffsets(CeedElemRestriction rstr, const CeedInt **offsets);
 CEED_EXTERN int CeedElemRestrictionGetOrientations(CeedElemRestriction rstr, CeedMemType mem_type, const bool **orients);
@@ -307,12 +325,14 @@ CEED_EXTERN int CeedElemRestrictionGetLLayout(CeedElemRestriction rstr, CeedInt
 CEED_EXTERN int CeedElemRestrictionSetLLayout(CeedElemRestriction rstr, CeedInt layout[3]);
 CEED_EXTERN int CeedElemRestrictionGetELayout(CeedElemRestriction rstr, CeedInt layout[3]);
 CEED_EXTERN int CeedElemRestrictionSetELayout(CeedElemRestriction rstr, CeedInt layout[3]);
+CEED_EXTERN int CeedElemRestrictionGetApplyBlockFunction(CeedElemRestriction rstr, CeedElemRestrictionApplyBlockFunction *apply_block);
 CEED_EXTERN int CeedElemRestrictionGetAtPointsElementOffset(CeedElemRestriction rstr, CeedInt elem, CeedSize *elem_offset);
 CEED_EXTERN int CeedElemRestrictionSetAtPointsEVectorSize(CeedElemRestriction rstr, CeedSize e_size);
 CEED_EXTERN int CeedElemRestrictionGetData(CeedElemRestriction rstr, void *data);
 CEED_EXTERN int CeedElemRestrictionSetData(CeedElemRestriction rstr, void *data);
 CEED_EXTERN int CeedElemRestrictionReference(CeedElemRestriction rstr);
 CEED_EXTERN int CeedElemRestrictionGetFlopsEstimate(CeedElemRestriction rstr, CeedTransposeMode t_mode, CeedSize *flops);
+CEED_EXTERN int CeedElemRestrictionGetBlocked(CeedElemRestriction rstr, CeedInt block_size, CeedElemRestriction *block_rstr);
 
 /**
   Specify type of FE space.
@@ -336,6 +356,7 @@ CEED_EXTERN int CeedBasisIsTensor(CeedBasis basis, bool *is_tensor);
 CEED_EXTERN int CeedBasisIsCollocated(CeedBasis basis, bool *is_collocated);
 CEED_EXTERN int CeedBasisGetData(CeedBasis basis, void *data);
 CEED_EXTERN int CeedBasisSetData(CeedBasis basis, void *data);
+CEED_EXTERN int CeedBasisGetApplyFunctions(CeedBasis basis, CeedBasisApplyFunction *apply, CeedBasisApplyFunction *apply_add);
 CEED_EXTERN int CeedBasisReference(CeedBasis basis);
 CEED_EXTERN int CeedBasisGetNumQuadratureComponents(CeedBasis basis, CeedEvalMode eval_mode, CeedInt *q_comp);
 CEED_EXTERN int CeedBasisGetFlopsEstimate(CeedBasis basis, CeedTransposeMode t_mode, CeedEvalMode eval_mode, bool is_at_points, CeedInt num_points,
@@ -358,6 +379,8 @@ CEED_EXTERN int  CeedTensorContractGetCeed(CeedTensorContract contract, Ceed *ce
 CEED_EXTERN Ceed CeedTensorContractReturnCeed(CeedTensorContract contract);
 CEED_EXTERN int  CeedTensorContractGetData(CeedTensorContract contract, void *data);
 CEED_EXTERN int  CeedTensorContractSetData(CeedTensorContract contract, void *data);
+CEED_EXTERN int  CeedTensorContractGetUseEvenOdd(CeedTensorContract contract, bool *use_even_odd);
+CEED_EXTERN int  CeedTensorContractSetUseEvenOdd(CeedTensorContract contract, bool use_even_odd);
 CEED_EXTERN int  CeedTensorContractReference(CeedTensorContract contract);
 CEED_EXTERN int  CeedTensorContractReferenceCopy(CeedTensorContract tensor, CeedTensorContract *tensor_copy);
 CEED_EXTERN int  CeedTensorContractDestroy(CeedTensorContract *contract);
@@ -382,6 +405,7 @@ CEED_EXTERN int CeedQFunctionIsIdentity(CeedQFunction qf, bool *is_identity);
 CEED_EXTERN int CeedQFunctionIsContextWritable(CeedQFunction qf, bool *is_writable);
 CEED_EXTERN int CeedQFunctionGetData(CeedQFunction qf, void *data);
 CEED_EXTERN int CeedQFunctionSetData(CeedQFunction qf, void *data);
+CEED_EXTERN int CeedQFunctionGetApplyFunction(CeedQFunction qf, CeedQFunctionApplyFunction *apply);
 CEED_EXTERN int CeedQFunctionIsImmutable(CeedQFunction qf, bool *is_immutable);
 CEED_EXTERN int CeedQFunctionSetImmutable(CeedQFunction qf);
 CEED_EXTERN int CeedQFunctionReference(CeedQFunction qf);
@@ -423,6 +447,7 @@ CEED_EXTERN int CeedOperatorGetQFunctionAssemblyData(CeedOperator op, CeedQFunct
 CEED_EXTERN int CeedQFunctionAssemblyDataCreate(Ceed ceed, CeedQFunctionAssemblyData *data);
 CEED_EXTERN int CeedQFunctionAssemblyDataReference(CeedQFunctionAssemblyData data);
 CEED_EXTERN int CeedQFunctionAssemblyDataSetReuse(CeedQFunctionAssemblyData data, bool reuse_assembly_data);
+CEED_EXTERN int CeedQFunctionAssemblyDataIsReuse(CeedQFunctionAssemblyData data, bool *reuse_data);
 CEED_EXTERN int CeedQFunctionAssemblyDataSetUpdateNeeded(CeedQFunctionAssemblyData data, bool needs_data_update);
 CEED_EXTERN int CeedQFunctionAssemblyDataIsUpdateNeeded(CeedQFunctionAssemblyData data, bool *is_update_needed);
 CEED_EXTERN int CeedQFunctionAssemblyDataReferenceCopy(CeedQFunctionAssemblyData data, CeedQFunctionAssemblyData *data_copy);
@@ -446,6 +471,13 @@ CEED_EXTERN int CeedOperatorAssemblyDataGetElemRestrictions(CeedOperatorAssembly
                                                             CeedElemRestriction **active_elem_rstrs_out);
 CEED_EXTERN int CeedOperatorAssemblyDataDestroy(CeedOperatorAssemblyData *data);
 
+CEED_EXTERN int CeedOperatorGetElementAssemblyData(CeedOperator op, CeedOperatorElementAssemblyData *data);
+CEED_EXTERN int CeedOperatorElementAssemblyDataCreate(Ceed ceed, CeedOperator op, CeedOperatorElementAssemblyData *data);
+CEED_EXTERN int CeedOperatorElementAssemblyDataSetUpdateNeeded(CeedOperatorElementAssemblyData data, bool needs_data_update);
+CEED_EXTERN int CeedOperatorElementAssemblyDataApplyAdd(CeedOperatorElementAssemblyData data, bool is_transpose, CeedScalar alpha, CeedVector in,
+                                                        CeedVector out);
+CEED_EXTERN int CeedOperatorElementAssemblyDataDestroy(CeedOperatorElementAssemblyData *data);
+
 CEED_EXTERN int CeedOperatorGetActiveBasis(CeedOperator op, CeedBasis *active_basis);
 CEED_EXTERN int CeedOperatorGetActiveBases(CeedOperator op, CeedBasis *active_input_basis, CeedBasis *active_output_basis);
 CEED_EXTERN int CeedOperatorGetActiveElemRestriction(CeedOperator op, CeedElemRestriction *active_rstr);
@@ -455,8 +487,13 @@ CEED_EXTERN int CeedOperatorGetNumArgs(CeedOperator op, CeedInt *num_args);
 CEED_EXTERN int CeedOperatorHasTensorBases(CeedOperator op, bool *has_tensor_bases);
 CEED_EXTERN int CeedOperatorIsImmutable(CeedOperator op, bool *is_immutable);
 CEED_EXTERN int CeedOperatorIsSetupDone(CeedOperator op, bool *is_setup_done);
+CEED_EXTERN int CeedOperatorGetChunkSize(CeedOperator op, CeedInt *chunk_size);
 CEED_EXTERN int CeedOperatorGetQFunction(CeedOperator op, CeedQFunction *qf);
+CEED_EXTERN int CeedOperatorGetDQFunction(CeedOperator op, CeedQFunction *dqf);
+CEED_EXTERN int CeedOperatorGetDQFunctionTranspose(CeedOperator op, CeedQFunction *dqfT);
 CEED_EXTERN int CeedOperatorIsComposite(CeedOperator op, bool *is_composite);
+CEED_EXTERN int CeedOperatorIsProduct(CeedOperator op, bool *is_product);
+CEED_EXTERN int CeedOperatorProductGetIntermediateVector(CeedOperator op, CeedVector *mid);
 CEED_EXTERN int CeedOperatorGetData(CeedOperator op, void *data);
 CEED_EXTERN int CeedOperatorSetData(CeedOperator op, void *data);
 CEED_EXTERN int CeedOperatorReference(CeedOperator op);
@@ -99,6 +99,9 @@ typedef struct CeedContextFieldLabel_private *CeedContextFieldLabel;
 /// Given an element restriction \f$E\f$, basis evaluator \f$B\f$, and quadrature function\f$f\f$, a `CeedOperator` expresses operations of the form \f$E^T B^T f(B E u)\f$ acting on the vector \f$u\f$.
 /// @ingroup CeedOperatorUser
 typedef struct CeedOperator_private *CeedOperator;
+/// Handle for object describing a p-multigrid hierarchy built from a `CeedOperator`
+/// @ingroup CeedOperatorUser
+typedef struct CeedMultigrid_private *CeedMultigrid;
 
 CEED_EXTERN int CeedRegistryGetList(size_t *n, char ***const resources, CeedInt **array);
 CEED_EXTERN int CeedInit(const char *resource, Ceed *ceed);
@@ -106,6 +109,8 @@ CEED_EXTERN int CeedSetStream(Ceed ceed, void *handle);
 CEED_EXTERN int CeedReferenceCopy(Ceed ceed, Ceed *ceed_copy);
 CEED_EXTERN int CeedGetResource(Ceed ceed, const char **resource);
 CEED_EXTERN int CeedIsDeterministic(Ceed ceed, bool *is_deterministic);
+CEED_EXTERN int CeedSetObjectCaching(Ceed ceed, bool is_object_caching);
+CEED_EXTERN int CeedIsObjectCaching(Ceed ceed, bool *is_object_caching);
 CEED_EXTERN int CeedAddJitSourceRoot(Ceed ceed, const char *jit_source_root);
 CEED_EXTERN int CeedAddRustSourceRoot(Ceed ceed, const char *rust_source_root);
 CEED_EXTERN int CeedAddJitDefine(Ceed ceed, const char *jit_define);
@@ -277,6 +282,10 @@ CEED_EXTERN int  CeedElemRestrictionApplyAtPointsInElement(CeedElemRestriction r
                                                            CeedVector ru, CeedRequest *request);
 CEED_EXTERN int  CeedElemRestrictionApplyBlock(CeedElemRestriction rstr, CeedInt block, CeedTransposeMode t_mode, CeedVector u, CeedVector ru,
                                                CeedRequest *request);
+CEED_EXTERN int  CeedElemRestrictionApplyRange(CeedElemRestriction rstr, CeedInt start_block, CeedInt stop_block, CeedTransposeMode t_mode,
+                                               CeedVector u, CeedVector ru, CeedRequest *request);
+CEED_EXTERN int  CeedElemRestrictionApplyRangeScaled(CeedElemRestriction rstr, CeedInt start_block, CeedInt stop_block, CeedScalar alpha,
+                                                     CeedVector u, CeedVector ru, CeedRequest *request);
 CEED_EXTERN int  CeedElemRestrictionGetCeed(CeedElemRestriction rstr, Ceed *ceed);
 CEED_EXTERN Ceed CeedElemRestrictionReturnCeed(CeedElemRestriction rstr);
 CEED_EXTERN int  CeedElemRestrictionGetCompStride(CeedElemRestriction rstr, CeedInt *comp_stride);
@@ -413,6 +422,7 @@ CEED_EXTERN int CeedQFunctionContextDestroy(CeedQFunctionContext *ctx);
 CEED_EXTERN int CeedOperatorCreate(Ceed ceed, CeedQFunction qf, CeedQFunction dqf, CeedQFunction dqfT, CeedOperator *op);
 CEED_EXTERN int CeedOperatorCreateAtPoints(Ceed ceed, CeedQFunction qf, CeedQFunction dqf, CeedQFunction dqfT, CeedOperator *op);
 CEED_EXTERN int CeedCompositeOperatorCreate(Ceed ceed, CeedOperator *op);
+CEED_EXTERN int CeedOperatorCreateProduct(Ceed ceed, CeedOperator op_outer, CeedOperator op_inner, CeedOperator *op);
 CEED_EXTERN int CeedOperatorReferenceCopy(CeedOperator op, CeedOperator *op_copy);
 CEED_EXTERN int CeedOperatorSetField(CeedOperator op, const char *field_name, CeedElemRestriction rstr, CeedBasis basis, CeedVector vec);
 CEED_EXTERN int CeedOperatorGetFields(CeedOperator op, CeedInt *num_input_fields, CeedOperatorField **input_fields, CeedInt *num_output_fields,
@@ -428,6 +438,11 @@ CEED_EXTERN int  CeedCompositeOperatorGetSubByName(CeedOperator op, const char *
 CEED_EXTERN int  CeedOperatorCheckReady(CeedOperator op);
 CEED_EXTERN int  CeedOperatorGetActiveVectorLengths(CeedOperator op, CeedSize *input_size, CeedSize *output_size);
 CEED_EXTERN int  CeedOperatorSetQFunctionAssemblyReuse(CeedOperator op, bool reuse_assembly_data);
+CEED_EXTERN int  CeedOperatorSetChunkSize(CeedOperator op, CeedInt chunk_size);
+CEED_EXTERN int  CeedOperatorSetElementMask(CeedOperator op, const bool *mask);
+CEED_EXTERN int  CeedOperatorSetElementAssembly(CeedOperator op, bool use_elem_assembly);
+CEED_EXTERN int  CeedOperatorSetSymmetric(CeedOperator op, bool is_symmetric);
+CEED_EXTERN int  CeedOperatorIsSymmetric(CeedOperator op, bool *is_symmetric);
 CEED_EXTERN int  CeedOperatorSetQFunctionAssemblyDataUpdateNeeded(CeedOperator op, bool needs_data_update);
 CEED_EXTERN int  CeedOperatorLinearAssembleQFunction(CeedOperator op, CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request);
 CEED_EXTERN int  CeedOperatorLinearAssembleQFunctionBuildOrUpdate(CeedOperator op, CeedVector *assembled, CeedElemRestriction *rstr,
@@ -439,7 +454,14 @@ CEED_EXTERN int  CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op
 CEED_EXTERN int  CeedOperatorLinearAssemblePointBlockDiagonalSymbolic(CeedOperator op, CeedSize *num_entries, CeedInt **rows, CeedInt **cols);
 CEED_EXTERN int  CeedOperatorLinearAssembleSymbolic(CeedOperator op, CeedSize *num_entries, CeedInt **rows, CeedInt **cols);
 CEED_EXTERN int  CeedOperatorLinearAssemble(CeedOperator op, CeedVector values);
+CEED_EXTERN int  CeedOperatorLinearAssembleSymbolicCSR(CeedOperator op, CeedSize *num_rows, CeedSize **row_offsets, CeedInt **col_indices);
+CEED_EXTERN int  CeedOperatorLinearAssembleCSR(CeedOperator op, CeedVector values);
+CEED_EXTERN int  CeedOperatorLinearAssembleSymbolicBSR(CeedOperator op, CeedInt *block_size, CeedSize *num_block_rows, CeedSize **row_offsets,
+                                                       CeedInt **col_indices);
+CEED_EXTERN int  CeedOperatorLinearAssembleBSR(CeedOperator op, CeedVector values);
+CEED_EXTERN int  CeedOperatorGetElementAssemblyMemory(CeedOperator op, CeedSize *num_bytes);
 CEED_EXTERN int  CeedCompositeOperatorGetMultiplicity(CeedOperator op, CeedInt num_skip_indices, CeedInt *skip_indices, CeedVector mult);
+CEED_EXTERN int  CeedOperatorSetMultigridGalerkin(CeedOperator op, bool use_galerkin);
 CEED_EXTERN int  CeedOperatorMultigridLevelCreate(CeedOperator op_fine, CeedVector p_mult_fine, CeedElemRestriction rstr_coarse,
                                                   CeedBasis basis_coarse, CeedOperator *op_coarse, CeedOperator *op_prolong,
                                                   CeedOperator *op_restrict);
@@ -449,7 +471,9 @@ CEED_EXTERN int  CeedOperatorMultigridLevelCreateTensorH1(CeedOperator op_fine,
 CEED_EXTERN int  CeedOperatorMultigridLevelCreateH1(CeedOperator op_fine, CeedVector p_mult_fine, CeedElemRestriction rstr_coarse,
                                                     CeedBasis basis_coarse, const CeedScalar *interp_c_to_f, CeedOperator *op_coarse,
                                                     CeedOperator *op_prolong, CeedOperator *op_restrict);
+CEED_EXTERN int  CeedOperatorSetFDMSharedScaling(CeedOperator op, bool use_shared_scaling);
 CEED_EXTERN int  CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv, CeedRequest *request);
+CEED_EXTERN int  CeedOperatorCreatePointBlockJacobi(CeedOperator op, CeedOperator *pbj_inv, CeedRequest *request);
 CEED_EXTERN int  CeedOperatorSetName(CeedOperator op, const char *name);
 CEED_EXTERN int  CeedOperatorGetName(CeedOperator op, const char **name);
 CEED_EXTERN int  CeedOperatorView(CeedOperator op, FILE *stream);
@@ -473,9 +497,24 @@ CEED_EXTERN int  CeedOperatorRestoreContextBooleanRead(CeedOperator op, CeedCont
 CEED_EXTERN int  CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request);
 CEED_EXTERN int  CeedOperatorApplyAdd(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request);
 CEED_EXTERN int  CeedOperatorApplyAddActive(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request);
+CEED_EXTERN int  CeedOperatorApplyMulti(CeedOperator op, CeedInt num_vecs, CeedVector *in, CeedVector *out, CeedRequest *request);
+CEED_EXTERN int  CeedOperatorApplyAddMulti(CeedOperator op, CeedInt num_vecs, CeedVector *in, CeedVector *out, CeedRequest *request);
+CEED_EXTERN int  CeedOperatorApplyScaled(CeedOperator op, CeedScalar alpha, CeedVector in, CeedScalar beta, CeedVector out, CeedRequest *request);
+CEED_EXTERN int  CeedOperatorApplyAddScaled(CeedOperator op, CeedScalar alpha, CeedVector in, CeedVector out, CeedRequest *request);
+CEED_EXTERN int  CeedOperatorApplyTranspose(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request);
+CEED_EXTERN int  CeedOperatorApplyAddTranspose(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request);
 CEED_EXTERN int  CeedOperatorAssemblyDataStrip(CeedOperator op);
 CEED_EXTERN int  CeedOperatorDestroy(CeedOperator *op);
 
+CEED_EXTERN int CeedMultigridCreate(CeedOperator op_fine, CeedMultigrid *mg);
+CEED_EXTERN int CeedMultigridReferenceCopy(CeedMultigrid mg, CeedMultigrid *mg_copy);
+CEED_EXTERN int CeedMultigridSetSmootherDegree(CeedMultigrid mg, CeedInt degree);
+CEED_EXTERN int CeedMultigridSetCoarseDegree(CeedMultigrid mg, CeedInt degree);
+CEED_EXTERN int CeedMultigridGetNumLevels(CeedMultigrid mg, CeedInt *num_levels);
+CEED_EXTERN int CeedMultigridGetLevelOperator(CeedMultigrid mg, CeedInt level, CeedOperator *op);
+CEED_EXTERN int CeedMultigridApply(CeedMultigrid mg, CeedVector b, CeedVector x);
+CEED_EXTERN int CeedMultigridDestroy(CeedMultigrid *mg);
+
 CEED_EXTERN int CeedOperatorGetFieldByName(CeedOperator op, const char *field_name, CeedOperatorField *op_field);
 CEED_EXTERN int CeedOperatorFieldGetName(CeedOperatorField op_field, const char **field_name);
 CEED_EXTERN int CeedOperatorFieldGetElemRestriction(CeedOperatorField op_field, CeedElemRestriction *rstr);
@@ -0,0 +1,48 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+/**
+  @brief  QFunction applying the transpose of a linearized QFunction at each quadrature point
+**/
+#include <ceed/types.h>
+
+typedef struct {
+  CeedInt num_in, num_out;
+  CeedInt sizes_in[16], sizes_out[16];  // Field sizes, up to CEED_FIELD_MAX fields
+} AssembledTransposeCtx;
+
+CEED_QFUNCTION(AssembledTranspose)(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {
+  // Ctx holds number and sizes of active fields
+  const AssembledTransposeCtx *transpose_ctx = (AssembledTransposeCtx *)ctx;
+  const CeedInt                num_in        = transpose_ctx->num_in;
+  const CeedInt                num_out       = transpose_ctx->num_out;
+  CeedInt                      size_in       = 0;
+
+  for (CeedInt f = 0; f < num_in; f++) size_in += transpose_ctx->sizes_in[f];
+
+  // in[0] is linearized QFunction, size (Q*size_out*size_in), with component (j*size_in + i) coupling input i to output j of the transpose
+  // in[1], ..., in[num_in] are active inputs, size (Q*sizes_in[f])
+  const CeedScalar *q_data = in[0];
+  // out[0], ..., out[num_out - 1] are active outputs, size (Q*sizes_out[f])
+
+  for (CeedInt f_out = 0, j = 0; f_out < num_out; f_out++) {
+    for (CeedInt c_out = 0; c_out < transpose_ctx->sizes_out[f_out]; c_out++, j++) {
+      // Quadrature point loop
+      CeedPragmaSIMD for (CeedInt q = 0; q < Q; q++) {
+        CeedScalar sum = 0.0;
+
+        for (CeedInt f_in = 0, i = 0; f_in < num_in; f_in++) {
+          for (CeedInt c_in = 0; c_in < transpose_ctx->sizes_in[f_in]; c_in++, i++) {
+            sum += q_data[(j * size_in + i) * Q + q] * in[f_in + 1][c_in * Q + q];
+          }
+        }
+        out[f_out][c_out * Q + q] = sum;
+      }  // End of Quadrature Point Loop
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
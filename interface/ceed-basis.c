@@ -646,6 +646,64 @@ static int CeedBasisApplyAtPoints_Core(CeedBasis basis, bool apply_add, CeedInt
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Look up a tensor-product \f$H^1\f$ `CeedBasis` with identical parameters and data in the object cache of a `Ceed` context
+
+  @param[in]  ceed        `Ceed` context creating the `CeedBasis`
+  @param[in]  dim         Topological dimension
+  @param[in]  num_comp    Number of field components
+  @param[in]  P_1d        Number of nodes in one dimension
+  @param[in]  Q_1d        Number of quadrature points in one dimension
+  @param[in]  interp_1d   Row-major (`Q_1d * P_1d`) interpolation matrix
+  @param[in]  grad_1d     Row-major (`Q_1d * P_1d`) gradient matrix
+  @param[in]  q_ref_1d    Array of length `Q_1d` holding the quadrature points
+  @param[in]  q_weight_1d Array of length `Q_1d` holding the quadrature weights
+  @param[out] hash        Variable to store content hash, 0 if object caching is disabled
+  @param[out] basis       Address of the variable to store the cached `CeedBasis`, `NULL` if none found
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBasisGetCachedTensorH1(Ceed ceed, CeedInt dim, CeedInt num_comp, CeedInt P_1d, CeedInt Q_1d, const CeedScalar *interp_1d,
+                                      const CeedScalar *grad_1d, const CeedScalar *q_ref_1d, const CeedScalar *q_weight_1d, uint64_t *hash,
+                                      CeedBasis *basis) {
+  bool is_object_caching;
+
+  *hash  = 0;
+  *basis = NULL;
+  CeedCall(CeedIsObjectCaching(ceed, &is_object_caching));
+  if (!is_object_caching || !interp_1d || !grad_1d || !q_ref_1d || !q_weight_1d) return CEED_ERROR_SUCCESS;
+
+  // Hash parameters and data
+  {
+    const CeedInt params[4] = {dim, num_comp, P_1d, Q_1d};
+
+    CeedCall(CeedHashData(params, sizeof(params), hash));
+    CeedCall(CeedHashData(interp_1d, Q_1d * P_1d * sizeof(interp_1d[0]), hash));
+    CeedCall(CeedHashData(grad_1d, Q_1d * P_1d * sizeof(grad_1d[0]), hash));
+    CeedCall(CeedHashData(q_ref_1d, Q_1d * sizeof(q_ref_1d[0]), hash));
+    CeedCall(CeedHashData(q_weight_1d, Q_1d * sizeof(q_weight_1d[0]), hash));
+  }
+
+  // Find identical basis
+  if (!ceed->object_cache) return CEED_ERROR_SUCCESS;
+  for (CeedInt i = 0; i < ceed->object_cache->num_bases; i++) {
+    CeedBasis basis_cached = ceed->object_cache->bases[i];
+
+    if (basis_cached->cache_hash == *hash && basis_cached->is_tensor_basis && basis_cached->fe_space == CEED_FE_SPACE_H1 &&
+        basis_cached->dim == dim && basis_cached->num_comp == num_comp && basis_cached->P_1d == P_1d && basis_cached->Q_1d == Q_1d &&
+        !memcmp(basis_cached->interp_1d, interp_1d, Q_1d * P_1d * sizeof(interp_1d[0])) &&
+        !memcmp(basis_cached->grad_1d, grad_1d, Q_1d * P_1d * sizeof(grad_1d[0])) &&
+        !memcmp(basis_cached->q_ref_1d, q_ref_1d, Q_1d * sizeof(q_ref_1d[0])) &&
+        !memcmp(basis_cached->q_weight_1d, q_weight_1d, Q_1d * sizeof(q_weight_1d[0]))) {
+      CeedCall(CeedBasisReferenceCopy(basis_cached, basis));
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -821,6 +879,27 @@ int CeedBasisGetData(CeedBasis basis, void *data) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the backend functions applying a `CeedBasis`.
+
+  Backends may resolve these functions once at setup and call them in element block loops.
+  The functions skip the dimension checks of @ref CeedBasisApply() and @ref CeedBasisApplyAdd(), so the caller is responsible for them.
+
+  @param[in]  basis     `CeedBasis`
+  @param[out] apply     Variable to store backend function for @ref CeedBasisApply()
+  @param[out] apply_add Variable to store backend function for @ref CeedBasisApplyAdd(), or `NULL` if the backend does not implement it
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedBasisGetApplyFunctions(CeedBasis basis, CeedBasisApplyFunction *apply, CeedBasisApplyFunction *apply_add) {
+  CeedCheck(basis->Apply, CeedBasisReturnCeed(basis), CEED_ERROR_UNSUPPORTED, "Backend does not support CeedBasisApply");
+  *apply     = basis->Apply;
+  *apply_add = basis->ApplyAdd;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Set backend data of a `CeedBasis`
 
@@ -1505,6 +1584,8 @@ CeedPragmaOptimizeOn
 **/
 int CeedBasisCreateTensorH1(Ceed ceed, CeedInt dim, CeedInt num_comp, CeedInt P_1d, CeedInt Q_1d, const CeedScalar *interp_1d,
                             const CeedScalar *grad_1d, const CeedScalar *q_ref_1d, const CeedScalar *q_weight_1d, CeedBasis *basis) {
+  uint64_t hash;
+
   if (!ceed->BasisCreateTensorH1) {
     Ceed delegate;
 
@@ -1520,11 +1601,15 @@ int CeedBasisCreateTensorH1(Ceed ceed, CeedInt dim, CeedInt num_comp, CeedInt P_
   CeedCheck(P_1d > 0, ceed, CEED_ERROR_DIMENSION, "CeedBasis must have at least 1 node");
   CeedCheck(Q_1d > 0, ceed, CEED_ERROR_DIMENSION, "CeedBasis must have at least 1 quadrature point");
 
+  CeedCall(CeedBasisGetCachedTensorH1(ceed, dim, num_comp, P_1d, Q_1d, interp_1d, grad_1d, q_ref_1d, q_weight_1d, &hash, basis));
+  if (*basis) return CEED_ERROR_SUCCESS;
+
   CeedElemTopology topo = dim == 1 ? CEED_TOPOLOGY_LINE : dim == 2 ? CEED_TOPOLOGY_QUAD : CEED_TOPOLOGY_HEX;
 
   CeedCall(CeedCalloc(1, basis));
   CeedCall(CeedReferenceCopy(ceed, &(*basis)->ceed));
   (*basis)->ref_count       = 1;
+  (*basis)->cache_hash      = hash;
   (*basis)->is_tensor_basis = true;
   (*basis)->dim             = dim;
   (*basis)->topo            = topo;
@@ -1543,6 +1628,7 @@ int CeedBasisCreateTensorH1(Ceed ceed, CeedInt dim, CeedInt num_comp, CeedInt P_
   if (interp_1d) memcpy((*basis)->interp_1d, interp_1d, Q_1d * P_1d * sizeof(interp_1d[0]));
   if (grad_1d) memcpy((*basis)->grad_1d, grad_1d, Q_1d * P_1d * sizeof(grad_1d[0]));
   CeedCall(ceed->BasisCreateTensorH1(dim, P_1d, Q_1d, interp_1d, grad_1d, q_ref_1d, q_weight_1d, *basis));
+  if (hash) CeedCall(CeedObjectCacheAddBasis(ceed, *basis));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -2407,6 +2493,7 @@ int CeedBasisDestroy(CeedBasis *basis) {
     *basis = NULL;
     return CEED_ERROR_SUCCESS;
   }
+  if ((*basis)->cache_hash) CeedCall(CeedObjectCacheRemoveBasis((*basis)->ceed, *basis));
   if ((*basis)->Destroy) CeedCall((*basis)->Destroy(*basis));
   CeedCall(CeedTensorContractDestroy(&(*basis)->contract));
   CeedCall(CeedFree(&(*basis)->q_ref_1d));
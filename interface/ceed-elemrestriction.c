@@ -98,6 +98,112 @@ int CeedPermutePadCurlOrients(const CeedInt8 *curl_orients, CeedInt8 *block_curl
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Look up a `CeedElemRestriction` with identical parameters and data in the object cache of a `Ceed` context.
+
+  Blocked restrictions are compared by their permuted and padded data.
+
+  @param[in]  ceed         `Ceed` context creating the `CeedElemRestriction`
+  @param[in]  rstr_type    Type of `CeedElemRestriction`
+  @param[in]  num_elem     Number of elements
+  @param[in]  elem_size    Size (number of "nodes") per element
+  @param[in]  block_size   Number of elements in a block
+  @param[in]  num_comp     Number of field components per interpolation node
+  @param[in]  comp_stride  Stride between components for the same L-vector "node"
+  @param[in]  l_size       The size of the L-vector
+  @param[in]  mem_type     Memory type of the data arrays
+  @param[in]  offsets      Offsets array of shape `[num_block * block_size, elem_size]`, or `NULL`
+  @param[in]  orients      Orientations array of shape `[num_block * block_size, elem_size]`, or `NULL`
+  @param[in]  curl_orients Curl-conforming orientations array of shape `[num_block * block_size, 3 * elem_size]`, or `NULL`
+  @param[in]  strides      Array of strides, or `NULL`
+  @param[out] hash         Variable to store content hash, 0 if object caching is disabled
+  @param[out] rstr         Address of the variable to store the cached `CeedElemRestriction`, `NULL` if none found
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedElemRestrictionGetCached(Ceed ceed, CeedRestrictionType rstr_type, CeedInt num_elem, CeedInt elem_size, CeedInt block_size,
+                                        CeedInt num_comp, CeedInt comp_stride, CeedSize l_size, CeedMemType mem_type, const CeedInt *offsets,
+                                        const bool *orients, const CeedInt8 *curl_orients, const CeedInt *strides, uint64_t *hash,
+                                        CeedElemRestriction *rstr) {
+  bool           is_object_caching;
+  const CeedInt  num_block   = (num_elem / block_size) + !!(num_elem % block_size);
+  const CeedSize num_offsets = (CeedSize)num_block * (CeedSize)block_size * (CeedSize)elem_size;
+
+  *hash = 0;
+  *rstr = NULL;
+  CeedCall(CeedIsObjectCaching(ceed, &is_object_caching));
+  if (!is_object_caching || mem_type != CEED_MEM_HOST) return CEED_ERROR_SUCCESS;
+
+  // Hash parameters and data
+  {
+    const CeedInt params[6] = {(CeedInt)rstr_type, num_elem, elem_size, block_size, num_comp, comp_stride};
+
+    CeedCall(CeedHashData(params, sizeof(params), hash));
+    CeedCall(CeedHashData(&l_size, sizeof(l_size), hash));
+    if (offsets) CeedCall(CeedHashData(offsets, num_offsets * sizeof(offsets[0]), hash));
+    if (orients) CeedCall(CeedHashData(orients, num_offsets * sizeof(orients[0]), hash));
+    if (curl_orients) CeedCall(CeedHashData(curl_orients, 3 * num_offsets * sizeof(curl_orients[0]), hash));
+    if (strides) CeedCall(CeedHashData(strides, 3 * sizeof(strides[0]), hash));
+  }
+
+  // Find identical restriction
+  if (!ceed->object_cache) return CEED_ERROR_SUCCESS;
+  for (CeedInt i = 0; i < ceed->object_cache->num_rstrs; i++) {
+    bool                is_match;
+    CeedElemRestriction rstr_cached = ceed->object_cache->rstrs[i];
+
+    is_match = rstr_cached->cache_hash == *hash && rstr_cached->rstr_type == rstr_type && rstr_cached->num_elem == num_elem &&
+               rstr_cached->elem_size == elem_size && rstr_cached->block_size == block_size && rstr_cached->num_comp == num_comp &&
+               rstr_cached->comp_stride == comp_stride && rstr_cached->l_size == l_size;
+    if (is_match && offsets) {
+      const CeedInt *offsets_cached;
+
+      CeedCall(CeedElemRestrictionGetOffsets(rstr_cached, CEED_MEM_HOST, &offsets_cached));
+      is_match = !memcmp(offsets, offsets_cached, num_offsets * sizeof(offsets[0]));
+      CeedCall(CeedElemRestrictionRestoreOffsets(rstr_cached, &offsets_cached));
+    }
+    if (is_match && orients) {
+      const bool *orients_cached;
+
+      CeedCall(CeedElemRestrictionGetOrientations(rstr_cached, CEED_MEM_HOST, &orients_cached));
+      is_match = !memcmp(orients, orients_cached, num_offsets * sizeof(orients[0]));
+      CeedCall(CeedElemRestrictionRestoreOrientations(rstr_cached, &orients_cached));
+    }
+    if (is_match && curl_orients) {
+      const CeedInt8 *curl_orients_cached;
+
+      CeedCall(CeedElemRestrictionGetCurlOrientations(rstr_cached, CEED_MEM_HOST, &curl_orients_cached));
+      is_match = !memcmp(curl_orients, curl_orients_cached, 3 * num_offsets * sizeof(curl_orients[0]));
+      CeedCall(CeedElemRestrictionRestoreCurlOrientations(rstr_cached, &curl_orients_cached));
+    }
+    if (is_match && strides) is_match = !memcmp(strides, rstr_cached->strides, 3 * sizeof(strides[0]));
+    if (is_match) {
+      CeedCall(CeedElemRestrictionReferenceCopy(rstr_cached, rstr));
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Add a newly created `CeedElemRestriction` to the object cache of its `Ceed` context
+
+  @param[in,out] rstr `CeedElemRestriction` to add
+  @param[in]     hash Content hash from @ref CeedElemRestrictionGetCached(), 0 if object caching is disabled
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedElemRestrictionSetCached(CeedElemRestriction rstr, uint64_t hash) {
+  if (!hash) return CEED_ERROR_SUCCESS;
+  rstr->cache_hash = hash;
+  CeedCall(CeedObjectCacheAddElemRestriction(rstr->ceed, rstr));
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -225,6 +331,29 @@ int CeedElemRestrictionHasBackendStrides(CeedElemRestriction rstr, bool *has_bac
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Determine if all elements of a `CeedElemRestriction` restrict from the same L-vector entries
+
+  This is the case for strided restrictions with an element stride of 0, such as data shared between all elements.
+  Backends may store a single element block of the E-vector for such restrictions.
+
+  @param[in]  rstr           `CeedElemRestriction`
+  @param[out] is_elem_shared Variable to store shared element status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionIsElementShared(CeedElemRestriction rstr, bool *is_elem_shared) {
+  bool has_backend_strides;
+
+  *is_elem_shared = false;
+  if (!rstr->strides || rstr->num_elem <= 1) return CEED_ERROR_SUCCESS;
+  CeedCall(CeedElemRestrictionHasBackendStrides(rstr, &has_backend_strides));
+  *is_elem_shared = !has_backend_strides && rstr->strides[2] == 0;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get read-only access to a `CeedElemRestriction` offsets array by @ref CeedMemType
 
@@ -427,6 +556,25 @@ int CeedElemRestrictionSetELayout(CeedElemRestriction rstr, CeedInt layout[3]) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the backend function applying one block of a `CeedElemRestriction`.
+
+  Backends may resolve this function once at setup and call it in element block loops.
+  The function skips the vector length and block index checks of @ref CeedElemRestrictionApplyBlock(), so the caller is responsible for them.
+
+  @param[in]  rstr        `CeedElemRestriction`
+  @param[out] apply_block Variable to store backend function
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetApplyBlockFunction(CeedElemRestriction rstr, CeedElemRestrictionApplyBlockFunction *apply_block) {
+  CeedCheck(rstr->ApplyBlock, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_UNSUPPORTED, "Backend does not implement CeedElemRestrictionApplyBlock");
+  *apply_block = rstr->ApplyBlock;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
 
   @brief Get the E-vector element offset of a `CeedElemRestriction` at points
@@ -585,6 +733,92 @@ int CeedElemRestrictionGetFlopsEstimate(CeedElemRestriction rstr, CeedTransposeM
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get a blocked version of a `CeedElemRestriction`.
+
+  The blocked `CeedElemRestriction` is created on first use and stored on `rstr` by block size, so all `CeedOperator` sharing `rstr` share the permuted and padded data, including operators on backends with different block sizes.
+  Up to `CEED_ELEMRESTRICTION_BLOCKED_MAX` block sizes are stored; beyond that, the least recently created blocked copy is replaced.
+
+  Note: Caller is responsible for destroying the `block_rstr` with @ref CeedElemRestrictionDestroy().
+
+  @param[in]  rstr       `CeedElemRestriction`
+  @param[in]  block_size Number of elements in a block
+  @param[out] block_rstr Variable to store blocked `CeedElemRestriction`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetBlocked(CeedElemRestriction rstr, CeedInt block_size, CeedElemRestriction *block_rstr) {
+  CeedInt index = -1;
+
+  for (CeedInt i = 0; i < CeedIntMin(rstr->num_rstr_block, CEED_ELEMRESTRICTION_BLOCKED_MAX); i++) {
+    if (rstr->rstr_block[i]->block_size == block_size) index = i;
+  }
+  if (index == -1) {
+    CeedSize            l_size;
+    CeedInt             num_elem, elem_size, num_comp, comp_stride;
+    CeedRestrictionType rstr_type;
+
+    CeedCall(CeedElemRestrictionGetType(rstr, &rstr_type));
+    CeedCheck(rstr_type != CEED_RESTRICTION_POINTS, rstr->ceed, CEED_ERROR_UNSUPPORTED, "Cannot create blocked CeedElemRestriction at points");
+    // Use the next slot, replacing the least recently created blocked copy once the table is full
+    index = rstr->num_rstr_block % CEED_ELEMRESTRICTION_BLOCKED_MAX;
+    CeedCall(CeedElemRestrictionDestroy(&rstr->rstr_block[index]));
+    CeedCall(CeedElemRestrictionGetNumElements(rstr, &num_elem));
+    CeedCall(CeedElemRestrictionGetElementSize(rstr, &elem_size));
+    CeedCall(CeedElemRestrictionGetLVectorSize(rstr, &l_size));
+    CeedCall(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
+    CeedCall(CeedElemRestrictionGetCompStride(rstr, &comp_stride));
+    switch (rstr_type) {
+      case CEED_RESTRICTION_STANDARD: {
+        const CeedInt *offsets = NULL;
+
+        CeedCall(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
+        CeedCall(CeedElemRestrictionCreateBlocked(rstr->ceed, num_elem, elem_size, block_size, num_comp, comp_stride, l_size, CEED_MEM_HOST,
+                                                  CEED_COPY_VALUES, offsets, &rstr->rstr_block[index]));
+        CeedCall(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
+      } break;
+      case CEED_RESTRICTION_ORIENTED: {
+        const bool    *orients = NULL;
+        const CeedInt *offsets = NULL;
+
+        CeedCall(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
+        CeedCall(CeedElemRestrictionGetOrientations(rstr, CEED_MEM_HOST, &orients));
+        CeedCall(CeedElemRestrictionCreateBlockedOriented(rstr->ceed, num_elem, elem_size, block_size, num_comp, comp_stride, l_size, CEED_MEM_HOST,
+                                                          CEED_COPY_VALUES, offsets, orients, &rstr->rstr_block[index]));
+        CeedCall(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
+        CeedCall(CeedElemRestrictionRestoreOrientations(rstr, &orients));
+      } break;
+      case CEED_RESTRICTION_CURL_ORIENTED: {
+        const CeedInt8 *curl_orients = NULL;
+        const CeedInt  *offsets      = NULL;
+
+        CeedCall(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
+        CeedCall(CeedElemRestrictionGetCurlOrientations(rstr, CEED_MEM_HOST, &curl_orients));
+        CeedCall(CeedElemRestrictionCreateBlockedCurlOriented(rstr->ceed, num_elem, elem_size, block_size, num_comp, comp_stride, l_size,
+                                                              CEED_MEM_HOST, CEED_COPY_VALUES, offsets, curl_orients, &rstr->rstr_block[index]));
+        CeedCall(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
+        CeedCall(CeedElemRestrictionRestoreCurlOrientations(rstr, &curl_orients));
+      } break;
+      case CEED_RESTRICTION_STRIDED: {
+        CeedInt strides[3];
+
+        CeedCall(CeedElemRestrictionGetStrides(rstr, strides));
+        CeedCall(CeedElemRestrictionCreateBlockedStrided(rstr->ceed, num_elem, elem_size, block_size, num_comp, l_size, strides,
+                                                         &rstr->rstr_block[index]));
+      } break;
+      case CEED_RESTRICTION_POINTS:
+        // Empty case - excluded above
+        break;
+    }
+    rstr->num_rstr_block++;
+  }
+  *block_rstr = NULL;
+  CeedCall(CeedElemRestrictionReferenceCopy(rstr->rstr_block[index], block_rstr));
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// @cond DOXYGEN_SKIP
@@ -627,6 +861,8 @@ const CeedElemRestriction CEED_ELEMRESTRICTION_NONE = &ceed_elemrestriction_none
 **/
 int CeedElemRestrictionCreate(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt num_comp, CeedInt comp_stride, CeedSize l_size,
                               CeedMemType mem_type, CeedCopyMode copy_mode, const CeedInt *offsets, CeedElemRestriction *rstr) {
+  uint64_t hash;
+
   if (!ceed->ElemRestrictionCreate) {
     Ceed delegate;
 
@@ -642,6 +878,14 @@ int CeedElemRestrictionCreate(Ceed ceed, CeedInt num_elem, CeedInt elem_size, Ce
   CeedCheck(num_comp > 0, ceed, CEED_ERROR_DIMENSION, "CeedElemRestriction must have at least 1 component");
   CeedCheck(num_comp == 1 || comp_stride > 0, ceed, CEED_ERROR_DIMENSION, "CeedElemRestriction component stride must be at least 1");
 
+  // Reuse identical cached restriction
+  CeedCall(CeedElemRestrictionGetCached(ceed, CEED_RESTRICTION_STANDARD, num_elem, elem_size, 1, num_comp, comp_stride, l_size, mem_type, offsets,
+                                        NULL, NULL, NULL, &hash, rstr));
+  if (*rstr) {
+    if (copy_mode == CEED_OWN_POINTER) CeedCall(CeedFree(&offsets));
+    return CEED_ERROR_SUCCESS;
+  }
+
   CeedCall(CeedCalloc(1, rstr));
   CeedCall(CeedReferenceCopy(ceed, &(*rstr)->ceed));
   (*rstr)->ref_count   = 1;
@@ -655,6 +899,8 @@ int CeedElemRestrictionCreate(Ceed ceed, CeedInt num_elem, CeedInt elem_size, Ce
   (*rstr)->block_size  = 1;
   (*rstr)->rstr_type   = CEED_RESTRICTION_STANDARD;
   CeedCall(ceed->ElemRestrictionCreate(mem_type, copy_mode, offsets, NULL, NULL, *rstr));
+  // Only restrictions owning their data are shared
+  if (copy_mode != CEED_USE_POINTER) CeedCall(CeedElemRestrictionSetCached(*rstr, hash));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -684,6 +930,8 @@ int CeedElemRestrictionCreate(Ceed ceed, CeedInt num_elem, CeedInt elem_size, Ce
 int CeedElemRestrictionCreateOriented(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt num_comp, CeedInt comp_stride, CeedSize l_size,
                                       CeedMemType mem_type, CeedCopyMode copy_mode, const CeedInt *offsets, const bool *orients,
                                       CeedElemRestriction *rstr) {
+  uint64_t hash;
+
   if (!ceed->ElemRestrictionCreate) {
     Ceed delegate;
 
@@ -700,6 +948,17 @@ int CeedElemRestrictionCreateOriented(Ceed ceed, CeedInt num_elem, CeedInt elem_
   CeedCheck(num_comp > 0, ceed, CEED_ERROR_DIMENSION, "CeedElemRestriction must have at least 1 component");
   CeedCheck(num_comp == 1 || comp_stride > 0, ceed, CEED_ERROR_DIMENSION, "CeedElemRestriction component stride must be at least 1");
 
+  // Reuse identical cached restriction
+  CeedCall(CeedElemRestrictionGetCached(ceed, CEED_RESTRICTION_ORIENTED, num_elem, elem_size, 1, num_comp, comp_stride, l_size, mem_type, offsets,
+                                        orients, NULL, NULL, &hash, rstr));
+  if (*rstr) {
+    if (copy_mode == CEED_OWN_POINTER) {
+      CeedCall(CeedFree(&offsets));
+      CeedCall(CeedFree(&orients));
+    }
+    return CEED_ERROR_SUCCESS;
+  }
+
   CeedCall(CeedCalloc(1, rstr));
   CeedCall(CeedReferenceCopy(ceed, &(*rstr)->ceed));
   (*rstr)->ref_count   = 1;
@@ -713,6 +972,8 @@ int CeedElemRestrictionCreateOriented(Ceed ceed, CeedInt num_elem, CeedInt elem_
   (*rstr)->block_size  = 1;
   (*rstr)->rstr_type   = CEED_RESTRICTION_ORIENTED;
   CeedCall(ceed->ElemRestrictionCreate(mem_type, copy_mode, offsets, orients, NULL, *rstr));
+  // Only restrictions owning their data are shared
+  if (copy_mode != CEED_USE_POINTER) CeedCall(CeedElemRestrictionSetCached(*rstr, hash));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -743,6 +1004,8 @@ int CeedElemRestrictionCreateOriented(Ceed ceed, CeedInt num_elem, CeedInt elem_
 int CeedElemRestrictionCreateCurlOriented(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt num_comp, CeedInt comp_stride, CeedSize l_size,
                                           CeedMemType mem_type, CeedCopyMode copy_mode, const CeedInt *offsets, const CeedInt8 *curl_orients,
                                           CeedElemRestriction *rstr) {
+  uint64_t hash;
+
   if (!ceed->ElemRestrictionCreate) {
     Ceed delegate;
 
@@ -759,6 +1022,17 @@ int CeedElemRestrictionCreateCurlOriented(Ceed ceed, CeedInt num_elem, CeedInt e
   CeedCheck(num_comp > 0, ceed, CEED_ERROR_DIMENSION, "CeedElemRestriction must have at least 1 component");
   CeedCheck(num_comp == 1 || comp_stride > 0, ceed, CEED_ERROR_DIMENSION, "CeedElemRestriction component stride must be at least 1");
 
+  // Reuse identical cached restriction
+  CeedCall(CeedElemRestrictionGetCached(ceed, CEED_RESTRICTION_CURL_ORIENTED, num_elem, elem_size, 1, num_comp, comp_stride, l_size, mem_type,
+                                        offsets, NULL, curl_orients, NULL, &hash, rstr));
+  if (*rstr) {
+    if (copy_mode == CEED_OWN_POINTER) {
+      CeedCall(CeedFree(&offsets));
+      CeedCall(CeedFree(&curl_orients));
+    }
+    return CEED_ERROR_SUCCESS;
+  }
+
   CeedCall(CeedCalloc(1, rstr));
   CeedCall(CeedReferenceCopy(ceed, &(*rstr)->ceed));
   (*rstr)->ref_count   = 1;
@@ -772,6 +1046,8 @@ int CeedElemRestrictionCreateCurlOriented(Ceed ceed, CeedInt num_elem, CeedInt e
   (*rstr)->block_size  = 1;
   (*rstr)->rstr_type   = CEED_RESTRICTION_CURL_ORIENTED;
   CeedCall(ceed->ElemRestrictionCreate(mem_type, copy_mode, offsets, NULL, curl_orients, *rstr));
+  // Only restrictions owning their data are shared
+  if (copy_mode != CEED_USE_POINTER) CeedCall(CeedElemRestrictionSetCached(*rstr, hash));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -786,6 +1062,7 @@ int CeedElemRestrictionCreateCurlOriented(Ceed ceed, CeedInt num_elem, CeedInt e
                           This vector may be larger than the elements and fields given by this restriction.
   @param[in]  strides   Array for strides between `[nodes, components, elements]`.
                           Data for node `i`, component `j`, element `k` can be found in the L-vector at index `i*strides[0] + j*strides[1] + k*strides[2]`.
+                          An element stride of 0 shares the same data between all elements, so the L-vector only needs `elem_size * num_comp` entries.
                           @ref CEED_STRIDES_BACKEND may be used for `CeedVector` ordered by the same `Ceed` backend.
                           `CEED_STRIDES_BACKEND` should only be used pass data between `CeedOperator` created with the same `Ceed` backend.
                           The L-vector layout will, in general, be different between `Ceed` backends.
@@ -797,6 +1074,8 @@ int CeedElemRestrictionCreateCurlOriented(Ceed ceed, CeedInt num_elem, CeedInt e
 **/
 int CeedElemRestrictionCreateStrided(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt num_comp, CeedSize l_size, const CeedInt strides[3],
                                      CeedElemRestriction *rstr) {
+  uint64_t hash;
+
   if (!ceed->ElemRestrictionCreate) {
     Ceed delegate;
 
@@ -810,9 +1089,20 @@ int CeedElemRestrictionCreateStrided(Ceed ceed, CeedInt num_elem, CeedInt elem_s
   CeedCheck(num_elem >= 0, ceed, CEED_ERROR_DIMENSION, "Number of elements must be non-negative");
   CeedCheck(elem_size > 0, ceed, CEED_ERROR_DIMENSION, "Element size must be at least 1");
   CeedCheck(num_comp > 0, ceed, CEED_ERROR_DIMENSION, "CeedElemRestriction must have at least 1 component");
-  CeedCheck(l_size >= (CeedSize)num_elem * (CeedSize)elem_size * (CeedSize)num_comp, ceed, CEED_ERROR_DIMENSION,
-            "L-vector size must be at least num_elem * elem_size * num_comp. Expected: > %" CeedSize_FMT " Found: %" CeedSize_FMT,
-            (CeedSize)num_elem * (CeedSize)elem_size * (CeedSize)num_comp, l_size);
+  if (strides[2] == 0 && (strides[0] != 0 || strides[1] != 0)) {
+    CeedCheck(l_size >= (CeedSize)elem_size * (CeedSize)num_comp, ceed, CEED_ERROR_DIMENSION,
+              "L-vector size must be at least elem_size * num_comp for shared element data. Expected: > %" CeedSize_FMT " Found: %" CeedSize_FMT,
+              (CeedSize)elem_size * (CeedSize)num_comp, l_size);
+  } else {
+    CeedCheck(l_size >= (CeedSize)num_elem * (CeedSize)elem_size * (CeedSize)num_comp, ceed, CEED_ERROR_DIMENSION,
+              "L-vector size must be at least num_elem * elem_size * num_comp. Expected: > %" CeedSize_FMT " Found: %" CeedSize_FMT,
+              (CeedSize)num_elem * (CeedSize)elem_size * (CeedSize)num_comp, l_size);
+  }
+
+  // Reuse identical cached restriction
+  CeedCall(CeedElemRestrictionGetCached(ceed, CEED_RESTRICTION_STRIDED, num_elem, elem_size, 1, num_comp, 0, l_size, CEED_MEM_HOST, NULL, NULL, NULL,
+                                        strides, &hash, rstr));
+  if (*rstr) return CEED_ERROR_SUCCESS;
 
   CeedCall(CeedCalloc(1, rstr));
   CeedCall(CeedReferenceCopy(ceed, &(*rstr)->ceed));
@@ -828,6 +1118,7 @@ int CeedElemRestrictionCreateStrided(Ceed ceed, CeedInt num_elem, CeedInt elem_s
   CeedCall(CeedMalloc(3, &(*rstr)->strides));
   for (CeedInt i = 0; i < 3; i++) (*rstr)->strides[i] = strides[i];
   CeedCall(ceed->ElemRestrictionCreate(CEED_MEM_HOST, CEED_OWN_POINTER, NULL, NULL, NULL, *rstr));
+  CeedCall(CeedElemRestrictionSetCached(*rstr, hash));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -926,7 +1217,8 @@ int CeedElemRestrictionCreateAtPoints(Ceed ceed, CeedInt num_elem, CeedInt num_p
 int CeedElemRestrictionCreateBlocked(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt block_size, CeedInt num_comp, CeedInt comp_stride,
                                      CeedSize l_size, CeedMemType mem_type, CeedCopyMode copy_mode, const CeedInt *offsets,
                                      CeedElemRestriction *rstr) {
-  CeedInt *block_offsets, num_block = (num_elem / block_size) + !!(num_elem % block_size);
+  uint64_t  hash;
+  CeedInt  *block_offsets, num_block = (num_elem / block_size) + !!(num_elem % block_size);
 
   if (!ceed->ElemRestrictionCreateBlocked) {
     Ceed delegate;
@@ -948,6 +1240,15 @@ int CeedElemRestrictionCreateBlocked(Ceed ceed, CeedInt num_elem, CeedInt elem_s
   CeedCall(CeedCalloc(num_block * block_size * elem_size, &block_offsets));
   CeedCall(CeedPermutePadOffsets(offsets, block_offsets, num_block, num_elem, block_size, elem_size));
 
+  // Reuse identical cached restriction
+  CeedCall(CeedElemRestrictionGetCached(ceed, CEED_RESTRICTION_STANDARD, num_elem, elem_size, block_size, num_comp, comp_stride, l_size,
+                                        CEED_MEM_HOST, block_offsets, NULL, NULL, NULL, &hash, rstr));
+  if (*rstr) {
+    CeedCall(CeedFree(&block_offsets));
+    if (copy_mode == CEED_OWN_POINTER) CeedCall(CeedFree(&offsets));
+    return CEED_ERROR_SUCCESS;
+  }
+
   CeedCall(CeedCalloc(1, rstr));
   CeedCall(CeedReferenceCopy(ceed, &(*rstr)->ceed));
   (*rstr)->ref_count   = 1;
@@ -962,6 +1263,7 @@ int CeedElemRestrictionCreateBlocked(Ceed ceed, CeedInt num_elem, CeedInt elem_s
   (*rstr)->rstr_type   = CEED_RESTRICTION_STANDARD;
   CeedCall(ceed->ElemRestrictionCreateBlocked(CEED_MEM_HOST, CEED_OWN_POINTER, (const CeedInt *)block_offsets, NULL, NULL, *rstr));
   if (copy_mode == CEED_OWN_POINTER) CeedCall(CeedFree(&offsets));
+  CeedCall(CeedElemRestrictionSetCached(*rstr, hash));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -995,8 +1297,9 @@ int CeedElemRestrictionCreateBlocked(Ceed ceed, CeedInt num_elem, CeedInt elem_s
 int CeedElemRestrictionCreateBlockedOriented(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt block_size, CeedInt num_comp,
                                              CeedInt comp_stride, CeedSize l_size, CeedMemType mem_type, CeedCopyMode copy_mode,
                                              const CeedInt *offsets, const bool *orients, CeedElemRestriction *rstr) {
-  bool    *block_orients;
-  CeedInt *block_offsets, num_block = (num_elem / block_size) + !!(num_elem % block_size);
+  uint64_t  hash;
+  bool     *block_orients;
+  CeedInt  *block_offsets, num_block = (num_elem / block_size) + !!(num_elem % block_size);
 
   if (!ceed->ElemRestrictionCreateBlocked) {
     Ceed delegate;
@@ -1019,6 +1322,16 @@ int CeedElemRestrictionCreateBlockedOriented(Ceed ceed, CeedInt num_elem, CeedIn
   CeedCall(CeedPermutePadOffsets(offsets, block_offsets, num_block, num_elem, block_size, elem_size));
   CeedCall(CeedPermutePadOrients(orients, block_orients, num_block, num_elem, block_size, elem_size));
 
+  // Reuse identical cached restriction
+  CeedCall(CeedElemRestrictionGetCached(ceed, CEED_RESTRICTION_ORIENTED, num_elem, elem_size, block_size, num_comp, comp_stride, l_size,
+                                        CEED_MEM_HOST, block_offsets, block_orients, NULL, NULL, &hash, rstr));
+  if (*rstr) {
+    CeedCall(CeedFree(&block_offsets));
+    CeedCall(CeedFree(&block_orients));
+    if (copy_mode == CEED_OWN_POINTER) CeedCall(CeedFree(&offsets));
+    return CEED_ERROR_SUCCESS;
+  }
+
   CeedCall(CeedCalloc(1, rstr));
   CeedCall(CeedReferenceCopy(ceed, &(*rstr)->ceed));
   (*rstr)->ref_count   = 1;
@@ -1034,6 +1347,7 @@ int CeedElemRestrictionCreateBlockedOriented(Ceed ceed, CeedInt num_elem, CeedIn
   CeedCall(
       ceed->ElemRestrictionCreateBlocked(CEED_MEM_HOST, CEED_OWN_POINTER, (const CeedInt *)block_offsets, (const bool *)block_orients, NULL, *rstr));
   if (copy_mode == CEED_OWN_POINTER) CeedCall(CeedFree(&offsets));
+  CeedCall(CeedElemRestrictionSetCached(*rstr, hash));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1068,6 +1382,7 @@ int CeedElemRestrictionCreateBlockedOriented(Ceed ceed, CeedInt num_elem, CeedIn
 int CeedElemRestrictionCreateBlockedCurlOriented(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt block_size, CeedInt num_comp,
                                                  CeedInt comp_stride, CeedSize l_size, CeedMemType mem_type, CeedCopyMode copy_mode,
                                                  const CeedInt *offsets, const CeedInt8 *curl_orients, CeedElemRestriction *rstr) {
+  uint64_t  hash;
   CeedInt8 *block_curl_orients;
   CeedInt  *block_offsets, num_block = (num_elem / block_size) + !!(num_elem % block_size);
 
@@ -1093,6 +1408,16 @@ int CeedElemRestrictionCreateBlockedCurlOriented(Ceed ceed, CeedInt num_elem, Ce
   CeedCall(CeedPermutePadOffsets(offsets, block_offsets, num_block, num_elem, block_size, elem_size));
   CeedCall(CeedPermutePadCurlOrients(curl_orients, block_curl_orients, num_block, num_elem, block_size, 3 * elem_size));
 
+  // Reuse identical cached restriction
+  CeedCall(CeedElemRestrictionGetCached(ceed, CEED_RESTRICTION_CURL_ORIENTED, num_elem, elem_size, block_size, num_comp, comp_stride, l_size,
+                                        CEED_MEM_HOST, block_offsets, NULL, block_curl_orients, NULL, &hash, rstr));
+  if (*rstr) {
+    CeedCall(CeedFree(&block_offsets));
+    CeedCall(CeedFree(&block_curl_orients));
+    if (copy_mode == CEED_OWN_POINTER) CeedCall(CeedFree(&offsets));
+    return CEED_ERROR_SUCCESS;
+  }
+
   CeedCall(CeedCalloc(1, rstr));
   CeedCall(CeedReferenceCopy(ceed, &(*rstr)->ceed));
   (*rstr)->ref_count   = 1;
@@ -1108,6 +1433,7 @@ int CeedElemRestrictionCreateBlockedCurlOriented(Ceed ceed, CeedInt num_elem, Ce
   CeedCall(ceed->ElemRestrictionCreateBlocked(CEED_MEM_HOST, CEED_OWN_POINTER, (const CeedInt *)block_offsets, NULL,
                                               (const CeedInt8 *)block_curl_orients, *rstr));
   if (copy_mode == CEED_OWN_POINTER) CeedCall(CeedFree(&offsets));
+  CeedCall(CeedElemRestrictionSetCached(*rstr, hash));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1132,7 +1458,8 @@ int CeedElemRestrictionCreateBlockedCurlOriented(Ceed ceed, CeedInt num_elem, Ce
 **/
 int CeedElemRestrictionCreateBlockedStrided(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt block_size, CeedInt num_comp, CeedSize l_size,
                                             const CeedInt strides[3], CeedElemRestriction *rstr) {
-  CeedInt num_block = (num_elem / block_size) + !!(num_elem % block_size);
+  uint64_t hash;
+  CeedInt  num_block = (num_elem / block_size) + !!(num_elem % block_size);
 
   if (!ceed->ElemRestrictionCreateBlocked) {
     Ceed delegate;
@@ -1148,9 +1475,20 @@ int CeedElemRestrictionCreateBlockedStrided(Ceed ceed, CeedInt num_elem, CeedInt
   CeedCheck(elem_size > 0, ceed, CEED_ERROR_DIMENSION, "Element size must be at least 1");
   CeedCheck(block_size > 0, ceed, CEED_ERROR_DIMENSION, "Block size must be at least 1");
   CeedCheck(num_comp > 0, ceed, CEED_ERROR_DIMENSION, "CeedElemRestriction must have at least 1 component");
-  CeedCheck(l_size >= (CeedSize)num_elem * (CeedSize)elem_size * (CeedSize)num_comp, ceed, CEED_ERROR_DIMENSION,
-            "L-vector size must be at least num_elem * elem_size * num_comp. Expected: > %" CeedSize_FMT " Found: %" CeedSize_FMT,
-            (CeedSize)num_elem * (CeedSize)elem_size * (CeedSize)num_comp, l_size);
+  if (strides[2] == 0 && (strides[0] != 0 || strides[1] != 0)) {
+    CeedCheck(l_size >= (CeedSize)elem_size * (CeedSize)num_comp, ceed, CEED_ERROR_DIMENSION,
+              "L-vector size must be at least elem_size * num_comp for shared element data. Expected: > %" CeedSize_FMT " Found: %" CeedSize_FMT,
+              (CeedSize)elem_size * (CeedSize)num_comp, l_size);
+  } else {
+    CeedCheck(l_size >= (CeedSize)num_elem * (CeedSize)elem_size * (CeedSize)num_comp, ceed, CEED_ERROR_DIMENSION,
+              "L-vector size must be at least num_elem * elem_size * num_comp. Expected: > %" CeedSize_FMT " Found: %" CeedSize_FMT,
+              (CeedSize)num_elem * (CeedSize)elem_size * (CeedSize)num_comp, l_size);
+  }
+
+  // Reuse identical cached restriction
+  CeedCall(CeedElemRestrictionGetCached(ceed, CEED_RESTRICTION_STRIDED, num_elem, elem_size, block_size, num_comp, 0, l_size, CEED_MEM_HOST, NULL,
+                                        NULL, NULL, strides, &hash, rstr));
+  if (*rstr) return CEED_ERROR_SUCCESS;
 
   CeedCall(CeedCalloc(1, rstr));
   CeedCall(CeedReferenceCopy(ceed, &(*rstr)->ceed));
@@ -1166,6 +1504,7 @@ int CeedElemRestrictionCreateBlockedStrided(Ceed ceed, CeedInt num_elem, CeedInt
   CeedCall(CeedMalloc(3, &(*rstr)->strides));
   for (CeedInt i = 0; i < 3; i++) (*rstr)->strides[i] = strides[i];
   CeedCall(ceed->ElemRestrictionCreateBlocked(CEED_MEM_HOST, CEED_OWN_POINTER, NULL, NULL, NULL, *rstr));
+  CeedCall(CeedElemRestrictionSetCached(*rstr, hash));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1186,10 +1525,13 @@ int CeedElemRestrictionCreateUnsignedCopy(CeedElemRestriction rstr, CeedElemRest
 
   // Copy old rstr
   memcpy(*rstr_unsigned, rstr, sizeof(struct CeedElemRestriction_private));
-  (*rstr_unsigned)->ceed = NULL;
+  (*rstr_unsigned)->ceed           = NULL;
+  (*rstr_unsigned)->num_rstr_block = 0;
+  memset((*rstr_unsigned)->rstr_block, 0, sizeof((*rstr_unsigned)->rstr_block));
   CeedCall(CeedReferenceCopy(rstr->ceed, &(*rstr_unsigned)->ceed));
-  (*rstr_unsigned)->ref_count = 1;
-  (*rstr_unsigned)->strides   = NULL;
+  (*rstr_unsigned)->ref_count  = 1;
+  (*rstr_unsigned)->cache_hash = 0;
+  (*rstr_unsigned)->strides    = NULL;
   if (rstr->strides) {
     CeedCall(CeedMalloc(3, &(*rstr_unsigned)->strides));
     for (CeedInt i = 0; i < 3; i++) (*rstr_unsigned)->strides[i] = rstr->strides[i];
@@ -1197,7 +1539,8 @@ int CeedElemRestrictionCreateUnsignedCopy(CeedElemRestriction rstr, CeedElemRest
   CeedCall(CeedElemRestrictionReferenceCopy(rstr, &(*rstr_unsigned)->rstr_base));
 
   // Override Apply
-  (*rstr_unsigned)->Apply = rstr->ApplyUnsigned;
+  (*rstr_unsigned)->Apply       = rstr->ApplyUnsigned;
+  (*rstr_unsigned)->is_unsigned = true;
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1218,10 +1561,13 @@ int CeedElemRestrictionCreateUnorientedCopy(CeedElemRestriction rstr, CeedElemRe
 
   // Copy old rstr
   memcpy(*rstr_unoriented, rstr, sizeof(struct CeedElemRestriction_private));
-  (*rstr_unoriented)->ceed = NULL;
+  (*rstr_unoriented)->ceed           = NULL;
+  (*rstr_unoriented)->num_rstr_block = 0;
+  memset((*rstr_unoriented)->rstr_block, 0, sizeof((*rstr_unoriented)->rstr_block));
   CeedCall(CeedReferenceCopy(rstr->ceed, &(*rstr_unoriented)->ceed));
-  (*rstr_unoriented)->ref_count = 1;
-  (*rstr_unoriented)->strides   = NULL;
+  (*rstr_unoriented)->ref_count  = 1;
+  (*rstr_unoriented)->cache_hash = 0;
+  (*rstr_unoriented)->strides    = NULL;
   if (rstr->strides) {
     CeedCall(CeedMalloc(3, &(*rstr_unoriented)->strides));
     for (CeedInt i = 0; i < 3; i++) (*rstr_unoriented)->strides[i] = rstr->strides[i];
@@ -1229,7 +1575,8 @@ int CeedElemRestrictionCreateUnorientedCopy(CeedElemRestriction rstr, CeedElemRe
   CeedCall(CeedElemRestrictionReferenceCopy(rstr, &(*rstr_unoriented)->rstr_base));
 
   // Override Apply
-  (*rstr_unoriented)->Apply = rstr->ApplyUnoriented;
+  (*rstr_unoriented)->Apply         = rstr->ApplyUnoriented;
+  (*rstr_unoriented)->is_unoriented = true;
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1427,6 +1774,127 @@ int CeedElemRestrictionApplyBlock(CeedElemRestriction rstr, CeedInt block, CeedT
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Restrict an L-vector to a contiguous range of blocks of an E-vector or apply its transpose
+
+  This is equivalent to calling @ref CeedElemRestrictionApplyBlock() for each block in `[start_block, stop_block)` with the blocks stored consecutively in `ru`, but with a single backend call.
+  Unsigned and unoriented copies of a `CeedElemRestriction` apply the range without signs or orientations, as in @ref CeedElemRestrictionApply().
+
+  @param[in]  rstr        `CeedElemRestriction`
+  @param[in]  start_block First block to restrict to/from
+  @param[in]  stop_block  One past the last block to restrict to/from
+  @param[in]  t_mode      Apply restriction or transpose
+  @param[in]  u           Input vector (of size `l_size` when `t_mode` = @ref CEED_NOTRANSPOSE)
+  @param[out] ru          Output vector (of shape `[(stop_block - start_block) * block_size * elem_size]` when `t_mode` = @ref CEED_NOTRANSPOSE).
+                            Ordering of the e-vector is decided by the backend.
+                            The e-vector may be longer than the range, e.g. to reuse one e-vector for ranges of varying length.
+  @param[in]  request     Request or @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionApplyRange(CeedElemRestriction rstr, CeedInt start_block, CeedInt stop_block, CeedTransposeMode t_mode, CeedVector u,
+                                  CeedVector ru, CeedRequest *request) {
+  CeedSize min_u_len, min_ru_len, len, e_len;
+  CeedInt  block_size, num_block, elem_size, num_comp;
+
+  CeedCheck(rstr->ApplyRange, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_UNSUPPORTED,
+            "Backend does not implement CeedElemRestrictionApplyRange");
+
+  CeedCall(CeedElemRestrictionGetBlockSize(rstr, &block_size));
+  CeedCall(CeedElemRestrictionGetNumBlocks(rstr, &num_block));
+  CeedCheck(0 <= start_block && start_block <= stop_block && stop_block <= num_block, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_DIMENSION,
+            "Cannot retrieve blocks [%" CeedInt_FMT ", %" CeedInt_FMT "), total blocks %" CeedInt_FMT, start_block, stop_block, num_block);
+  CeedCall(CeedElemRestrictionGetElementSize(rstr, &elem_size));
+  CeedCall(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
+  e_len = (CeedSize)(stop_block - start_block) * (CeedSize)block_size * (CeedSize)elem_size * (CeedSize)num_comp;
+  if (t_mode == CEED_NOTRANSPOSE) {
+    CeedCall(CeedElemRestrictionGetLVectorSize(rstr, &min_u_len));
+    min_ru_len = e_len;
+  } else {
+    CeedCall(CeedElemRestrictionGetLVectorSize(rstr, &min_ru_len));
+    min_u_len = e_len;
+  }
+  CeedCall(CeedVectorGetLength(u, &len));
+  CeedCheck(t_mode == CEED_NOTRANSPOSE ? min_u_len == len : min_u_len <= len, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_DIMENSION,
+            "Input vector size %" CeedInt_FMT " not compatible with element restriction (%" CeedInt_FMT ", %" CeedInt_FMT ")", len, min_u_len,
+            min_ru_len);
+  CeedCall(CeedVectorGetLength(ru, &len));
+  CeedCheck(t_mode == CEED_NOTRANSPOSE ? min_ru_len <= len : min_ru_len == len, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_DIMENSION,
+            "Output vector size %" CeedInt_FMT " not compatible with element restriction (%" CeedInt_FMT ", %" CeedInt_FMT ")", len, min_ru_len,
+            min_u_len);
+  if (stop_block > start_block) {
+    const bool use_signs = !rstr->is_unsigned && !rstr->is_unoriented, use_orients = !rstr->is_unoriented;
+
+    CeedCall(rstr->ApplyRange(rstr, start_block, stop_block, t_mode, use_signs, use_orients, u, ru, request));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply the transpose of a `CeedElemRestriction` to a contiguous range of blocks of an E-vector and add the scaled result, `ru += alpha * R^T u`
+
+  This is equivalent to scaling the range of `u` by `alpha` before @ref CeedElemRestrictionApplyRange() with @ref CEED_TRANSPOSE, but backends apply the scaling while summing into `ru`.
+  Backends without a scaled transpose restriction scale a copy of `u` instead.
+
+  @param[in]  rstr        `CeedElemRestriction`
+  @param[in]  start_block First block to restrict from
+  @param[in]  stop_block  One past the last block to restrict from
+  @param[in]  alpha       Scaling factor for the transpose restriction
+  @param[in]  u           Input E-vector, holding the range of blocks as in @ref CeedElemRestrictionApplyRange()
+  @param[out] ru          Output L-vector (of size `l_size`)
+  @param[in]  request     Request or @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionApplyRangeScaled(CeedElemRestriction rstr, CeedInt start_block, CeedInt stop_block, CeedScalar alpha, CeedVector u,
+                                        CeedVector ru, CeedRequest *request) {
+  if (alpha == 1.0) return CeedElemRestrictionApplyRange(rstr, start_block, stop_block, CEED_TRANSPOSE, u, ru, request);
+
+  if (rstr->ApplyRangeScaled) {
+    // Check sizes as in CeedElemRestrictionApplyRange
+    CeedSize min_u_len, l_len, len;
+    CeedInt  block_size, num_block, elem_size, num_comp;
+
+    CeedCall(CeedElemRestrictionGetBlockSize(rstr, &block_size));
+    CeedCall(CeedElemRestrictionGetNumBlocks(rstr, &num_block));
+    CeedCheck(0 <= start_block && start_block <= stop_block && stop_block <= num_block, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_DIMENSION,
+              "Cannot retrieve blocks [%" CeedInt_FMT ", %" CeedInt_FMT "), total blocks %" CeedInt_FMT, start_block, stop_block, num_block);
+    CeedCall(CeedElemRestrictionGetElementSize(rstr, &elem_size));
+    CeedCall(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
+    CeedCall(CeedElemRestrictionGetLVectorSize(rstr, &l_len));
+    min_u_len = (CeedSize)(stop_block - start_block) * (CeedSize)block_size * (CeedSize)elem_size * (CeedSize)num_comp;
+    CeedCall(CeedVectorGetLength(u, &len));
+    CeedCheck(min_u_len <= len, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_DIMENSION,
+              "Input vector size %" CeedInt_FMT " not compatible with element restriction (%" CeedInt_FMT ", %" CeedInt_FMT ")", len, min_u_len,
+              l_len);
+    CeedCall(CeedVectorGetLength(ru, &len));
+    CeedCheck(l_len == len, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_DIMENSION,
+              "Output vector size %" CeedInt_FMT " not compatible with element restriction (%" CeedInt_FMT ", %" CeedInt_FMT ")", len, l_len,
+              min_u_len);
+    if (stop_block > start_block) {
+      const bool use_signs = !rstr->is_unsigned && !rstr->is_unoriented, use_orients = !rstr->is_unoriented;
+
+      CeedCall(rstr->ApplyRangeScaled(rstr, start_block, stop_block, alpha, use_signs, use_orients, u, ru, request));
+    }
+  } else {
+    // Fallback to scaling a copy of the E-vector
+    CeedSize   u_len;
+    CeedVector u_scaled;
+
+    CeedCall(CeedVectorGetLength(u, &u_len));
+    CeedCall(CeedVectorCreate(CeedElemRestrictionReturnCeed(rstr), u_len, &u_scaled));
+    CeedCall(CeedVectorCopy(u, u_scaled));
+    CeedCall(CeedVectorScale(u_scaled, alpha));
+    CeedCall(CeedElemRestrictionApplyRange(rstr, start_block, stop_block, CEED_TRANSPOSE, u_scaled, ru, request));
+    CeedCall(CeedVectorDestroy(&u_scaled));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get the `Ceed` associated with a `CeedElemRestriction`
 
@@ -1777,6 +2245,11 @@ int CeedElemRestrictionDestroy(CeedElemRestriction *rstr) {
   CeedCheck((*rstr)->num_readers == 0, (*rstr)->ceed, CEED_ERROR_ACCESS,
             "Cannot destroy CeedElemRestriction, a process has read access to the offset data");
 
+  // Remove from object cache
+  if ((*rstr)->cache_hash) CeedCall(CeedObjectCacheRemoveElemRestriction((*rstr)->ceed, *rstr));
+
+  for (CeedInt i = 0; i < CEED_ELEMRESTRICTION_BLOCKED_MAX; i++) CeedCall(CeedElemRestrictionDestroy(&(*rstr)->rstr_block[i]));
+
   // Only destroy backend data once between rstr and unsigned copy
   if ((*rstr)->rstr_base) CeedCall(CeedElemRestrictionDestroy(&(*rstr)->rstr_base));
   else if ((*rstr)->Destroy) CeedCall((*rstr)->Destroy(*rstr));
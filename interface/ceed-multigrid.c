@@ -0,0 +1,662 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed-impl.h>
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// @file
+/// Implementation of CeedMultigrid interfaces
+
+/// ----------------------------------------------------------------------------
+/// CeedMultigrid Library Internal Functions
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedOperatorDeveloper
+/// @{
+
+/**
+  @brief Compare two coarse node keys, stored as `[key_size, key[0], ..., key[key_size - 1], index]`
+
+  @param[in] a First key
+  @param[in] b Second key
+
+  @return Negative, zero, or positive for `a` less than, equal to, or greater than `b`
+
+  @ref Developer
+**/
+static int CeedMultigridCompareKeys(const void *a, const void *b) {
+  const CeedInt *key_a = (const CeedInt *)a, *key_b = (const CeedInt *)b;
+
+  for (CeedInt i = 1; i <= key_a[0]; i++) {
+    if (key_a[i] != key_b[i]) return key_a[i] < key_b[i] ? -1 : 1;
+  }
+  return 0;
+}
+
+/**
+  @brief Sort a coarse node key in place with insertion sort
+
+  @param[in]     key_size Number of entries in key
+  @param[in,out] key      Key to sort
+
+  @ref Developer
+**/
+static void CeedMultigridSortKey(CeedInt key_size, CeedInt *key) {
+  for (CeedInt i = 1; i < key_size; i++) {
+    const CeedInt value = key[i];
+    CeedInt       j     = i - 1;
+
+    for (; j >= 0 && key[j] > value; j--) key[j + 1] = key[j];
+    key[j + 1] = value;
+  }
+}
+
+/**
+  @brief Create a coarse `CeedElemRestriction` with the topology of a fine tensor product H^1 `CeedElemRestriction`.
+
+  Each coarse node is identified by the fine nodes that bracket it in each dimension, so coarse nodes on shared element faces, edges, and vertices are
+  numbered consistently across elements.
+  The caller checks that `rstr_fine` is a standard `CeedElemRestriction` with `P_fine^dim` nodes per element.
+
+  @param[in]  rstr_fine `CeedElemRestriction` for the fine level
+  @param[in]  dim       Topological dimension of the elements
+  @param[in]  P_fine    Number of fine nodes in one dimension
+  @param[in]  P_coarse  Number of coarse nodes in one dimension
+  @param[out] rstr      Address of the variable where the newly created `CeedElemRestriction` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedMultigridCreateCoarseElemRestriction(CeedElemRestriction rstr_fine, CeedInt dim, CeedInt P_fine, CeedInt P_coarse,
+                                                    CeedElemRestriction *rstr) {
+  Ceed           ceed;
+  CeedInt        num_elem, elem_size_fine, elem_size, num_comp, comp_stride, key_size = 1 << dim, record_size = key_size + 2;
+  CeedInt        num_nodes = 0, *records, *offsets;
+  const CeedInt *offsets_fine;
+
+  CeedCall(CeedElemRestrictionGetNumElements(rstr_fine, &num_elem));
+  CeedCall(CeedElemRestrictionGetElementSize(rstr_fine, &elem_size_fine));
+  CeedCall(CeedElemRestrictionGetNumComponents(rstr_fine, &num_comp));
+  CeedCall(CeedElemRestrictionGetCompStride(rstr_fine, &comp_stride));
+  elem_size = CeedIntPow(P_coarse, dim);
+
+  // Build keys from bracketing fine nodes
+  CeedCall(CeedElemRestrictionGetOffsets(rstr_fine, CEED_MEM_HOST, &offsets_fine));
+  CeedCall(CeedCalloc(num_elem * elem_size * record_size, &records));
+  for (CeedInt e = 0; e < num_elem; e++) {
+    for (CeedInt n = 0; n < elem_size; n++) {
+      CeedInt *record = &records[(e * elem_size + n) * record_size];
+
+      record[0]               = key_size;
+      record[record_size - 1] = e * elem_size + n;
+      for (CeedInt k = 0; k < key_size; k++) {
+        CeedInt node_fine = 0;
+
+        for (CeedInt d = dim - 1; d >= 0; d--) {
+          const CeedInt i_c = (n / CeedIntPow(P_coarse, d)) % P_coarse, scaled = i_c * (P_fine - 1);
+          const CeedInt i_f = ((k >> d) & 1) ? (scaled + P_coarse - 2) / (P_coarse - 1) : scaled / (P_coarse - 1);
+
+          node_fine = node_fine * P_fine + i_f;
+        }
+        node_fine     = offsets_fine[e * elem_size_fine + node_fine];
+        record[k + 1] = (num_comp > 1 && comp_stride == 1) ? node_fine / num_comp : node_fine;
+      }
+      CeedMultigridSortKey(key_size, &record[1]);
+    }
+  }
+  CeedCall(CeedElemRestrictionRestoreOffsets(rstr_fine, &offsets_fine));
+
+  // Number unique keys
+  qsort(records, num_elem * elem_size, record_size * sizeof(CeedInt), CeedMultigridCompareKeys);
+  CeedCall(CeedCalloc(num_elem * elem_size, &offsets));
+  for (CeedInt i = 0; i < num_elem * elem_size; i++) {
+    const CeedInt *record = &records[i * record_size];
+
+    if (i > 0 && CeedMultigridCompareKeys(record - record_size, record)) num_nodes++;
+    offsets[record[record_size - 1]] = num_nodes;
+  }
+  if (num_elem * elem_size > 0) num_nodes++;
+  CeedCall(CeedFree(&records));
+
+  // Create restriction
+  if (num_comp > 1 && comp_stride == 1) {
+    for (CeedInt i = 0; i < num_elem * elem_size; i++) offsets[i] *= num_comp;
+  } else {
+    comp_stride = num_nodes;
+  }
+  CeedCall(CeedElemRestrictionGetCeed(rstr_fine, &ceed));
+  CeedCall(CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, comp_stride, num_nodes * num_comp, CEED_MEM_HOST, CEED_OWN_POINTER, offsets,
+                                     rstr));
+  CeedCall(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Estimate the largest eigenvalue of the Jacobi preconditioned `CeedOperator` on a multigrid level with power iteration
+
+  The estimate is left at zero if the power iteration breaks down; the caller checks it.
+
+  @param[in,out] mg    `CeedMultigrid`
+  @param[in]     level Multigrid level
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedMultigridEstimateEigenvalue(CeedMultigrid mg, CeedInt level) {
+  const CeedInt num_iter = 20;
+  CeedSize      length;
+  CeedScalar    norm, *array;
+  CeedVector    v = mg->r[level], w = mg->d[level];
+
+  // Deterministic initial guess with no vanishing components
+  CeedCall(CeedVectorGetLength(v, &length));
+  CeedCall(CeedVectorGetArrayWrite(v, CEED_MEM_HOST, &array));
+  for (CeedSize i = 0; i < length; i++) array[i] = 1.0 + 0.5 * sin((CeedScalar)(i + 1));
+  CeedCall(CeedVectorRestoreArray(v, &array));
+  CeedCall(CeedVectorNorm(v, CEED_NORM_2, &norm));
+  CeedCall(CeedVectorScale(v, 1.0 / norm));
+
+  // Power iteration on D^{-1} A
+  mg->eig_max[level] = 0.0;
+  for (CeedInt i = 0; i < num_iter; i++) {
+    CeedCall(CeedOperatorApply(mg->ops[level], v, w, CEED_REQUEST_IMMEDIATE));
+    CeedCall(CeedVectorPointwiseMult(v, mg->inv_diag[level], w));
+    CeedCall(CeedVectorNorm(v, CEED_NORM_2, &norm));
+    mg->eig_max[level] = norm;
+    if (norm == 0.0) break;
+    CeedCall(CeedVectorScale(v, 1.0 / norm));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Update the Chebyshev search direction and solution in a single pass, `d = alpha d + beta D^{-1} r` and `x = x + d`
+
+  @param[in]     inv_diag Inverse of the assembled diagonal
+  @param[in]     r        Residual `CeedVector`
+  @param[in]     alpha    Scaling for the previous search direction, or 0 to ignore the contents of `d`
+  @param[in]     beta     Scaling for the Jacobi preconditioned residual
+  @param[in,out] d        Search direction `CeedVector`
+  @param[in,out] x        Solution `CeedVector`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedMultigridChebyshevUpdate(CeedVector inv_diag, CeedVector r, CeedScalar alpha, CeedScalar beta, CeedVector d, CeedVector x) {
+  CeedSize          length;
+  const CeedScalar *inv_diag_array, *r_array;
+  CeedScalar       *d_array, *x_array;
+
+  CeedCall(CeedVectorGetLength(x, &length));
+  CeedCall(CeedVectorGetArrayRead(inv_diag, CEED_MEM_HOST, &inv_diag_array));
+  CeedCall(CeedVectorGetArrayRead(r, CEED_MEM_HOST, &r_array));
+  CeedCall(CeedVectorGetArray(x, CEED_MEM_HOST, &x_array));
+  if (alpha == 0.0) {
+    CeedCall(CeedVectorGetArrayWrite(d, CEED_MEM_HOST, &d_array));
+    CeedPragmaSIMD for (CeedSize i = 0; i < length; i++) {
+      d_array[i] = beta * inv_diag_array[i] * r_array[i];
+      x_array[i] += d_array[i];
+    }
+  } else {
+    CeedCall(CeedVectorGetArray(d, CEED_MEM_HOST, &d_array));
+    CeedPragmaSIMD for (CeedSize i = 0; i < length; i++) {
+      d_array[i] = alpha * d_array[i] + beta * inv_diag_array[i] * r_array[i];
+      x_array[i] += d_array[i];
+    }
+  }
+  CeedCall(CeedVectorRestoreArray(d, &d_array));
+  CeedCall(CeedVectorRestoreArray(x, &x_array));
+  CeedCall(CeedVectorRestoreArrayRead(r, &r_array));
+  CeedCall(CeedVectorRestoreArrayRead(inv_diag, &inv_diag_array));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply Chebyshev iterations with Jacobi preconditioning on a multigrid level, updating `x` in place.
+
+  The Chebyshev polynomial targets the interval `[0.1, 1.1] * eig_max` of the Jacobi preconditioned `CeedOperator`.
+  With host memory, the Jacobi scaling and the updates of the search direction and solution are fused into a single pass after each residual.
+
+  @param[in]     mg       `CeedMultigrid`
+  @param[in]     level    Multigrid level
+  @param[in]     num_iter Number of Chebyshev iterations
+  @param[in]     b        Right hand side `CeedVector`
+  @param[in,out] x        Solution `CeedVector`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedMultigridSmooth(CeedMultigrid mg, CeedInt level, CeedInt num_iter, CeedVector b, CeedVector x) {
+  const CeedScalar eig_min = 0.1 * mg->eig_max[level], eig_max = 1.1 * mg->eig_max[level];
+  const CeedScalar theta = (eig_max + eig_min) / 2, delta = (eig_max - eig_min) / 2, sigma = theta / delta;
+  CeedScalar       rho = 1.0 / sigma;
+  CeedMemType      mem_type;
+  CeedVector       r = mg->r[level], d = mg->d[level];
+
+  CeedCall(CeedGetPreferredMemType(mg->ceed, &mem_type));
+  for (CeedInt i = 0; i < num_iter; i++) {
+    CeedScalar alpha = 0.0, beta = 1.0 / theta;
+
+    // r = b - A x
+    CeedCall(CeedVectorCopy(b, r));
+    CeedCall(CeedOperatorApplyScaled(mg->ops[level], -1.0, x, 1.0, r, CEED_REQUEST_IMMEDIATE));
+
+    // Chebyshev coefficients, d = alpha d + beta D^{-1} r
+    if (i > 0) {
+      const CeedScalar rho_new = 1.0 / (2.0 * sigma - rho);
+
+      alpha = rho_new * rho;
+      beta  = 2.0 * rho_new / delta;
+      rho   = rho_new;
+    }
+
+    // Update search direction and solution
+    if (mem_type == CEED_MEM_HOST) {
+      CeedCall(CeedMultigridChebyshevUpdate(mg->inv_diag[level], r, alpha, beta, d, x));
+    } else {
+      CeedCall(CeedVectorPointwiseMult(r, mg->inv_diag[level], r));
+      if (i == 0) {
+        CeedCall(CeedVectorCopy(r, d));
+        CeedCall(CeedVectorScale(d, beta));
+      } else {
+        CeedCall(CeedVectorAXPBY(d, beta, alpha, r));
+      }
+      CeedCall(CeedVectorAXPY(x, 1.0, d));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply one V-cycle starting at a multigrid level, updating `x` in place
+
+  @param[in]     mg    `CeedMultigrid`
+  @param[in]     level Multigrid level
+  @param[in]     b     Right hand side `CeedVector`
+  @param[in,out] x     Solution `CeedVector`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedMultigridVCycle(CeedMultigrid mg, CeedInt level, CeedVector b, CeedVector x) {
+  if (level == mg->num_levels - 1) {
+    CeedCall(CeedMultigridSmooth(mg, level, mg->coarse_degree, b, x));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Pre-smooth
+  CeedCall(CeedMultigridSmooth(mg, level, mg->smoother_degree, b, x));
+
+  // Coarse grid correction
+  CeedCall(CeedVectorCopy(b, mg->r[level]));
+  CeedCall(CeedOperatorApplyScaled(mg->ops[level], -1.0, x, 1.0, mg->r[level], CEED_REQUEST_IMMEDIATE));
+  CeedCall(CeedOperatorApply(mg->ops_restrict[level], mg->r[level], mg->b[level + 1], CEED_REQUEST_IMMEDIATE));
+  CeedCall(CeedVectorSetValue(mg->x[level + 1], 0.0));
+  CeedCall(CeedMultigridVCycle(mg, level + 1, mg->b[level + 1], mg->x[level + 1]));
+  CeedCall(CeedOperatorApplyAdd(mg->ops_prolong[level], mg->x[level + 1], x, CEED_REQUEST_IMMEDIATE));
+
+  // Post-smooth
+  CeedCall(CeedMultigridSmooth(mg, level, mg->smoother_degree, b, x));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Build the levels, transfer `CeedOperator`, work vectors, and smoothers of a `CeedMultigrid`
+
+  @param[in,out] mg        `CeedMultigrid` with the number of levels set
+  @param[in]     op_fine   Fine grid `CeedOperator`
+  @param[in]     rstr_fine Active `CeedElemRestriction` of the fine grid `CeedOperator`
+  @param[in]     dim       Dimension of the active `CeedBasis`
+  @param[in]     num_comp  Number of components of the active `CeedBasis`
+  @param[in]     P_1d      Number of nodes in one dimension of the fine active `CeedBasis`
+  @param[in]     Q_1d      Number of quadrature points in one dimension
+  @param[in]     quad_mode Quadrature mode of the fine active `CeedBasis`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedMultigridSetupLevels(CeedMultigrid mg, CeedOperator op_fine, CeedElemRestriction rstr_fine, CeedInt dim, CeedInt num_comp, CeedInt P_1d,
+                                    CeedInt Q_1d, CeedQuadMode quad_mode) {
+  CeedBasis           basis_level = NULL;
+  CeedElemRestriction rstr_level  = NULL;
+
+  // Allocate levels
+  CeedCall(CeedOperatorGetCeed(op_fine, &mg->ceed));
+  mg->smoother_degree = 3;
+  mg->coarse_degree   = 30;
+  CeedCall(CeedCalloc(mg->num_levels, &mg->degrees));
+  CeedCall(CeedCalloc(mg->num_levels, &mg->eig_max));
+  CeedCall(CeedCalloc(mg->num_levels, &mg->ops));
+  CeedCall(CeedCalloc(mg->num_levels, &mg->ops_prolong));
+  CeedCall(CeedCalloc(mg->num_levels, &mg->ops_restrict));
+  CeedCall(CeedCalloc(mg->num_levels, &mg->inv_diag));
+  CeedCall(CeedCalloc(mg->num_levels, &mg->x));
+  CeedCall(CeedCalloc(mg->num_levels, &mg->b));
+  CeedCall(CeedCalloc(mg->num_levels, &mg->r));
+  CeedCall(CeedCalloc(mg->num_levels, &mg->d));
+  mg->degrees[0] = P_1d - 1;
+  for (CeedInt l = 1; l < mg->num_levels; l++) mg->degrees[l] = mg->degrees[l - 1] / 2;
+  CeedCall(CeedOperatorReferenceCopy(op_fine, &mg->ops[0]));
+
+  // Coarse levels
+  CeedCall(CeedElemRestrictionReferenceCopy(rstr_fine, &rstr_level));
+  for (CeedInt l = 0; l < mg->num_levels - 1; l++) {
+    CeedVector          mult;
+    CeedBasis           basis_coarse;
+    CeedElemRestriction rstr_coarse;
+
+    CeedCall(CeedMultigridCreateCoarseElemRestriction(rstr_level, dim, mg->degrees[l] + 1, mg->degrees[l + 1] + 1, &rstr_coarse));
+    CeedCall(CeedBasisCreateTensorH1Lagrange(mg->ceed, dim, num_comp, mg->degrees[l + 1] + 1, Q_1d, quad_mode, &basis_coarse));
+    CeedCall(CeedElemRestrictionCreateVector(rstr_level, &mult, NULL));
+    CeedCall(CeedVectorSetValue(mult, 1.0));
+    CeedCall(CeedOperatorMultigridLevelCreate(mg->ops[l], mult, rstr_coarse, basis_coarse, &mg->ops[l + 1], &mg->ops_prolong[l],
+                                              &mg->ops_restrict[l]));
+    CeedCall(CeedVectorDestroy(&mult));
+    CeedCall(CeedElemRestrictionDestroy(&rstr_level));
+    CeedCall(CeedBasisDestroy(&basis_level));
+    rstr_level  = rstr_coarse;
+    basis_level = basis_coarse;
+  }
+  CeedCall(CeedElemRestrictionDestroy(&rstr_level));
+  CeedCall(CeedBasisDestroy(&basis_level));
+
+  // Level vectors and smoothers
+  for (CeedInt l = 0; l < mg->num_levels; l++) {
+    CeedSize length;
+
+    CeedCall(CeedOperatorGetActiveVectorLengths(mg->ops[l], NULL, &length));
+    CeedCall(CeedVectorCreate(mg->ceed, length, &mg->inv_diag[l]));
+    CeedCall(CeedVectorCreate(mg->ceed, length, &mg->r[l]));
+    CeedCall(CeedVectorCreate(mg->ceed, length, &mg->d[l]));
+    if (l > 0) {
+      CeedCall(CeedVectorCreate(mg->ceed, length, &mg->x[l]));
+      CeedCall(CeedVectorCreate(mg->ceed, length, &mg->b[l]));
+    }
+    CeedCall(CeedOperatorLinearAssembleDiagonal(mg->ops[l], mg->inv_diag[l], CEED_REQUEST_IMMEDIATE));
+    CeedCall(CeedVectorReciprocal(mg->inv_diag[l]));
+    CeedCall(CeedMultigridEstimateEigenvalue(mg, l));
+    CeedCheck(mg->eig_max[l] > 0.0, mg->ceed, CEED_ERROR_MINOR, "Unable to estimate eigenvalues for multigrid level %" CeedInt_FMT, l);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Increment the reference counter for a `CeedMultigrid`
+
+  @param[in,out] mg `CeedMultigrid` to increment the reference counter
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedMultigridReference(CeedMultigrid mg) {
+  mg->ref_count++;
+  return CEED_ERROR_SUCCESS;
+}
+
+/// @}
+
+/// ----------------------------------------------------------------------------
+/// CeedMultigrid Public API
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedOperatorUser
+/// @{
+
+/**
+  @brief Create a p-multigrid hierarchy for a `CeedOperator`.
+
+  The polynomial degree of the active `CeedBasis` is halved on each coarser level until linear elements are reached.
+  Coarse `CeedElemRestriction` are derived from the topology of the fine `CeedElemRestriction`, coarse `CeedOperator` are rediscretized with the fine
+  `CeedQFunction`, and level transfer `CeedOperator` are created with @ref CeedOperatorMultigridLevelCreate().
+  Each level is smoothed with Chebyshev iterations preconditioned by the assembled diagonal, with the largest eigenvalue estimated by power iteration.
+
+  Note: Only non-composite `CeedOperator` with a single active tensor product H^1 `CeedBasis` using Gauss or Gauss-Lobatto quadrature and a standard
+  `CeedElemRestriction` are supported.
+
+  Note: Calling this function asserts that setup is complete and sets all level `CeedOperator` as immutable.
+
+  If any level fails to build, the partially built hierarchy is destroyed and `*mg` is set to `NULL`.
+
+  @param[in]  op_fine Fine grid `CeedOperator`
+  @param[out] mg      Address of the variable where the newly created `CeedMultigrid` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedMultigridCreate(CeedOperator op_fine, CeedMultigrid *mg) {
+  int                 ierr;
+  bool                is_composite, is_tensor;
+  CeedInt             dim, num_comp, P_1d, Q_1d, num_levels = 1;
+  CeedQuadMode        quad_mode;
+  CeedBasis           basis_fine;
+  CeedElemRestriction rstr_fine;
+
+  CeedCall(CeedOperatorCheckReady(op_fine));
+  CeedCall(CeedOperatorIsComposite(op_fine, &is_composite));
+  CeedCheck(!is_composite, CeedOperatorReturnCeed(op_fine), CEED_ERROR_UNSUPPORTED,
+            "Automatic multigrid setup for composite operators not supported");
+
+  // Active basis
+  CeedCall(CeedOperatorGetActiveBasis(op_fine, &basis_fine));
+  CeedCheck(basis_fine != CEED_BASIS_NONE, CeedOperatorReturnCeed(op_fine), CEED_ERROR_UNSUPPORTED,
+            "Automatic multigrid setup requires an active basis");
+  CeedCall(CeedBasisIsTensor(basis_fine, &is_tensor));
+  if (!is_tensor) CeedCall(CeedBasisDestroy(&basis_fine));
+  CeedCheck(is_tensor, CeedOperatorReturnCeed(op_fine), CEED_ERROR_UNSUPPORTED, "Automatic multigrid setup only supported for tensor product bases");
+  CeedCall(CeedBasisGetDimension(basis_fine, &dim));
+  CeedCall(CeedBasisGetNumComponents(basis_fine, &num_comp));
+  CeedCall(CeedBasisGetNumNodes1D(basis_fine, &P_1d));
+  CeedCall(CeedBasisGetNumQuadraturePoints1D(basis_fine, &Q_1d));
+  {
+    const CeedScalar *q_ref_fine;
+    CeedScalar       *q_ref, *q_weight;
+    bool              is_gauss = true, is_lobatto = true;
+
+    CeedCall(CeedBasisGetQRef(basis_fine, &q_ref_fine));
+    CeedCall(CeedCalloc(Q_1d, &q_ref));
+    CeedCall(CeedCalloc(Q_1d, &q_weight));
+    CeedCall(CeedGaussQuadrature(Q_1d, q_ref, q_weight));
+    for (CeedInt i = 0; i < Q_1d; i++) is_gauss = is_gauss && fabs(q_ref[i] - q_ref_fine[i]) < 10 * CEED_EPSILON;
+    CeedCall(CeedLobattoQuadrature(Q_1d, q_ref, q_weight));
+    for (CeedInt i = 0; i < Q_1d; i++) is_lobatto = is_lobatto && fabs(q_ref[i] - q_ref_fine[i]) < 10 * CEED_EPSILON;
+    CeedCall(CeedFree(&q_ref));
+    CeedCall(CeedFree(&q_weight));
+    quad_mode = is_gauss ? CEED_GAUSS : CEED_GAUSS_LOBATTO;
+    if (!is_gauss && !is_lobatto) CeedCall(CeedBasisDestroy(&basis_fine));
+    CeedCheck(is_gauss || is_lobatto, CeedOperatorReturnCeed(op_fine), CEED_ERROR_UNSUPPORTED,
+              "Automatic multigrid setup only supported for Gauss or Gauss-Lobatto quadrature");
+  }
+  CeedCall(CeedBasisDestroy(&basis_fine));
+  for (CeedInt p = P_1d - 1; p > 1; p /= 2) num_levels++;
+
+  // Active restriction, coarse level restrictions are built from it with the same type and tensor element sizes
+  {
+    CeedInt             elem_size;
+    CeedRestrictionType rstr_type;
+
+    CeedCall(CeedOperatorGetActiveElemRestriction(op_fine, &rstr_fine));
+    CeedCall(CeedElemRestrictionGetType(rstr_fine, &rstr_type));
+    CeedCall(CeedElemRestrictionGetElementSize(rstr_fine, &elem_size));
+    if (rstr_type != CEED_RESTRICTION_STANDARD || elem_size != CeedIntPow(P_1d, dim)) CeedCall(CeedElemRestrictionDestroy(&rstr_fine));
+    CeedCheck(rstr_type == CEED_RESTRICTION_STANDARD, CeedOperatorReturnCeed(op_fine), CEED_ERROR_UNSUPPORTED,
+              "Automatic multigrid coarsening only supported for standard element restrictions");
+    CeedCheck(elem_size == CeedIntPow(P_1d, dim), CeedOperatorReturnCeed(op_fine), CEED_ERROR_DIMENSION,
+              "Fine element restriction size %" CeedInt_FMT " does not match tensor basis with %" CeedInt_FMT " nodes per dimension", elem_size,
+              P_1d);
+  }
+
+  // Allocate hierarchy, destroying it if any level fails to build
+  CeedCall(CeedCalloc(1, mg));
+  (*mg)->ref_count  = 1;
+  (*mg)->num_levels = num_levels;
+  ierr              = CeedMultigridSetupLevels(*mg, op_fine, rstr_fine, dim, num_comp, P_1d, Q_1d, quad_mode);
+  if (ierr != CEED_ERROR_SUCCESS) CeedCall(CeedMultigridDestroy(mg));
+  CeedCall(CeedElemRestrictionDestroy(&rstr_fine));
+  return ierr;
+}
+
+/**
+  @brief Copy the pointer to a `CeedMultigrid`.
+
+  Both pointers should be destroyed with @ref CeedMultigridDestroy().
+
+  Note: If the value of `*mg_copy` passed to this function is non-`NULL`, then it is assumed that `*mg_copy` is a pointer to a `CeedMultigrid`.
+        This `CeedMultigrid` will be destroyed if `*mg_copy` is the only reference to this `CeedMultigrid`.
+
+  @param[in]     mg      `CeedMultigrid` to copy reference to
+  @param[in,out] mg_copy Variable to store copied reference
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedMultigridReferenceCopy(CeedMultigrid mg, CeedMultigrid *mg_copy) {
+  CeedCall(CeedMultigridReference(mg));
+  CeedCall(CeedMultigridDestroy(mg_copy));
+  *mg_copy = mg;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Set the number of Chebyshev iterations used for pre- and post-smoothing on each level of a `CeedMultigrid`
+
+  @param[in,out] mg     `CeedMultigrid`
+  @param[in]     degree Number of Chebyshev iterations, default 3
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedMultigridSetSmootherDegree(CeedMultigrid mg, CeedInt degree) {
+  CeedCheck(degree > 0, mg->ceed, CEED_ERROR_INCOMPATIBLE, "Smoother degree must be positive");
+  mg->smoother_degree = degree;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Set the number of Chebyshev iterations used to solve on the coarsest level of a `CeedMultigrid`
+
+  @param[in,out] mg     `CeedMultigrid`
+  @param[in]     degree Number of Chebyshev iterations, default 30
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedMultigridSetCoarseDegree(CeedMultigrid mg, CeedInt degree) {
+  CeedCheck(degree > 0, mg->ceed, CEED_ERROR_INCOMPATIBLE, "Coarse degree must be positive");
+  mg->coarse_degree = degree;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the number of levels in a `CeedMultigrid`, including the fine level
+
+  @param[in]  mg         `CeedMultigrid`
+  @param[out] num_levels Variable to store number of levels
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedMultigridGetNumLevels(CeedMultigrid mg, CeedInt *num_levels) {
+  *num_levels = mg->num_levels;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the `CeedOperator` for a level of a `CeedMultigrid`, with level 0 the fine level.
+
+  Note: Caller is responsible for destroying the `op` with @ref CeedOperatorDestroy().
+
+  @param[in]  mg    `CeedMultigrid`
+  @param[in]  level Multigrid level
+  @param[out] op    Variable to store level `CeedOperator`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedMultigridGetLevelOperator(CeedMultigrid mg, CeedInt level, CeedOperator *op) {
+  CeedCheck(level >= 0 && level < mg->num_levels, mg->ceed, CEED_ERROR_DIMENSION,
+            "Invalid multigrid level %" CeedInt_FMT ", hierarchy has %" CeedInt_FMT " levels", level, mg->num_levels);
+  *op = NULL;
+  CeedCall(CeedOperatorReferenceCopy(mg->ops[level], op));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply one multigrid V-cycle for `A x = b`, updating `x` in place.
+
+  Use a zeroed `x` to apply the V-cycle as a preconditioner.
+
+  @param[in]     mg `CeedMultigrid`
+  @param[in]     b  Right hand side `CeedVector`
+  @param[in,out] x  Solution `CeedVector`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedMultigridApply(CeedMultigrid mg, CeedVector b, CeedVector x) {
+  CeedCheck(b != x, mg->ceed, CEED_ERROR_INCOMPATIBLE, "Multigrid right hand side and solution must be different vectors");
+  CeedCall(CeedMultigridVCycle(mg, 0, b, x));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Destroy a `CeedMultigrid`
+
+  @param[in,out] mg `CeedMultigrid` to destroy
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedMultigridDestroy(CeedMultigrid *mg) {
+  if (!*mg || --(*mg)->ref_count > 0) {
+    *mg = NULL;
+    return CEED_ERROR_SUCCESS;
+  }
+  for (CeedInt l = 0; l < (*mg)->num_levels; l++) {
+    if ((*mg)->ops) CeedCall(CeedOperatorDestroy(&(*mg)->ops[l]));
+    if ((*mg)->ops_prolong) CeedCall(CeedOperatorDestroy(&(*mg)->ops_prolong[l]));
+    if ((*mg)->ops_restrict) CeedCall(CeedOperatorDestroy(&(*mg)->ops_restrict[l]));
+    if ((*mg)->inv_diag) CeedCall(CeedVectorDestroy(&(*mg)->inv_diag[l]));
+    if ((*mg)->x) CeedCall(CeedVectorDestroy(&(*mg)->x[l]));
+    if ((*mg)->b) CeedCall(CeedVectorDestroy(&(*mg)->b[l]));
+    if ((*mg)->r) CeedCall(CeedVectorDestroy(&(*mg)->r[l]));
+    if ((*mg)->d) CeedCall(CeedVectorDestroy(&(*mg)->d[l]));
+  }
+  CeedCall(CeedFree(&(*mg)->degrees));
+  CeedCall(CeedFree(&(*mg)->eig_max));
+  CeedCall(CeedFree(&(*mg)->ops));
+  CeedCall(CeedFree(&(*mg)->ops_prolong));
+  CeedCall(CeedFree(&(*mg)->ops_restrict));
+  CeedCall(CeedFree(&(*mg)->inv_diag));
+  CeedCall(CeedFree(&(*mg)->x));
+  CeedCall(CeedFree(&(*mg)->b));
+  CeedCall(CeedFree(&(*mg)->r));
+  CeedCall(CeedFree(&(*mg)->d));
+  CeedCall(CeedDestroy(&(*mg)->ceed));
+  CeedCall(CeedFree(mg));
+  return CEED_ERROR_SUCCESS;
+}
+
+/// @}
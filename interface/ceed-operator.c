@@ -124,6 +124,24 @@ static int CeedOperatorFieldView(CeedOperatorField op_field, CeedQFunctionField
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Check if a `CeedOperator` or any of its sub-operators is applied with element assembly
+
+  @param[in]  op                `CeedOperator`
+  @param[out] has_elem_assembly Variable to store element assembly status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorHasElementAssembly(CeedOperator op, bool *has_elem_assembly) {
+  *has_elem_assembly = op->use_elem_assembly;
+  for (CeedInt i = 0; i < op->num_suboperators && !*has_elem_assembly; i++) {
+    CeedCall(CeedOperatorHasElementAssembly(op->sub_operators[i], has_elem_assembly));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief View a single `CeedOperator`
 
@@ -172,6 +190,13 @@ int CeedOperatorSingleView(CeedOperator op, bool sub, FILE *stream) {
   for (CeedInt i = 0; i < num_output_fields; i++) {
     CeedCall(CeedOperatorFieldView(op_output_fields[i], qf_output_fields[i], i, sub, 0, stream));
   }
+  if (op->use_elem_assembly) {
+    CeedSize num_bytes;
+
+    CeedCall(CeedOperatorGetElementAssemblyMemory(op, &num_bytes));
+    fprintf(stream, "%s  Element assembly: %" CeedSize_FMT " bytes\n", pre, num_bytes);
+  }
+  if (op->View) CeedCall(op->View(op, sub, stream));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -534,6 +559,177 @@ static int CeedOperatorContextRestoreGenericRead(CeedOperator op, CeedContextFie
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Build or update the `CeedOperator` applying the transpose of the active action of a non-composite `CeedOperator`.
+
+  If `op` was created with a transpose `CeedQFunction` `dqfT`, the fields of `dqfT` are matched by name to the fields of `op`.
+  Otherwise, the transpose is applied at quadrature points with the linearized `CeedQFunction` from @ref CeedOperatorLinearAssembleQFunctionBuildOrUpdate().
+  The transpose `CeedOperator` is built once, and the linearized `CeedQFunction` is only re-assembled after @ref CeedOperatorSetQFunctionAssemblyDataUpdateNeeded().
+
+  @param[in,out] op      `CeedOperator` to set up transpose for
+  @param[in]     request Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorSetupTranspose(CeedOperator op, CeedRequest *request) {
+  bool                is_at_points;
+  Ceed                ceed;
+  CeedInt             num_input_fields, num_output_fields;
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  CeedOperatorField  *op_input_fields, *op_output_fields;
+  CeedQFunction       qf_transpose;
+  CeedVector          assembled      = NULL;
+  CeedElemRestriction assembled_rstr = NULL;
+
+  CeedCall(CeedOperatorIsAtPoints(op, &is_at_points));
+  CeedCheck(!is_at_points, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED, "Transpose application is not supported for AtPoints CeedOperator");
+
+  // User provided transpose QFunction
+  if (op->dqfT) {
+    if (op->op_transpose) return CEED_ERROR_SUCCESS;
+
+    CeedCall(CeedOperatorGetCeed(op, &ceed));
+    CeedCall(CeedOperatorCreate(ceed, op->dqfT, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op->op_transpose));
+    CeedCall(CeedQFunctionGetFields(op->dqfT, &num_input_fields, &qf_input_fields, &num_output_fields, &qf_output_fields));
+    for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+      const char         *field_name;
+      CeedElemRestriction rstr;
+      CeedBasis           basis;
+      CeedVector          vec;
+      CeedOperatorField   op_field;
+
+      CeedCall(CeedQFunctionFieldGetName(i < num_input_fields ? qf_input_fields[i] : qf_output_fields[i - num_input_fields], &field_name));
+      CeedCall(CeedOperatorGetFieldByName(op, field_name, &op_field));
+      if (!op_field) {
+        // Discard the partially built transpose CeedOperator, so later applications do not use it
+        CeedCall(CeedOperatorDestroy(&op->op_transpose));
+        CeedCall(CeedDestroy(&ceed));
+      }
+      CeedCheck(op_field, CeedOperatorReturnCeed(op), CEED_ERROR_INCOMPATIBLE,
+                "Transpose CeedQFunction field \"%s\" does not match any CeedOperator field", field_name);
+      CeedCall(CeedOperatorFieldGetData(op_field, NULL, &rstr, &basis, &vec));
+      CeedCall(CeedOperatorSetField(op->op_transpose, field_name, rstr, basis, vec));
+      CeedCall(CeedElemRestrictionDestroy(&rstr));
+      CeedCall(CeedBasisDestroy(&basis));
+      CeedCall(CeedVectorDestroy(&vec));
+    }
+    CeedCall(CeedDestroy(&ceed));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Linearized QFunction, re-assembled only when flagged by CeedOperatorSetQFunctionAssemblyDataUpdateNeeded()
+  if (op->op_transpose) {
+    CeedQFunctionAssemblyData data;
+
+    CeedCall(CeedOperatorGetQFunctionAssemblyData(op, &data));
+    if (!data->needs_data_update) return CEED_ERROR_SUCCESS;
+  }
+  CeedCall(CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, &assembled, &assembled_rstr, request));
+  {
+    CeedQFunctionAssemblyData data;
+
+    // The fallback CeedOperator may hold the assembled data, so clear the flag on this CeedOperator as well
+    CeedCall(CeedOperatorGetQFunctionAssemblyData(op, &data));
+    CeedCall(CeedQFunctionAssemblyDataSetUpdateNeeded(data, false));
+  }
+  // The transpose CeedOperator is kept while the assembled data is updated in place
+  if (op->op_transpose) {
+    CeedOperatorField op_field;
+    CeedVector        q_data;
+    bool              is_current;
+
+    CeedCall(CeedOperatorGetFieldByName(op->op_transpose, "linearized qfunction", &op_field));
+    CeedCall(CeedOperatorFieldGetVector(op_field, &q_data));
+    is_current = q_data == assembled;
+    CeedCall(CeedVectorDestroy(&q_data));
+    if (is_current) {
+      CeedCall(CeedVectorDestroy(&assembled));
+      CeedCall(CeedElemRestrictionDestroy(&assembled_rstr));
+      return CEED_ERROR_SUCCESS;
+    }
+    CeedCall(CeedOperatorDestroy(&op->op_transpose));
+  }
+
+  // Transpose CeedOperator, with the active outputs of op as inputs and the active inputs of op as outputs
+  CeedCall(CeedOperatorGetCeed(op, &ceed));
+  CeedCall(CeedQFunctionGetFields(op->qf, &num_input_fields, &qf_input_fields, &num_output_fields, &qf_output_fields));
+  CeedCall(CeedOperatorGetFields(op, NULL, &op_input_fields, NULL, &op_output_fields));
+
+  // -- QFunction
+  {
+    CeedInt num_active_in = 0, num_active_out = 0, size_in = 0, size_out = 0, q_data_size;
+    int32_t sizes_in[CEED_FIELD_MAX] = {0}, sizes_out[CEED_FIELD_MAX] = {0};
+
+    CeedCall(CeedQFunctionCreateInteriorByName(ceed, "AssembledTranspose", &qf_transpose));
+    CeedCall(CeedElemRestrictionGetNumComponents(assembled_rstr, &q_data_size));
+    CeedCall(CeedQFunctionAddInput(qf_transpose, "linearized qfunction", q_data_size, CEED_EVAL_NONE));
+    for (CeedInt i = 0; i < num_output_fields + num_input_fields; i++) {
+      const bool         is_output = i < num_output_fields;
+      const char        *field_name;
+      CeedInt            size;
+      CeedEvalMode       eval_mode;
+      CeedVector         vec;
+      CeedQFunctionField qf_field = is_output ? qf_output_fields[i] : qf_input_fields[i - num_output_fields];
+
+      CeedCall(CeedOperatorFieldGetVector(is_output ? op_output_fields[i] : op_input_fields[i - num_output_fields], &vec));
+      if (vec == CEED_VECTOR_ACTIVE) {
+        CeedCall(CeedQFunctionFieldGetData(qf_field, &field_name, &size, &eval_mode));
+        if (is_output) {
+          CeedCall(CeedQFunctionAddInput(qf_transpose, field_name, size, eval_mode));
+          sizes_in[num_active_in++] = size;
+          size_in += size;
+        } else {
+          CeedCall(CeedQFunctionAddOutput(qf_transpose, field_name, size, eval_mode));
+          sizes_out[num_active_out++] = size;
+          size_out += size;
+        }
+      }
+      CeedCall(CeedVectorDestroy(&vec));
+    }
+    CeedCall(CeedQFunctionSetUserFlopsEstimate(qf_transpose, 2 * size_in * size_out));
+
+    // -- Operator
+    CeedCall(CeedOperatorCreate(ceed, qf_transpose, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op->op_transpose));
+    CeedCall(CeedOperatorSetField(op->op_transpose, "linearized qfunction", assembled_rstr, CEED_BASIS_NONE, assembled));
+    for (CeedInt i = 0; i < num_output_fields + num_input_fields; i++) {
+      const char         *field_name;
+      CeedElemRestriction rstr;
+      CeedBasis           basis;
+      CeedVector          vec;
+
+      CeedCall(CeedOperatorFieldGetData(i < num_output_fields ? op_output_fields[i] : op_input_fields[i - num_output_fields], &field_name, &rstr,
+                                        &basis, &vec));
+      if (vec == CEED_VECTOR_ACTIVE) CeedCall(CeedOperatorSetField(op->op_transpose, field_name, rstr, basis, vec));
+      CeedCall(CeedElemRestrictionDestroy(&rstr));
+      CeedCall(CeedBasisDestroy(&basis));
+      CeedCall(CeedVectorDestroy(&vec));
+    }
+
+    // -- Context
+    {
+      CeedContextFieldLabel label;
+
+      CeedCall(CeedOperatorGetContextFieldLabel(op->op_transpose, "num inputs", &label));
+      CeedCall(CeedOperatorSetContextInt32(op->op_transpose, label, &num_active_in));
+      CeedCall(CeedOperatorGetContextFieldLabel(op->op_transpose, "num outputs", &label));
+      CeedCall(CeedOperatorSetContextInt32(op->op_transpose, label, &num_active_out));
+      CeedCall(CeedOperatorGetContextFieldLabel(op->op_transpose, "input sizes", &label));
+      CeedCall(CeedOperatorSetContextInt32(op->op_transpose, label, sizes_in));
+      CeedCall(CeedOperatorGetContextFieldLabel(op->op_transpose, "output sizes", &label));
+      CeedCall(CeedOperatorSetContextInt32(op->op_transpose, label, sizes_out));
+    }
+  }
+
+  // Cleanup
+  CeedCall(CeedDestroy(&ceed));
+  CeedCall(CeedVectorDestroy(&assembled));
+  CeedCall(CeedElemRestrictionDestroy(&assembled_rstr));
+  CeedCall(CeedQFunctionDestroy(&qf_transpose));
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -634,6 +830,23 @@ int CeedOperatorIsSetupDone(CeedOperator op, bool *is_setup_done) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the number of elements per chunk of E-vector data requested for a `CeedOperator`.
+
+  See @ref CeedOperatorSetChunkSize() for the meaning of the returned value.
+
+  @param[in]  op         `CeedOperator`
+  @param[out] chunk_size Variable to store chunk size
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorGetChunkSize(CeedOperator op, CeedInt *chunk_size) {
+  *chunk_size = op->chunk_size;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get the `CeedQFunction` associated with a `CeedOperator`
 
@@ -654,6 +867,46 @@ int CeedOperatorGetQFunction(CeedOperator op, CeedQFunction *qf) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the `CeedQFunction` defining the action of the Jacobian associated with a `CeedOperator`
+
+  @param[in]  op  `CeedOperator`
+  @param[out] dqf Variable to store `CeedQFunction`, or `NULL` if none was given
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorGetDQFunction(CeedOperator op, CeedQFunction *dqf) {
+  bool is_composite;
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  CeedCheck(!is_composite, CeedOperatorReturnCeed(op), CEED_ERROR_MINOR, "Not defined for composite operator");
+  *dqf = NULL;
+  if (op->dqf) CeedCall(CeedQFunctionReferenceCopy(op->dqf, dqf));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the `CeedQFunction` defining the action of the transpose of the Jacobian associated with a `CeedOperator`
+
+  @param[in]  op   `CeedOperator`
+  @param[out] dqfT Variable to store `CeedQFunction`, or `NULL` if none was given
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorGetDQFunctionTranspose(CeedOperator op, CeedQFunction *dqfT) {
+  bool is_composite;
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  CeedCheck(!is_composite, CeedOperatorReturnCeed(op), CEED_ERROR_MINOR, "Not defined for composite operator");
+  *dqfT = NULL;
+  if (op->dqfT) CeedCall(CeedQFunctionReferenceCopy(op->dqfT, dqfT));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get a boolean value indicating if the `CeedOperator` is composite
 
@@ -669,6 +922,47 @@ int CeedOperatorIsComposite(CeedOperator op, bool *is_composite) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get a boolean value indicating if the `CeedOperator` is a product of `CeedOperator`
+
+  Product `CeedOperator` are also composite; the sub-operators are stored in order of application, inner `CeedOperator` first.
+
+  @param[in]  op         `CeedOperator`
+  @param[out] is_product Variable to store product status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorIsProduct(CeedOperator op, bool *is_product) {
+  *is_product = op->is_product;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the zeroed intermediate L-vector of a product `CeedOperator`, created on first use
+
+  Backends applying the inner and outer `CeedOperator` separately should use this `CeedVector` rather than holding their own.
+
+  @param[in]  op  Product `CeedOperator`
+  @param[out] mid Variable to store the intermediate `CeedVector`, not referenced
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorProductGetIntermediateVector(CeedOperator op, CeedVector *mid) {
+  if (!op->product_mid) {
+    CeedSize mid_length;
+
+    CeedCall(CeedOperatorGetActiveVectorLengths(op->sub_operators[0], NULL, &mid_length));
+    CeedCall(CeedVectorCreate(CeedOperatorReturnCeed(op), mid_length, &op->product_mid));
+  }
+  CeedCall(CeedVectorSetValue(op->product_mid, 0.0));
+  *mid = op->product_mid;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get the backend data of a `CeedOperator`
 
@@ -824,6 +1118,10 @@ int CeedOperatorCreateAtPoints(Ceed ceed, CeedQFunction qf, CeedQFunction dqf, C
 /**
   @brief Create a composite `CeedOperator` that composes the action of several `CeedOperator`
 
+  Backends may apply sub-operators that share active `CeedElemRestriction` and `CeedBasis` objects in a single element loop.
+  Only `/cpu/self/ref/serial` does so, and only for @ref CeedOperatorApply(), @ref CeedOperatorApplyAdd(), @ref CeedOperatorApplyMulti(), and scaled applications.
+  Transpose applications, and sub-operators created on other backends, apply each sub-operator separately.
+
   @param[in]  ceed `Ceed` object used to create the `CeedOperator`
   @param[out] op   Address of the variable where the newly created composite `CeedOperator` will be stored
 
@@ -855,6 +1153,60 @@ int CeedCompositeOperatorCreate(Ceed ceed, CeedOperator *op) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Create a `CeedOperator` applying the product `op_outer * op_inner` of two `CeedOperator`
+
+  The active output of `op_inner` is the active input of `op_outer`.
+  Backends may apply both `CeedOperator` element by element, passing the intermediate E-vector directly from `op_inner` to `op_outer`, when the active output `CeedElemRestriction` of `op_inner` is the active input `CeedElemRestriction` of `op_outer` and maps each E-vector entry to a distinct L-vector entry.
+  Otherwise, the intermediate result is stored in an L-vector.
+
+  @note Product `CeedOperator` support application but not linear assembly.
+
+  @param[in]  ceed     `Ceed` object used to create the `CeedOperator`
+  @param[in]  op_outer `CeedOperator` applied second
+  @param[in]  op_inner `CeedOperator` applied first
+  @param[out] op       Address of the variable where the newly created product `CeedOperator` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorCreateProduct(Ceed ceed, CeedOperator op_outer, CeedOperator op_inner, CeedOperator *op) {
+  CeedSize inner_input_size, inner_output_size, outer_input_size, outer_output_size;
+
+  if (!ceed->ProductOperatorCreate) {
+    Ceed delegate;
+
+    CeedCall(CeedGetObjectDelegate(ceed, &delegate, "Operator"));
+    if (delegate) {
+      CeedCall(CeedOperatorCreateProduct(delegate, op_outer, op_inner, op));
+      CeedCall(CeedDestroy(&delegate));
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+
+  CeedCall(CeedOperatorGetActiveVectorLengths(op_inner, &inner_input_size, &inner_output_size));
+  CeedCall(CeedOperatorGetActiveVectorLengths(op_outer, &outer_input_size, &outer_output_size));
+  CeedCheck(inner_output_size == outer_input_size, ceed, CEED_ERROR_INCOMPATIBLE,
+            "Inner CeedOperator active output length %" CeedSize_FMT " does not match outer CeedOperator active input length %" CeedSize_FMT,
+            inner_output_size, outer_input_size);
+
+  CeedCall(CeedCalloc(1, op));
+  CeedCall(CeedReferenceCopy(ceed, &(*op)->ceed));
+  (*op)->ref_count    = 1;
+  (*op)->is_composite = true;
+  (*op)->is_product   = true;
+  CeedCall(CeedCalloc(2, &(*op)->sub_operators));
+  CeedCall(CeedOperatorReferenceCopy(op_inner, &(*op)->sub_operators[0]));
+  CeedCall(CeedOperatorReferenceCopy(op_outer, &(*op)->sub_operators[1]));
+  (*op)->num_suboperators = 2;
+  (*op)->input_size       = inner_input_size;
+  (*op)->output_size      = outer_output_size;
+
+  if (ceed->ProductOperatorCreate) CeedCall(ceed->ProductOperatorCreate(*op));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Copy the pointer to a `CeedOperator`.
 
@@ -1267,6 +1619,7 @@ int CeedCompositeOperatorAddSub(CeedOperator composite_op, CeedOperator sub_op)
   bool is_immutable;
 
   CeedCheck(composite_op->is_composite, CeedOperatorReturnCeed(composite_op), CEED_ERROR_MINOR, "CeedOperator is not a composite operator");
+  CeedCheck(!composite_op->is_product, CeedOperatorReturnCeed(composite_op), CEED_ERROR_MINOR, "Cannot add sub-operators to a product operator");
   CeedCheck(composite_op->num_suboperators < CEED_COMPOSITE_MAX, CeedOperatorReturnCeed(composite_op), CEED_ERROR_UNSUPPORTED,
             "Cannot add additional sub-operators");
   CeedCall(CeedOperatorIsImmutable(composite_op, &is_immutable));
@@ -1444,7 +1797,17 @@ int CeedOperatorGetActiveVectorLengths(CeedOperator op, CeedSize *input_size, Ce
   if (output_size) *output_size = op->output_size;
 
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
-  if (is_composite && (op->input_size == -1 || op->output_size == -1)) {
+  if (op->is_product && (op->input_size == -1 || op->output_size == -1)) {
+    CeedSize inner_output_size, outer_input_size;
+
+    CeedCall(CeedOperatorGetActiveVectorLengths(op->sub_operators[0], &op->input_size, &inner_output_size));
+    CeedCall(CeedOperatorGetActiveVectorLengths(op->sub_operators[1], &outer_input_size, &op->output_size));
+    CeedCheck(inner_output_size == outer_input_size, CeedOperatorReturnCeed(op), CEED_ERROR_MAJOR,
+              "Inner CeedOperator active output length %" CeedSize_FMT " does not match outer CeedOperator active input length %" CeedSize_FMT,
+              inner_output_size, outer_input_size);
+    if (input_size) *input_size = op->input_size;
+    if (output_size) *output_size = op->output_size;
+  } else if (is_composite && (op->input_size == -1 || op->output_size == -1)) {
     CeedInt       num_suboperators;
     CeedOperator *sub_operators;
 
@@ -1498,9 +1861,186 @@ int CeedOperatorSetQFunctionAssemblyReuse(CeedOperator op, bool reuse_assembly_d
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Set the number of elements per chunk of E-vector data processed by a `CeedOperator`.
+
+  Backends that support chunking restrict, apply, and transpose restrict the active fields `chunk_size` elements at a time, so that the E-vector working set stays resident in cache instead of streaming full E-vectors through memory.
+  When `chunk_size = 0` (default), the backend processes all elements at once.
+  When `chunk_size = -1`, the backend picks a chunk size to fit its E-vector working set in cache.
+  Backends may round `chunk_size` up to a multiple of their element block size.
+  Backends that keep basis evaluations of passive inputs across applications do not keep them for a `CeedOperator` with a nonzero `chunk_size`, so the memory used stays proportional to the chunk size.
+
+  This must be set before the first application of the `CeedOperator`.
+
+  @param[in] op         `CeedOperator`
+  @param[in] chunk_size Number of elements per chunk, 0 for all elements, or -1 for a backend determined size
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Advanced
+**/
+int CeedOperatorSetChunkSize(CeedOperator op, CeedInt chunk_size) {
+  bool is_composite;
+
+  CeedCheck(chunk_size >= -1, CeedOperatorReturnCeed(op), CEED_ERROR_MINOR, "Chunk size must be non-negative or -1");
+  CeedCheck(!op->is_backend_setup, CeedOperatorReturnCeed(op), CEED_ERROR_MINOR, "Chunk size must be set before the CeedOperator is applied");
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  if (is_composite) {
+    for (CeedInt i = 0; i < op->num_suboperators; i++) {
+      CeedCall(CeedOperatorSetChunkSize(op->sub_operators[i], chunk_size));
+    }
+  } else {
+    op->chunk_size = chunk_size;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Set the subset of elements a `CeedOperator` is applied on.
+
+  Only elements with `mask[e] = true` contribute to the outputs of subsequent applications of the `CeedOperator`.
+  Backends restrict, apply the `CeedBasis` and `CeedQFunction`, and transpose restrict only ranges of element blocks that contain selected elements.
+  The mask is copied and may be changed between applications, such as when updating a small active set of elements every step.
+  Pass `NULL` to apply the `CeedOperator` on all elements again.
+
+  @note The mask only affects application of the `CeedOperator`, not assembly.
+
+  @param[in] op   `CeedOperator`
+  @param[in] mask Array of length `num_elem` selecting the elements to apply the `CeedOperator` on, or `NULL` for all elements
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Advanced
+**/
+int CeedOperatorSetElementMask(CeedOperator op, const bool *mask) {
+  bool is_composite;
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  CeedCheck(!is_composite, CeedOperatorReturnCeed(op), CEED_ERROR_MINOR,
+            "Element masks must be set on the sub-operators of a composite CeedOperator");
+  CeedCall(CeedOperatorCheckReady(op));
+  CeedCheck(op->SetElementMask, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED, "Backend does not implement CeedOperatorSetElementMask");
+  CeedCall(op->SetElementMask(op, mask));
+
+  // Copy for element assembly
+  CeedCall(CeedFree(&op->elem_mask));
+  if (mask) {
+    CeedCall(CeedCalloc(op->num_elem, &op->elem_mask));
+    memcpy(op->elem_mask, mask, op->num_elem * sizeof(bool));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Set whether a `CeedOperator` is applied with precomputed dense element matrices.
+
+  When `use_elem_assembly = true`, the element matrices of the `CeedOperator` are assembled as in @ref CeedOperatorLinearAssemble() on the next application.
+  Subsequent applications restrict the active input, apply the element matrices as a batched dense matrix-vector product, and transpose restrict to the active output, skipping the `CeedBasis` and `CeedQFunction` work.
+  This is generally faster than sum factorization for low order tensor product elements and for simplex elements.
+  Use @ref CeedOperatorGetElementAssemblyMemory() to check the memory required before enabling element assembly.
+  The element matrices are reused until @ref CeedOperatorSetQFunctionAssemblyDataUpdateNeeded() is called, such as after passive input data changes.
+  For a composite `CeedOperator`, element assembly is set for every sub-operator.
+
+  @note Element assembly requires a linear `CeedOperator` with a single active `CeedBasis` and no passive outputs.
+
+  @param[in] op                `CeedOperator`
+  @param[in] use_elem_assembly Boolean flag to apply with element assembly
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Advanced
+**/
+int CeedOperatorSetElementAssembly(CeedOperator op, bool use_elem_assembly) {
+  bool is_composite;
+
+  CeedCheck(!op->is_product, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED, "Element assembly is not supported for product CeedOperator");
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  if (is_composite) {
+    for (CeedInt i = 0; i < op->num_suboperators; i++) {
+      CeedCall(CeedOperatorSetElementAssembly(op->sub_operators[i], use_elem_assembly));
+    }
+  } else if (use_elem_assembly) {
+    bool               is_at_points;
+    CeedInt            num_output_fields;
+    CeedOperatorField *output_fields;
+
+    CeedCall(CeedOperatorCheckReady(op));
+    CeedCall(CeedOperatorIsAtPoints(op, &is_at_points));
+    CeedCheck(!is_at_points, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED, "Element assembly is not supported for AtPoints CeedOperator");
+    CeedCall(CeedOperatorGetFields(op, NULL, NULL, &num_output_fields, &output_fields));
+    for (CeedInt i = 0; i < num_output_fields; i++) {
+      CeedVector vec;
+
+      CeedCall(CeedOperatorFieldGetVector(output_fields[i], &vec));
+      CeedCheck(vec == CEED_VECTOR_ACTIVE || vec == CEED_VECTOR_NONE, CeedOperatorReturnCeed(op), CEED_ERROR_INCOMPATIBLE,
+                "Element assembly is not supported for CeedOperator with passive outputs");
+      CeedCall(CeedVectorDestroy(&vec));
+    }
+  } else {
+    CeedCheck(!op->op_galerkin_fine, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED,
+              "Galerkin coarse CeedOperator must be applied with element assembly");
+    CeedCall(CeedOperatorElementAssemblyDataDestroy(&op->elem_assembled));
+  }
+  op->use_elem_assembly = use_elem_assembly;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Declare whether a linear `CeedOperator` is symmetric.
+
+  For a symmetric `CeedOperator`, assembly may compute only the upper triangle of each element matrix and point block and mirror it.
+  @ref CeedOperatorLinearAssembleSymbolicCSR() and @ref CeedOperatorLinearAssembleSymbolicBSR() then store only the upper triangle of the assembled matrix.
+  Symmetry is not verified; declaring a non-symmetric `CeedOperator` symmetric gives incorrect assembled values.
+  Symmetry of a composite `CeedOperator` does not imply symmetry of its sub-operators, so the flag is not propagated to the sub-operators.
+
+  @param[in] op           `CeedOperator`
+  @param[in] is_symmetric Boolean flag declaring the `CeedOperator` symmetric
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Advanced
+**/
+int CeedOperatorSetSymmetric(CeedOperator op, bool is_symmetric) {
+  CeedCheck(!op->is_product, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED, "Symmetry cannot be declared for product CeedOperator");
+  op->is_symmetric = is_symmetric;
+  if (op->op_fallback) op->op_fallback->is_symmetric = is_symmetric;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get a boolean value indicating if a `CeedOperator` has been declared symmetric.
+
+  A composite `CeedOperator` is symmetric if it was declared symmetric or if all of its sub-operators were declared symmetric.
+
+  @param[in]  op           `CeedOperator`
+  @param[out] is_symmetric Variable to store symmetry status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Advanced
+**/
+int CeedOperatorIsSymmetric(CeedOperator op, bool *is_symmetric) {
+  bool is_composite;
+
+  *is_symmetric = op->is_symmetric;
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  if (is_composite && !*is_symmetric) {
+    CeedInt       num_suboperators;
+    CeedOperator *sub_operators;
+
+    CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
+    CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
+    *is_symmetric = num_suboperators > 0;
+    for (CeedInt i = 0; i < num_suboperators; i++) *is_symmetric = *is_symmetric && sub_operators[i]->is_symmetric;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Mark `CeedQFunction` data as updated and the `CeedQFunction` as requiring re-assembly.
 
+  Galerkin coarse `CeedOperator` created from `op` with @ref CeedOperatorMultigridLevelCreate() re-assemble their element matrices on next use.
+
   @param[in] op                `CeedOperator`
   @param[in] needs_data_update Boolean flag setting assembly data reuse
 
@@ -1526,6 +2066,8 @@ int CeedOperatorSetQFunctionAssemblyDataUpdateNeeded(CeedOperator op, bool needs
 
     CeedCall(CeedOperatorGetQFunctionAssemblyData(op, &data));
     CeedCall(CeedQFunctionAssemblyDataSetUpdateNeeded(data, needs_data_update));
+    if (op->elem_assembled) CeedCall(CeedOperatorElementAssemblyDataSetUpdateNeeded(op->elem_assembled, needs_data_update));
+    if (needs_data_update) op->assembly_data_state++;
   }
   return CEED_ERROR_SUCCESS;
 }
@@ -1601,7 +2143,7 @@ static int CeedOperatorView_Core(CeedOperator op, FILE *stream, bool is_full) {
 
     CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
     CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
-    fprintf(stream, "Composite CeedOperator%s%s\n", has_name ? " - " : "", has_name ? name : "");
+    fprintf(stream, "%s CeedOperator%s%s\n", op->is_product ? "Product" : "Composite", has_name ? " - " : "", has_name ? name : "");
 
     for (CeedInt i = 0; i < num_suboperators; i++) {
       has_name = sub_operators[i]->name;
@@ -2154,15 +2696,16 @@ int CeedOperatorRestoreContextBooleanRead(CeedOperator op, CeedContextFieldLabel
   @ref User
 **/
 int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request) {
-  bool is_composite;
+  bool is_composite, has_elem_assembly;
 
   CeedCall(CeedOperatorCheckReady(op));
 
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
-  if (is_composite && op->ApplyComposite) {
+  CeedCall(CeedOperatorHasElementAssembly(op, &has_elem_assembly));
+  if (is_composite && op->ApplyComposite && !has_elem_assembly) {
     // Composite Operator
     CeedCall(op->ApplyComposite(op, in, out, request));
-  } else if (!is_composite && op->Apply) {
+  } else if (!is_composite && op->Apply && !has_elem_assembly) {
     // Standard Operator
     CeedCall(op->Apply(op, in, out, request));
   } else {
@@ -2196,14 +2739,27 @@ int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedReques
   @ref User
 **/
 int CeedOperatorApplyAdd(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request) {
-  bool is_composite;
+  bool is_composite, has_elem_assembly;
 
   CeedCall(CeedOperatorCheckReady(op));
 
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
-  if (is_composite) {
+  CeedCall(CeedOperatorHasElementAssembly(op, &has_elem_assembly));
+  if (op->is_product) {
+    // Product Operator
+    if (op->ApplyAddProduct && !has_elem_assembly) {
+      CeedCall(op->ApplyAddProduct(op, in, out, request));
+    } else {
+      // Fallback to intermediate L-vector
+      CeedVector mid;
+
+      CeedCall(CeedOperatorProductGetIntermediateVector(op, &mid));
+      CeedCall(CeedOperatorApplyAdd(op->sub_operators[0], in, mid, request));
+      CeedCall(CeedOperatorApplyAdd(op->sub_operators[1], mid, out, request));
+    }
+  } else if (is_composite) {
     // Composite Operator
-    if (op->ApplyAddComposite) {
+    if (op->ApplyAddComposite && !has_elem_assembly) {
       CeedCall(op->ApplyAddComposite(op, in, out, request));
     } else {
       CeedInt       num_suboperators;
@@ -2215,6 +2771,12 @@ int CeedOperatorApplyAdd(CeedOperator op, CeedVector in, CeedVector out, CeedReq
         CeedCall(CeedOperatorApplyAdd(sub_operators[i], in, out, request));
       }
     }
+  } else if (op->num_elem > 0 && op->use_elem_assembly) {
+    // Element assembled Operator
+    CeedOperatorElementAssemblyData data;
+
+    CeedCall(CeedOperatorGetElementAssemblyData(op, &data));
+    CeedCall(CeedOperatorElementAssemblyDataApplyAdd(data, false, 1.0, in, out));
   } else if (op->num_elem > 0) {
     // Standard Operator
     CeedCall(op->ApplyAdd(op, in, out, request));
@@ -2289,6 +2851,301 @@ int CeedOperatorApplyAddActive(CeedOperator op, CeedVector in, CeedVector out, C
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Apply `CeedOperator` to multiple `CeedVector`.
+
+  This computes the action of the operator on each of the specified (active) inputs, yielding the corresponding (active) outputs.
+  Backends may process all right-hand sides together for each element block, sharing restriction offsets, basis matrices, and passive input data between them.
+  All inputs and outputs must be specified using @ref CeedOperatorSetField().
+
+  @note Calling this function asserts that setup is complete and sets the `CeedOperator` as immutable.
+
+  @param[in]  op       `CeedOperator` to apply
+  @param[in]  num_vecs Number of input and output `CeedVector`
+  @param[in]  in       Array of `num_vecs` `CeedVector` containing input states
+  @param[out] out      Array of `num_vecs` `CeedVector` to store results of applying operator (must be distinct from `in`)
+  @param[in]  request  Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyMulti(CeedOperator op, CeedInt num_vecs, CeedVector *in, CeedVector *out, CeedRequest *request) {
+  for (CeedInt i = 0; i < num_vecs; i++) CeedCall(CeedVectorSetValue(out[i], 0.0));
+  CeedCall(CeedOperatorApplyAddMulti(op, num_vecs, in, out, request));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply `CeedOperator` to multiple `CeedVector` and add results to output `CeedVector`.
+
+  This computes the action of the operator on each of the specified (active) inputs, summing into the corresponding (active) outputs.
+  All inputs and outputs must be specified using @ref CeedOperatorSetField().
+  Operators with passive outputs are not supported, as the passive outputs would not be associated with a single right-hand side.
+
+  @note Calling this function asserts that setup is complete and sets the `CeedOperator` as immutable.
+
+  @param[in]  op       `CeedOperator` to apply
+  @param[in]  num_vecs Number of input and output `CeedVector`
+  @param[in]  in       Array of `num_vecs` `CeedVector` containing input states
+  @param[out] out      Array of `num_vecs` `CeedVector` to sum in results of applying operator (must be distinct from `in`)
+  @param[in]  request  Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyAddMulti(CeedOperator op, CeedInt num_vecs, CeedVector *in, CeedVector *out, CeedRequest *request) {
+  bool is_composite, has_elem_assembly;
+
+  CeedCall(CeedOperatorCheckReady(op));
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  CeedCall(CeedOperatorHasElementAssembly(op, &has_elem_assembly));
+  if (op->is_product) {
+    // Product Operator
+    for (CeedInt i = 0; i < num_vecs; i++) CeedCall(CeedOperatorApplyAdd(op, in[i], out[i], request));
+  } else if (is_composite) {
+    // Composite Operator
+    if (op->ApplyAddComposite && !has_elem_assembly) {
+      for (CeedInt i = 0; i < num_vecs; i++) CeedCall(op->ApplyAddComposite(op, in[i], out[i], request));
+    } else {
+      CeedInt       num_suboperators;
+      CeedOperator *sub_operators;
+
+      CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
+      CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
+      for (CeedInt i = 0; i < num_suboperators; i++) {
+        CeedCall(CeedOperatorApplyAddMulti(sub_operators[i], num_vecs, in, out, request));
+      }
+    }
+  } else if (op->num_elem > 0) {
+    // Standard Operator
+    CeedInt            num_output_fields;
+    CeedOperatorField *output_fields;
+
+    CeedCall(CeedOperatorGetFields(op, NULL, NULL, &num_output_fields, &output_fields));
+    for (CeedInt i = 0; i < num_output_fields; i++) {
+      bool       is_passive;
+      CeedVector vec;
+
+      CeedCall(CeedOperatorFieldGetVector(output_fields[i], &vec));
+      is_passive = vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE;
+      CeedCall(CeedVectorDestroy(&vec));
+      CeedCheck(!is_passive, CeedOperatorReturnCeed(op), CEED_ERROR_INCOMPATIBLE,
+                "Cannot apply CeedOperator with passive outputs to multiple vectors");
+    }
+    if (op->use_elem_assembly) {
+      CeedOperatorElementAssemblyData data;
+
+      CeedCall(CeedOperatorGetElementAssemblyData(op, &data));
+      for (CeedInt i = 0; i < num_vecs; i++) CeedCall(CeedOperatorElementAssemblyDataApplyAdd(data, false, 1.0, in[i], out[i]));
+    } else if (op->ApplyAddMulti) {
+      CeedCall(op->ApplyAddMulti(op, num_vecs, in, out, request));
+    } else {
+      // Fallback to one apply per right-hand side
+      for (CeedInt i = 0; i < num_vecs; i++) CeedCall(op->ApplyAdd(op, in[i], out[i], request));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply `CeedOperator` to a `CeedVector` and update output `CeedVector` as `out = alpha * A * in + beta * out`.
+
+  This computes the scaled action of the operator on the specified (active) input, combined with the existing (active) output.
+  Backends may fold the scaling into the output restriction, avoiding a temporary for the unscaled action.
+  All inputs and outputs must be specified using @ref CeedOperatorSetField().
+  Operators with passive outputs are not supported, as the passive outputs would not be scaled consistently.
+
+  @note Calling this function asserts that setup is complete and sets the `CeedOperator` as immutable.
+
+  @param[in]     op      `CeedOperator` to apply
+  @param[in]     alpha   Scaling factor for the action of the operator
+  @param[in]     in      `CeedVector` containing input state
+  @param[in]     beta    Scaling factor for the existing output state
+  @param[in,out] out     `CeedVector` to update with results of applying operator (must be distinct from `in`)
+  @param[in]     request Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyScaled(CeedOperator op, CeedScalar alpha, CeedVector in, CeedScalar beta, CeedVector out, CeedRequest *request) {
+  if (beta == 0.0) CeedCall(CeedVectorSetValue(out, 0.0));
+  else if (beta != 1.0) CeedCall(CeedVectorScale(out, beta));
+  CeedCall(CeedOperatorApplyAddScaled(op, alpha, in, out, request));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply `CeedOperator` to a `CeedVector` and add scaled result to output `CeedVector` as `out += alpha * A * in`.
+
+  This computes the scaled action of the operator on the specified (active) input, summing into the (active) output.
+  All inputs and outputs must be specified using @ref CeedOperatorSetField().
+  Operators with passive outputs are not supported, as the passive outputs would not be scaled consistently.
+
+  @note Calling this function asserts that setup is complete and sets the `CeedOperator` as immutable.
+
+  @param[in]     op      `CeedOperator` to apply
+  @param[in]     alpha   Scaling factor for the action of the operator
+  @param[in]     in      `CeedVector` containing input state
+  @param[in,out] out     `CeedVector` to sum in results of applying operator (must be distinct from `in`)
+  @param[in]     request Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyAddScaled(CeedOperator op, CeedScalar alpha, CeedVector in, CeedVector out, CeedRequest *request) {
+  bool is_composite, has_elem_assembly;
+
+  CeedCall(CeedOperatorCheckReady(op));
+  if (alpha == 0.0) return CEED_ERROR_SUCCESS;
+  if (alpha == 1.0) return CeedOperatorApplyAdd(op, in, out, request);
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  CeedCall(CeedOperatorHasElementAssembly(op, &has_elem_assembly));
+  if (op->is_product) {
+    // Product Operator, scaling the action of the outer operator
+    CeedVector mid;
+
+    CeedCall(CeedOperatorProductGetIntermediateVector(op, &mid));
+    CeedCall(CeedOperatorApplyAdd(op->sub_operators[0], in, mid, request));
+    CeedCall(CeedOperatorApplyAddScaled(op->sub_operators[1], alpha, mid, out, request));
+  } else if (is_composite) {
+    // Composite Operator
+    if (op->ApplyAddScaledComposite && !has_elem_assembly) {
+      CeedCall(op->ApplyAddScaledComposite(op, alpha, in, out, request));
+    } else {
+      CeedInt       num_suboperators;
+      CeedOperator *sub_operators;
+
+      CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
+      CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
+      for (CeedInt i = 0; i < num_suboperators; i++) {
+        CeedCall(CeedOperatorApplyAddScaled(sub_operators[i], alpha, in, out, request));
+      }
+    }
+  } else if (op->num_elem > 0) {
+    // Standard Operator
+    CeedInt            num_output_fields;
+    CeedOperatorField *output_fields;
+
+    CeedCall(CeedOperatorGetFields(op, NULL, NULL, &num_output_fields, &output_fields));
+    for (CeedInt i = 0; i < num_output_fields; i++) {
+      bool       is_passive;
+      CeedVector vec;
+
+      CeedCall(CeedOperatorFieldGetVector(output_fields[i], &vec));
+      is_passive = vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE;
+      CeedCall(CeedVectorDestroy(&vec));
+      CeedCheck(!is_passive, CeedOperatorReturnCeed(op), CEED_ERROR_INCOMPATIBLE, "Cannot apply scaled CeedOperator with passive outputs");
+    }
+    if (op->use_elem_assembly) {
+      CeedOperatorElementAssemblyData data;
+
+      CeedCall(CeedOperatorGetElementAssemblyData(op, &data));
+      CeedCall(CeedOperatorElementAssemblyDataApplyAdd(data, false, alpha, in, out));
+    } else if (op->ApplyAddScaled) {
+      CeedCall(op->ApplyAddScaled(op, alpha, in, out, request));
+    } else {
+      // Fallback to unscaled apply into temporary vector
+      Ceed       ceed;
+      CeedSize   out_length;
+      CeedVector work;
+
+      CeedCall(CeedOperatorGetCeed(op, &ceed));
+      CeedCall(CeedVectorGetLength(out, &out_length));
+      CeedCall(CeedVectorCreate(ceed, out_length, &work));
+      CeedCall(CeedVectorSetValue(work, 0.0));
+      CeedCall(op->ApplyAdd(op, in, work, request));
+      CeedCall(CeedVectorAXPY(out, alpha, work));
+      CeedCall(CeedVectorDestroy(&work));
+      CeedCall(CeedDestroy(&ceed));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply the transpose of a linear `CeedOperator` to a `CeedVector`.
+
+  This computes the action of the transpose of the operator, taking the (active) output space as input and yielding the (active) input space.
+  If the `CeedOperator` was created with a transpose `CeedQFunction` `dqfT`, its fields are matched by name to the fields of the `CeedOperator`, with active fields of `dqfT` applied with transposed roles.
+  Otherwise, the transpose of the linearized `CeedQFunction` from @ref CeedOperatorLinearAssembleQFunctionBuildOrUpdate() is applied at quadrature points, so the `CeedOperator` must be linear in its active inputs.
+  The linearized `CeedQFunction` is assembled on the first transpose application and only re-assembled after @ref CeedOperatorSetQFunctionAssemblyDataUpdateNeeded(), such as when passive input data changes.
+
+  @note Calling this function asserts that setup is complete and sets the `CeedOperator` as immutable.
+
+  @param[in]  op      `CeedOperator` to apply the transpose of
+  @param[in]  in      `CeedVector` in the (active) output space of the `CeedOperator`
+  @param[out] out     `CeedVector` in the (active) input space of the `CeedOperator` to store result (must be distinct from `in`)
+  @param[in]  request Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyTranspose(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request) {
+  CeedCall(CeedVectorSetValue(out, 0.0));
+  CeedCall(CeedOperatorApplyAddTranspose(op, in, out, request));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply the transpose of a linear `CeedOperator` to a `CeedVector` and add result to output `CeedVector`.
+
+  See @ref CeedOperatorApplyTranspose() for the construction of the transpose action.
+
+  @note Calling this function asserts that setup is complete and sets the `CeedOperator` as immutable.
+
+  @param[in]  op      `CeedOperator` to apply the transpose of
+  @param[in]  in      `CeedVector` in the (active) output space of the `CeedOperator`
+  @param[out] out     `CeedVector` in the (active) input space of the `CeedOperator` to sum in result (must be distinct from `in`)
+  @param[in]  request Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyAddTranspose(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request) {
+  bool is_composite;
+
+  CeedCall(CeedOperatorCheckReady(op));
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  if (op->is_product) {
+    // Product Operator, (A B)^T = B^T A^T
+    CeedVector mid;
+
+    CeedCall(CeedOperatorProductGetIntermediateVector(op, &mid));
+    CeedCall(CeedOperatorApplyAddTranspose(op->sub_operators[1], in, mid, request));
+    CeedCall(CeedOperatorApplyAddTranspose(op->sub_operators[0], mid, out, request));
+  } else if (is_composite) {
+    // Composite Operator
+    CeedInt       num_suboperators;
+    CeedOperator *sub_operators;
+
+    CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
+    CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
+    for (CeedInt i = 0; i < num_suboperators; i++) {
+      CeedCall(CeedOperatorApplyAddTranspose(sub_operators[i], in, out, request));
+    }
+  } else if (op->num_elem > 0 && op->use_elem_assembly) {
+    // Element assembled Operator
+    CeedOperatorElementAssemblyData data;
+
+    CeedCall(CeedOperatorGetElementAssemblyData(op, &data));
+    CeedCall(CeedOperatorElementAssemblyDataApplyAdd(data, true, 1.0, in, out));
+  } else if (op->num_elem > 0) {
+    // Standard Operator
+    CeedCall(CeedOperatorSetupTranspose(op, request));
+    CeedCall(CeedOperatorApplyAdd(op->op_transpose, in, out, request));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Destroy temporary assembly data associated with a `CeedOperator`
 
@@ -2380,6 +3237,7 @@ int CeedOperatorDestroy(CeedOperator *op) {
     }
   }
   CeedCall(CeedFree(&(*op)->sub_operators));
+  CeedCall(CeedVectorDestroy(&(*op)->product_mid));
   CeedCall(CeedQFunctionDestroy(&(*op)->qf));
   CeedCall(CeedQFunctionDestroy(&(*op)->dqf));
   CeedCall(CeedQFunctionDestroy(&(*op)->dqfT));
@@ -2394,6 +3252,17 @@ int CeedOperatorDestroy(CeedOperator *op) {
 
   // Destroy fallback
   CeedCall(CeedOperatorDestroy(&(*op)->op_fallback));
+  // Destroy transpose
+  CeedCall(CeedOperatorDestroy(&(*op)->op_transpose));
+  // Destroy element assembly data
+  CeedCall(CeedOperatorElementAssemblyDataDestroy(&(*op)->elem_assembled));
+  CeedCall(CeedFree(&(*op)->elem_mask));
+  // Destroy Galerkin coarse data
+  CeedCall(CeedOperatorDestroy(&(*op)->op_galerkin_fine));
+  CeedCall(CeedBasisDestroy(&(*op)->basis_galerkin_c_to_f));
+  // Destroy sparse assembly data
+  CeedCall(CeedSparseAssemblyDestroy(&(*op)->csr_assembled));
+  CeedCall(CeedSparseAssemblyDestroy(&(*op)->bsr_assembled));
 
   CeedCall(CeedFree(&(*op)->name));
   CeedCall(CeedDestroy(&(*op)->ceed));
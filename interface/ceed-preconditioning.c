@@ -12,8 +12,12 @@
 #include <math.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
+// Number of elements per chunk of fine element matrices when assembling Galerkin coarse element matrices
+#define CEED_GALERKIN_CHUNK_SIZE (8 * CEED_ELEM_ASSEMBLY_BLOCK_SIZE)
+
 /// @file
 /// Implementation of CeedOperator preconditioning interfaces
 
@@ -192,6 +196,13 @@ static int CeedOperatorCreateFallback(CeedOperator op) {
     CeedCall(CeedQFunctionDestroy(&dqfT_fallback));
   }
   CeedCall(CeedOperatorSetName(op_fallback, op->name));
+  op_fallback->is_symmetric           = op->is_symmetric;
+  op_fallback->use_fdm_shared_scaling = op->use_fdm_shared_scaling;
+  op_fallback->use_galerkin_coarse    = op->use_galerkin_coarse;
+  if (op->op_galerkin_fine) {
+    CeedCall(CeedOperatorReferenceCopy(op->op_galerkin_fine, &op_fallback->op_galerkin_fine));
+    CeedCall(CeedBasisReferenceCopy(op->basis_galerkin_c_to_f, &op_fallback->basis_galerkin_c_to_f));
+  }
   CeedCall(CeedOperatorCheckReady(op_fallback));
   // Note: No ref-counting here so we don't get caught in a reference loop.
   //       The op holds the only reference to op_fallback and is responsible for deleting itself and op_fallback.
@@ -655,6 +666,288 @@ int CeedOperatorFallbackLinearAssembleQFunctionBuildOrUpdate(CeedOperator op, Ce
   return CeedOperatorLinearAssembleQFunctionBuildOrUpdate_Core(op, false, assembled, rstr, request);
 }
 
+/**
+  @brief Apply the transpose of a tensor product interpolation matrix to the slowest indices of a batch of vectors.
+
+  Computes `out[a][j_{dim-1}...j_0][c] = sum_{b} prod_d interp[b_d * P_c + j_d] in[a][b_{dim-1}...b_0][c]` one dimension at a time.
+
+  @param[in]  dim       Dimension of tensor product
+  @param[in]  P_f       Number of fine nodes in one dimension
+  @param[in]  P_c       Number of coarse nodes in one dimension
+  @param[in]  interp    Row-major `P_f x P_c` interpolation matrix in one dimension
+  @param[in]  num_outer Number of vectors in batch, slowest index
+  @param[in]  num_inner Number of entries per node, fastest index
+  @param[in]  in        Input array of size `num_outer * P_f^dim * num_inner`
+  @param[out] out       Output array of size `num_outer * P_c^dim * num_inner`
+  @param[out] work      Work array of size `2 * num_outer * P_f^dim * num_inner`
+
+  @ref Developer
+**/
+static void CeedGalerkinTensorContract(CeedInt dim, CeedInt P_f, CeedInt P_c, const CeedScalar *interp, CeedInt num_outer, CeedInt num_inner,
+                                       const CeedScalar *in, CeedScalar *out, CeedScalar *work) {
+  const CeedInt     work_size = num_outer * CeedIntPow(P_f, dim) * num_inner;
+  const CeedScalar *u         = in;
+
+  for (CeedInt d = 0; d < dim; d++) {
+    const CeedInt A = num_outer * CeedIntPow(P_f, dim - 1 - d), C = num_inner * CeedIntPow(P_c, d);
+    CeedScalar   *v = d == dim - 1 ? out : &work[(d % 2) * work_size];
+
+    for (CeedInt k = 0; k < A * P_c * C; k++) v[k] = 0.0;
+    for (CeedInt a = 0; a < A; a++) {
+      for (CeedInt b = 0; b < P_f; b++) {
+        for (CeedInt j = 0; j < P_c; j++) {
+          const CeedScalar w = interp[b * P_c + j];
+
+          CeedPragmaSIMD for (CeedInt c = 0; c < C; c++) v[(a * P_c + j) * C + c] += w * u[(a * P_f + b) * C + c];
+        }
+      }
+    }
+    u = v;
+  }
+}
+
+/**
+  @brief Sum the assembly data states of the chain of fine `CeedOperator` of a Galerkin coarse `CeedOperator`
+
+  @param[in] op Galerkin coarse `CeedOperator`
+
+  @return Sum of the assembly data states, which changes whenever assembly data of a fine `CeedOperator` is marked for update
+
+  @ref Developer
+**/
+static uint64_t CeedOperatorGetGalerkinFineState(CeedOperator op) {
+  uint64_t state = 0;
+
+  for (CeedOperator op_fine = op->op_galerkin_fine; op_fine; op_fine = op_fine->op_galerkin_fine) state += op_fine->assembly_data_state;
+  return state;
+}
+
+/**
+  @brief Assemble Galerkin coarse element matrices `P_e^T A_e P_e` into `CeedOperatorElementAssemblyData`.
+
+  The fine element matrices `A_e` are assembled from the fine `CeedOperator` in chunks of `CEED_GALERKIN_CHUNK_SIZE` elements, or read from the stored element matrices when the fine `CeedOperator` is itself a Galerkin coarse `CeedOperator`, so the full set of fine element matrices is never held at once.
+  Backends without `LinearAssembleSingleRange` assemble all fine element matrices in a single chunk.
+  The element prolongation `P_e` is applied with the tensor product structure of the coarse to fine `CeedBasis`, so the cost per element is a sequence of small dense products in one dimension.
+
+  @param[in]     op   Galerkin coarse `CeedOperator`
+  @param[in,out] data `CeedOperatorElementAssemblyData` to store element matrices
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorAssembleGalerkinElementMatrices(CeedOperator op, CeedOperatorElementAssemblyData data) {
+  bool                            is_tensor, reuse_qf_data = true;
+  CeedInt                         dim = 1, P_c, P_f, num_rows_c, num_rows_f, chunk_size = data->num_elem;
+  const CeedInt                   num_comp = data->num_comp_in;
+  const CeedScalar               *interp, *values_array = NULL;
+  CeedScalar                     *mat_f, *mat_t, *mat_c, *work;
+  CeedVector                      values  = NULL;
+  CeedQFunctionAssemblyData       qf_data = NULL;
+  CeedOperatorElementAssemblyData data_f  = NULL;
+  CeedOperator                    op_fine = op->op_galerkin_fine;
+  CeedBasis                       basis_c_to_f = op->basis_galerkin_c_to_f;
+
+  // Coarse to fine interpolation
+  CeedCall(CeedBasisIsTensor(basis_c_to_f, &is_tensor));
+  if (is_tensor) {
+    CeedCall(CeedBasisGetDimension(basis_c_to_f, &dim));
+    CeedCall(CeedBasisGetNumNodes1D(basis_c_to_f, &P_c));
+    CeedCall(CeedBasisGetNumQuadraturePoints1D(basis_c_to_f, &P_f));
+    CeedCall(CeedBasisGetInterp1D(basis_c_to_f, &interp));
+  } else {
+    CeedCall(CeedBasisGetNumNodes(basis_c_to_f, &P_c));
+    CeedCall(CeedBasisGetNumQuadraturePoints(basis_c_to_f, &P_f));
+    CeedCall(CeedBasisGetInterp(basis_c_to_f, &interp));
+  }
+  num_rows_c = num_comp * CeedIntPow(P_c, dim);
+  num_rows_f = num_comp * CeedIntPow(P_f, dim);
+  CeedCheck(data->num_comp_out == num_comp && data->elem_size_in * num_comp == num_rows_c && data->elem_size_out * num_comp == num_rows_c, data->ceed,
+            CEED_ERROR_DIMENSION, "Galerkin coarse operator element size does not match coarse to fine basis");
+
+  // Fine element matrices, stored if the fine operator is a Galerkin coarse operator, else assembled in chunks
+  if (op_fine->op_galerkin_fine) {
+    CeedCall(CeedOperatorGetElementAssemblyData(op_fine, &data_f));
+  } else {
+    if (op_fine->LinearAssembleSingleRange) chunk_size = CeedIntMin(CEED_GALERKIN_CHUNK_SIZE, data->num_elem);
+    CeedCall(CeedVectorCreate(data->ceed, (CeedSize)chunk_size * num_rows_f * num_rows_f, &values));
+    // -- Keep the assembled QFunction across chunks
+    if (chunk_size < data->num_elem) {
+      CeedCall(CeedOperatorGetQFunctionAssemblyData(op_fine, &qf_data));
+      reuse_qf_data = qf_data->reuse_data;
+      if (!reuse_qf_data) CeedCall(CeedQFunctionAssemblyDataSetReuse(qf_data, true));
+    }
+  }
+  CeedCall(CeedCalloc(num_rows_f * num_rows_f, &mat_f));
+  CeedCall(CeedCalloc(num_rows_f * num_rows_c, &mat_t));
+  CeedCall(CeedCalloc(num_rows_c * num_rows_c, &mat_c));
+  CeedCall(CeedCalloc(2 * num_rows_f * num_rows_f, &work));
+
+  // Element triple products, by chunk
+  for (CeedInt elem_start = 0; elem_start < data->num_elem; elem_start += chunk_size) {
+    const CeedInt elem_stop = CeedIntMin(elem_start + chunk_size, data->num_elem);
+
+    if (values) {
+      CeedCall(CeedVectorSetValue(values, 0.0));
+      if (chunk_size < data->num_elem) CeedCall(op_fine->LinearAssembleSingleRange(op_fine, elem_start, elem_stop, values));
+      else CeedCall(CeedSingleOperatorAssemble(op_fine, 0, values));
+      CeedCall(CeedVectorGetArrayRead(values, CEED_MEM_HOST, &values_array));
+    }
+    for (CeedInt e = elem_start; e < elem_stop; e++) {
+      const CeedInt block = e / CEED_ELEM_ASSEMBLY_BLOCK_SIZE, lane = e % CEED_ELEM_ASSEMBLY_BLOCK_SIZE;
+      const CeedInt elem_size_f = num_rows_f / num_comp;
+
+      if (data_f) {
+        // -- Unpack from the blocks of the fine Galerkin element matrices
+        for (CeedInt row = 0; row < num_rows_f; row++) {
+          for (CeedInt col = 0; col < num_rows_f; col++) {
+            mat_f[row * num_rows_f + col] =
+                data_f->elem_mats[(((CeedSize)block * num_rows_f + row) * num_rows_f + col) * CEED_ELEM_ASSEMBLY_BLOCK_SIZE + lane];
+          }
+        }
+      } else {
+        // -- Unpack from the coordinate assembly layout, ordered by input component, output component, row, and column
+        const CeedScalar *values_e = &values_array[(CeedSize)(e - elem_start) * num_rows_f * num_rows_f];
+        CeedSize          count    = 0;
+
+        for (CeedInt comp_in = 0; comp_in < num_comp; comp_in++) {
+          for (CeedInt comp_out = 0; comp_out < num_comp; comp_out++) {
+            for (CeedInt i = 0; i < elem_size_f; i++) {
+              for (CeedInt j = 0; j < elem_size_f; j++) mat_f[(comp_out * elem_size_f + i) * num_rows_f + comp_in * elem_size_f + j] = values_e[count++];
+            }
+          }
+        }
+      }
+
+      // -- A_e P_e, contracting the columns, then P_e^T (A_e P_e), contracting the rows
+      CeedGalerkinTensorContract(dim, P_f, P_c, interp, num_rows_f * num_comp, 1, mat_f, mat_t, work);
+      CeedGalerkinTensorContract(dim, P_f, P_c, interp, num_comp, num_rows_c, mat_t, mat_c, work);
+
+      // -- Store in blocks, with the element index fastest
+      for (CeedInt row = 0; row < num_rows_c; row++) {
+        for (CeedInt col = 0; col < num_rows_c; col++) {
+          data->elem_mats[(((CeedSize)block * num_rows_c + row) * num_rows_c + col) * CEED_ELEM_ASSEMBLY_BLOCK_SIZE + lane] =
+              mat_c[row * num_rows_c + col];
+        }
+      }
+    }
+    if (values) CeedCall(CeedVectorRestoreArrayRead(values, &values_array));
+  }
+  if (!reuse_qf_data) CeedCall(CeedQFunctionAssemblyDataSetReuse(qf_data, false));
+  CeedCall(CeedVectorDestroy(&values));
+  CeedCall(CeedFree(&mat_f));
+  CeedCall(CeedFree(&mat_t));
+  CeedCall(CeedFree(&mat_c));
+  CeedCall(CeedFree(&work));
+  data->galerkin_fine_state = CeedOperatorGetGalerkinFineState(op);
+  data->needs_data_update   = false;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Copy element matrices in `CeedOperatorElementAssemblyData` into the coordinate assembly layout of @ref CeedSingleOperatorAssemble(), or sum them into compressed sparse storage
+
+  @param[in]  data    `CeedOperatorElementAssemblyData`
+  @param[in]  offset  Offset for number of entries
+  @param[in]  scatter Compressed storage slot of each coordinate entry, -1 for dropped entries, or `NULL` to copy coordinate values
+  @param[out] values  Values to assemble into matrix
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorElementAssemblyDataGetValues(CeedOperatorElementAssemblyData data, CeedInt offset, const CeedSize *scatter, CeedVector values) {
+  const CeedInt num_rows = data->elem_size_out * data->num_comp_out, num_cols = data->elem_size_in * data->num_comp_in;
+  CeedSize      count    = 0;
+  CeedScalar   *values_array;
+
+  CeedCall(CeedVectorGetArray(values, CEED_MEM_HOST, &values_array));
+  for (CeedInt e = 0; e < data->num_elem; e++) {
+    const CeedInt block = e / CEED_ELEM_ASSEMBLY_BLOCK_SIZE, lane = e % CEED_ELEM_ASSEMBLY_BLOCK_SIZE;
+
+    for (CeedInt comp_in = 0; comp_in < data->num_comp_in; comp_in++) {
+      for (CeedInt comp_out = 0; comp_out < data->num_comp_out; comp_out++) {
+        for (CeedInt i = 0; i < data->elem_size_out; i++) {
+          const CeedInt row = comp_out * data->elem_size_out + i;
+
+          for (CeedInt j = 0; j < data->elem_size_in; j++) {
+            const CeedInt col = comp_in * data->elem_size_in + j;
+
+            const CeedScalar value =
+                data->elem_mats[(((CeedSize)block * num_rows + row) * num_cols + col) * CEED_ELEM_ASSEMBLY_BLOCK_SIZE + lane];
+
+            if (!scatter) values_array[offset + count] = value;
+            else if (scatter[count] >= 0) values_array[scatter[count]] += value;
+            count++;
+          }
+        }
+      }
+    }
+  }
+  CeedCall(CeedVectorRestoreArray(values, &values_array));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Sum the diagonal or point block diagonal of element matrices in `CeedOperatorElementAssemblyData` into a `CeedVector`
+
+  @param[in]     data           `CeedOperatorElementAssemblyData`
+  @param[in]     is_point_block Boolean flag to assemble diagonal or point block diagonal
+  @param[in,out] assembled      `CeedVector` to sum in diagonal or point block diagonal
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorElementAssemblyDataAddDiagonal(CeedOperatorElementAssemblyData data, bool is_point_block, CeedVector assembled) {
+  const CeedInt num_rows = data->elem_size_out * data->num_comp_out, elem_size = data->elem_size_out, num_comp = data->num_comp_out;
+  CeedScalar   *e_v;
+
+  CeedCheck(data->rstr_in == data->rstr_out, data->ceed, CEED_ERROR_UNSUPPORTED, "Diagonal assembly requires matching active restrictions");
+  if (is_point_block) {
+    CeedVector          elem_diag;
+    CeedElemRestriction diag_elem_rstr;
+
+    // Blocks of all component pairs at each node, ordered by element, output component, input component, and node
+    CeedCall(CeedOperatorCreateActivePointBlockRestriction(data->rstr_out, &diag_elem_rstr));
+    CeedCall(CeedElemRestrictionCreateVector(diag_elem_rstr, NULL, &elem_diag));
+    CeedCall(CeedVectorGetArrayWrite(elem_diag, CEED_MEM_HOST, &e_v));
+    for (CeedInt e = 0; e < data->num_elem; e++) {
+      const CeedInt block = e / CEED_ELEM_ASSEMBLY_BLOCK_SIZE, lane = e % CEED_ELEM_ASSEMBLY_BLOCK_SIZE;
+
+      for (CeedInt c_out = 0; c_out < num_comp; c_out++) {
+        for (CeedInt c_in = 0; c_in < num_comp; c_in++) {
+          for (CeedInt n = 0; n < elem_size; n++) {
+            const CeedInt row = c_out * elem_size + n, col = c_in * elem_size + n;
+
+            e_v[(((CeedSize)e * num_comp + c_out) * num_comp + c_in) * elem_size + n] =
+                data->elem_mats[(((CeedSize)block * num_rows + row) * num_rows + col) * CEED_ELEM_ASSEMBLY_BLOCK_SIZE + lane];
+          }
+        }
+      }
+    }
+    CeedCall(CeedVectorRestoreArray(elem_diag, &e_v));
+    CeedCall(CeedElemRestrictionApply(diag_elem_rstr, CEED_TRANSPOSE, elem_diag, assembled, CEED_REQUEST_IMMEDIATE));
+    CeedCall(CeedVectorDestroy(&elem_diag));
+    CeedCall(CeedElemRestrictionDestroy(&diag_elem_rstr));
+    return CEED_ERROR_SUCCESS;
+  }
+  CeedCall(CeedVectorGetArrayWrite(data->e_vec_out, CEED_MEM_HOST, &e_v));
+  for (CeedInt e = 0; e < data->num_elem; e++) {
+    const CeedInt block = e / CEED_ELEM_ASSEMBLY_BLOCK_SIZE, lane = e % CEED_ELEM_ASSEMBLY_BLOCK_SIZE;
+
+    for (CeedInt row = 0; row < num_rows; row++) {
+      const CeedInt node = row % elem_size, comp = row / elem_size;
+
+      e_v[node * data->layout_out[0] + comp * data->layout_out[1] + (CeedSize)e * data->layout_out[2]] =
+          data->elem_mats[(((CeedSize)block * num_rows + row) * num_rows + row) * CEED_ELEM_ASSEMBLY_BLOCK_SIZE + lane];
+    }
+  }
+  CeedCall(CeedVectorRestoreArray(data->e_vec_out, &e_v));
+  CeedCall(CeedElemRestrictionApply(data->rstr_out, CEED_TRANSPOSE, data->e_vec_out, assembled, CEED_REQUEST_IMMEDIATE));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Assemble nonzero entries for non-composite `CeedOperator`.
 
@@ -682,6 +975,15 @@ int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset, CeedVector value
     if (num_elem == 0) return CEED_ERROR_SUCCESS;
   }
 
+  // Galerkin coarse operator
+  if (op->op_galerkin_fine) {
+    CeedOperatorElementAssemblyData data;
+
+    CeedCall(CeedOperatorGetElementAssemblyData(op, &data));
+    CeedCall(CeedOperatorElementAssemblyDataGetValues(data, offset, NULL, values));
+    return CEED_ERROR_SUCCESS;
+  }
+
   if (op->LinearAssembleSingle) {
     // Backend version
     CeedCall(op->LinearAssembleSingle(op, offset, values));
@@ -956,6 +1258,56 @@ static int CeedSingleOperatorAssemblyCountEntries(CeedOperator op, CeedSize *num
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Assemble dense element matrices of a non-composite `CeedOperator` into `CeedOperatorElementAssemblyData`.
+
+  The element matrices from @ref CeedSingleOperatorAssemble() are repacked into blocks of `CEED_ELEM_ASSEMBLY_BLOCK_SIZE` elements, with the element index fastest, so that the batched products vectorize across elements.
+  Element matrix entries for padding elements in the last block are zero.
+
+  @param[in]     op   `CeedOperator` to assemble
+  @param[in,out] data `CeedOperatorElementAssemblyData` to store element matrices
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorAssembleElementMatrices(CeedOperator op, CeedOperatorElementAssemblyData data) {
+  const CeedInt     num_rows = data->elem_size_out * data->num_comp_out, num_cols = data->elem_size_in * data->num_comp_in;
+  const CeedScalar *values_array;
+  CeedVector        values;
+
+  if (op->op_galerkin_fine) return CeedSingleOperatorAssembleGalerkinElementMatrices(op, data);
+
+  CeedCall(CeedVectorCreate(data->ceed, (CeedSize)data->num_elem * num_rows * num_cols, &values));
+  CeedCall(CeedVectorSetValue(values, 0.0));
+  CeedCall(CeedSingleOperatorAssemble(op, 0, values));
+
+  // Repack from the coordinate assembly layout, ordered by element, input component, output component, row, and column
+  CeedCall(CeedVectorGetArrayRead(values, CEED_MEM_HOST, &values_array));
+  for (CeedInt e = 0; e < data->num_elem; e++) {
+    const CeedInt block = e / CEED_ELEM_ASSEMBLY_BLOCK_SIZE, lane = e % CEED_ELEM_ASSEMBLY_BLOCK_SIZE;
+    CeedSize      count = (CeedSize)e * num_rows * num_cols;
+
+    for (CeedInt comp_in = 0; comp_in < data->num_comp_in; comp_in++) {
+      for (CeedInt comp_out = 0; comp_out < data->num_comp_out; comp_out++) {
+        for (CeedInt i = 0; i < data->elem_size_out; i++) {
+          const CeedInt row = comp_out * data->elem_size_out + i;
+
+          for (CeedInt j = 0; j < data->elem_size_in; j++) {
+            const CeedInt col = comp_in * data->elem_size_in + j;
+
+            data->elem_mats[(((CeedSize)block * num_rows + row) * num_cols + col) * CEED_ELEM_ASSEMBLY_BLOCK_SIZE + lane] = values_array[count++];
+          }
+        }
+      }
+    }
+  }
+  CeedCall(CeedVectorRestoreArrayRead(values, &values_array));
+  CeedCall(CeedVectorDestroy(&values));
+  data->needs_data_update = false;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Common code for creating a multigrid coarse `CeedOperator` and level transfer `CeedOperator` for a `CeedOperator`
 
@@ -1006,7 +1358,7 @@ static int CeedSingleOperatorMultigridLevel(CeedOperator op_fine, CeedVector p_m
     }
   }
   CeedCall(CeedOperatorGetFields(op_fine, &num_input_fields, &input_fields, &num_output_fields, &output_fields));
-  // -- Clone input fields
+  // -- Clone input fields, without the passive vectors for a Galerkin coarse operator, which never evaluates the CeedQFunction
   for (CeedInt i = 0; i < num_input_fields; i++) {
     const char         *field_name;
     CeedVector          vec;
@@ -1022,6 +1374,10 @@ static int CeedSingleOperatorMultigridLevel(CeedOperator op_fine, CeedVector p_m
     } else {
       CeedCall(CeedOperatorFieldGetElemRestriction(input_fields[i], &rstr));
       CeedCall(CeedOperatorFieldGetBasis(input_fields[i], &basis));
+      if (op_fine->use_galerkin_coarse) {
+        CeedCall(CeedVectorDestroy(&vec));
+        vec = CEED_VECTOR_NONE;
+      }
     }
     CeedCall(CeedOperatorSetField(*op_coarse, field_name, rstr, basis, vec));
     CeedCall(CeedVectorDestroy(&vec));
@@ -1051,7 +1407,7 @@ static int CeedSingleOperatorMultigridLevel(CeedOperator op_fine, CeedVector p_m
     CeedCall(CeedBasisDestroy(&basis));
   }
   // -- Clone QFunctionAssemblyData
-  {
+  if (!op_fine->use_galerkin_coarse) {
     CeedQFunctionAssemblyData fine_data;
 
     CeedCall(CeedOperatorGetQFunctionAssemblyData(op_fine, &fine_data));
@@ -1082,9 +1438,9 @@ static int CeedSingleOperatorMultigridLevel(CeedOperator op_fine, CeedVector p_m
   size_t name_len = op_fine->name ? strlen(op_fine->name) : 0;
   CeedCall(CeedOperatorSetName(*op_coarse, op_fine->name));
 
-  // Check that coarse to fine basis is provided if prolong/restrict operators are requested
-  CeedCheck(basis_c_to_f || (!op_restrict && !op_prolong), ceed, CEED_ERROR_INCOMPATIBLE,
-            "Prolongation or restriction operator creation requires coarse-to-fine basis");
+  // Check that coarse to fine basis is provided if prolong/restrict operators or a Galerkin coarse operator are requested
+  CeedCheck(basis_c_to_f || (!op_restrict && !op_prolong && !op_fine->use_galerkin_coarse), ceed, CEED_ERROR_INCOMPATIBLE,
+            "Prolongation, restriction, or Galerkin coarse operator creation requires coarse-to-fine basis");
 
   // Restriction/Prolongation Operators
   CeedCall(CeedBasisGetNumComponents(basis_coarse, &num_comp));
@@ -1168,6 +1524,20 @@ static int CeedSingleOperatorMultigridLevel(CeedOperator op_fine, CeedVector p_m
   // Check
   CeedCall(CeedOperatorCheckReady(*op_coarse));
 
+  // Galerkin coarse operator
+  if (op_fine->use_galerkin_coarse) {
+    CeedRestrictionType rstr_type_fine, rstr_type_coarse;
+
+    CeedCall(CeedElemRestrictionGetType(rstr_fine, &rstr_type_fine));
+    CeedCall(CeedElemRestrictionGetType(rstr_coarse, &rstr_type_coarse));
+    CeedCheck(rstr_type_fine == CEED_RESTRICTION_STANDARD && rstr_type_coarse == CEED_RESTRICTION_STANDARD, ceed, CEED_ERROR_UNSUPPORTED,
+              "Galerkin coarse operators are only supported for standard element restrictions");
+    CeedCall(CeedOperatorReferenceCopy(op_fine, &(*op_coarse)->op_galerkin_fine));
+    CeedCall(CeedBasisReferenceCopy(basis_c_to_f, &(*op_coarse)->basis_galerkin_c_to_f));
+    (*op_coarse)->use_galerkin_coarse = true;
+    CeedCall(CeedOperatorSetElementAssembly(*op_coarse, true));
+  }
+
   // Cleanup
   CeedCall(CeedDestroy(&ceed));
   CeedCall(CeedVectorDestroy(&mult_vec));
@@ -1218,131 +1588,432 @@ static int CeedBuildMassLaplace(const CeedScalar *interp_1d, const CeedScalar *g
 }
 CeedPragmaOptimizeOn
 
-/// @}
-
-/// ----------------------------------------------------------------------------
-/// CeedOperator Backend API
-/// ----------------------------------------------------------------------------
-/// @addtogroup CeedOperatorBackend
-/// @{
+/**
+  @brief Column index and COO entry for sorting the nonzero pattern of one row
+**/
+typedef struct {
+  CeedInt  col;
+  CeedSize entry;
+} CeedSparseEntry;
 
 /**
-  @brief Select correct basis matrix pointer based on @ref CeedEvalMode
+  @brief Compare `CeedSparseEntry` by column, then by COO entry, for `qsort()`
 
-  @param[in]  basis     `CeedBasis` from which to get the basis matrix
-  @param[in]  eval_mode Current basis evaluation mode
-  @param[in]  identity  Pointer to identity matrix
-  @param[out] basis_ptr `CeedBasis` pointer to set
+  @param[in] a First `CeedSparseEntry`
+  @param[in] b Second `CeedSparseEntry`
 
-  @ref Backend
+  @return Negative, zero, or positive if `a` sorts before, with, or after `b`
+
+  @ref Developer
 **/
-int CeedOperatorGetBasisPointer(CeedBasis basis, CeedEvalMode eval_mode, const CeedScalar *identity, const CeedScalar **basis_ptr) {
-  switch (eval_mode) {
-    case CEED_EVAL_NONE:
-      *basis_ptr = identity;
-      break;
-    case CEED_EVAL_INTERP:
-      CeedCall(CeedBasisGetInterp(basis, basis_ptr));
-      break;
-    case CEED_EVAL_GRAD:
-      CeedCall(CeedBasisGetGrad(basis, basis_ptr));
-      break;
-    case CEED_EVAL_DIV:
-      CeedCall(CeedBasisGetDiv(basis, basis_ptr));
-      break;
-    case CEED_EVAL_CURL:
-      CeedCall(CeedBasisGetCurl(basis, basis_ptr));
-      break;
-    case CEED_EVAL_WEIGHT:
-      break;  // Caught by QF Assembly
-  }
-  assert(*basis_ptr != NULL);
-  return CEED_ERROR_SUCCESS;
+static int CeedSparseEntryCompare(const void *a, const void *b) {
+  const CeedSparseEntry *entry_a = (const CeedSparseEntry *)a, *entry_b = (const CeedSparseEntry *)b;
+
+  if (entry_a->col != entry_b->col) return entry_a->col < entry_b->col ? -1 : 1;
+  if (entry_a->entry != entry_b->entry) return entry_a->entry < entry_b->entry ? -1 : 1;
+  return 0;
 }
 
 /**
-  @brief Create point block restriction for active `CeedOperatorField`
+  @brief Destroy `CeedSparseAssembly`
 
-  @param[in]  rstr             Original `CeedElemRestriction` for active field
-  @param[out] point_block_rstr Address of the variable where the newly created `CeedElemRestriction` will be stored
+  @param[in,out] data `CeedSparseAssembly` to destroy
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
+  @ref Developer
 **/
-int CeedOperatorCreateActivePointBlockRestriction(CeedElemRestriction rstr, CeedElemRestriction *point_block_rstr) {
-  Ceed           ceed;
-  CeedInt        num_elem, num_comp, shift, elem_size, comp_stride, *point_block_offsets;
-  CeedSize       l_size;
-  const CeedInt *offsets;
-
-  CeedCall(CeedElemRestrictionGetCeed(rstr, &ceed));
-  CeedCall(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
-
-  // Expand offsets
-  CeedCall(CeedElemRestrictionGetNumElements(rstr, &num_elem));
-  CeedCall(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
-  CeedCall(CeedElemRestrictionGetElementSize(rstr, &elem_size));
-  CeedCall(CeedElemRestrictionGetCompStride(rstr, &comp_stride));
-  CeedCall(CeedElemRestrictionGetLVectorSize(rstr, &l_size));
-  shift = num_comp;
-  if (comp_stride != 1) shift *= num_comp;
-  CeedCall(CeedCalloc(num_elem * elem_size, &point_block_offsets));
-  for (CeedInt i = 0; i < num_elem * elem_size; i++) {
-    point_block_offsets[i] = offsets[i] * shift;
-  }
-
-  // Create new restriction
-  CeedCall(CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp * num_comp, 1, l_size * num_comp, CEED_MEM_HOST, CEED_OWN_POINTER,
-                                     point_block_offsets, point_block_rstr));
-
-  // Cleanup
-  CeedCall(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
-  CeedCall(CeedDestroy(&ceed));
+int CeedSparseAssemblyDestroy(CeedSparseAssembly *data) {
+  if (!*data) return CEED_ERROR_SUCCESS;
+  CeedCall(CeedFree(&(*data)->scatter));
+  CeedCall(CeedFree(data));
   return CEED_ERROR_SUCCESS;
 }
 
 /**
-  @brief Get `CeedQFunctionAssemblyData`
+  @brief Get the node layout shared by the active `CeedElemRestriction` of a square linear `CeedOperator`.
 
-  @param[in]  op   `CeedOperator` to assemble
-  @param[out] data `CeedQFunctionAssemblyData`
+  The active L-vector must be interlaced, with component stride 1, or have a component stride equal to the number of nodes.
+
+  @param[in]  op          `CeedOperator` to query
+  @param[out] num_comp    Number of components per node
+  @param[out] comp_stride Component stride of the active L-vectors, 1 for a single component
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
+  @ref Developer
 **/
-int CeedOperatorGetQFunctionAssemblyData(CeedOperator op, CeedQFunctionAssemblyData *data) {
-  if (!op->qf_assembled) {
-    CeedQFunctionAssemblyData data;
+static int CeedOperatorGetActiveNodeLayout(CeedOperator op, CeedInt *num_comp, CeedInt *comp_stride) {
+  bool          is_composite;
+  CeedInt       num_sub_operators = 1;
+  CeedSize      input_size, output_size;
+  CeedOperator *sub_operators = &op;
 
-    CeedCall(CeedQFunctionAssemblyDataCreate(op->ceed, &data));
-    op->qf_assembled = data;
+  CeedCall(CeedOperatorGetActiveVectorLengths(op, &input_size, &output_size));
+  CeedCheck(input_size == output_size, CeedOperatorReturnCeed(op), CEED_ERROR_DIMENSION, "Operator must be square");
+
+  // Verify that all active element restrictions share the same node layout
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  if (is_composite) {
+    CeedCall(CeedCompositeOperatorGetNumSub(op, &num_sub_operators));
+    CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
   }
-  *data = op->qf_assembled;
+  *num_comp    = -1;
+  *comp_stride = -1;
+  for (CeedInt k = 0; k < num_sub_operators; k++) {
+    CeedElemRestriction rstrs[2];
+
+    CeedCall(CeedOperatorGetActiveElemRestrictions(sub_operators[k], &rstrs[0], &rstrs[1]));
+    for (CeedInt i = 0; i < 2; i++) {
+      CeedInt num_comp_rstr, comp_stride_rstr;
+
+      CeedCall(CeedElemRestrictionGetNumComponents(rstrs[i], &num_comp_rstr));
+      CeedCall(CeedElemRestrictionGetCompStride(rstrs[i], &comp_stride_rstr));
+      if (*num_comp == -1) {
+        *num_comp    = num_comp_rstr;
+        *comp_stride = comp_stride_rstr;
+      }
+      CeedCheck(num_comp_rstr == *num_comp, CeedOperatorReturnCeed(op), CEED_ERROR_INCOMPATIBLE,
+                "Active element restrictions must have the same number of components: %" CeedInt_FMT " vs %" CeedInt_FMT, *num_comp, num_comp_rstr);
+      CeedCheck(comp_stride_rstr == *comp_stride, CeedOperatorReturnCeed(op), CEED_ERROR_INCOMPATIBLE,
+                "Active element restrictions must have the same component stride: %" CeedInt_FMT " vs %" CeedInt_FMT, *comp_stride,
+                comp_stride_rstr);
+    }
+    CeedCall(CeedElemRestrictionDestroy(&rstrs[0]));
+    CeedCall(CeedElemRestrictionDestroy(&rstrs[1]));
+  }
+  if (*num_comp == 1) *comp_stride = 1;
+  CeedCheck(output_size % *num_comp == 0 && (*comp_stride == 1 || (CeedSize)*comp_stride * *num_comp == output_size), CeedOperatorReturnCeed(op),
+            CEED_ERROR_INCOMPATIBLE, "Active L-vector layout must be interlaced or have component stride equal to the number of nodes");
   return CEED_ERROR_SUCCESS;
 }
 
 /**
-  @brief Create object holding `CeedQFunction` assembly data for `CeedOperator`
+  @brief Build a block compressed sparse row nonzero pattern for a linear `CeedOperator` and cache the scatter map from its coordinate entries.
 
-  @param[in]  ceed `Ceed` object used to create the `CeedQFunctionAssemblyData`
-  @param[out] data Address of the variable where the newly created `CeedQFunctionAssemblyData` will be stored
+  Each L-vector index is split into a node and a component as in @ref CeedOperatorCreateActivePointBlockRestriction().
+  Blocks are stored row-major, `[component out, component in]`.
+  With `block_size = 1` this is the compressed sparse row (CSR) pattern.
+  For a symmetric `CeedOperator`, only blocks with block row no greater than block column are stored and the remaining coordinate entries are dropped from the scatter map.
+
+  @param[in]  op             `CeedOperator` to assemble
+  @param[in]  block_size     Number of components per node
+  @param[in]  comp_stride    Component stride of the active L-vectors
+  @param[out] num_block_rows Number of block rows
+  @param[out] row_offsets    Offset of the first block of each block row, of length `num_block_rows + 1`
+  @param[out] col_indices    Block column index of each block
+  @param[out] data           Address of the variable where the newly created `CeedSparseAssembly` will be stored
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
+  @ref Developer
 **/
-int CeedQFunctionAssemblyDataCreate(Ceed ceed, CeedQFunctionAssemblyData *data) {
+static int CeedOperatorLinearAssembleSymbolicSparse(CeedOperator op, CeedInt block_size, CeedInt comp_stride, CeedSize *num_block_rows,
+                                                    CeedSize **row_offsets, CeedInt **col_indices, CeedSparseAssembly *data) {
+  const CeedInt    num_block_values = block_size * block_size;
+  bool             is_symmetric;
+  CeedInt         *rows, *cols, *block_entries;
+  CeedSize         input_size, output_size, num_entries, num_blocks = 0;
+  CeedSparseEntry *entries;
+
+  CeedCall(CeedOperatorLinearAssembleSymbolic(op, &num_entries, &rows, &cols));
+  CeedCall(CeedOperatorGetActiveVectorLengths(op, &input_size, &output_size));
+  CeedCall(CeedOperatorIsSymmetric(op, &is_symmetric));
+  CeedCheck(!is_symmetric || input_size == output_size, CeedOperatorReturnCeed(op), CEED_ERROR_DIMENSION, "Symmetric operator must be square");
+  *num_block_rows = output_size / block_size;
+
+  // Split coordinate entries into nodes and entry within block
+  CeedCall(CeedMalloc(num_entries, &block_entries));
+  for (CeedSize k = 0; k < num_entries; k++) {
+    const CeedInt comp_out = comp_stride == 1 ? rows[k] % block_size : rows[k] / comp_stride;
+    const CeedInt comp_in  = comp_stride == 1 ? cols[k] % block_size : cols[k] / comp_stride;
+
+    rows[k]          = comp_stride == 1 ? rows[k] / block_size : rows[k] % comp_stride;
+    cols[k]          = comp_stride == 1 ? cols[k] / block_size : cols[k] % comp_stride;
+    block_entries[k] = comp_out * block_size + comp_in;
+  }
+
+  // Bucket coordinate entries by block row
+  CeedCall(CeedCalloc(*num_block_rows + 1, row_offsets));
+  for (CeedSize k = 0; k < num_entries; k++) {
+    if (!is_symmetric || rows[k] <= cols[k]) (*row_offsets)[rows[k] + 1]++;
+  }
+  for (CeedSize i = 0; i < *num_block_rows; i++) (*row_offsets)[i + 1] += (*row_offsets)[i];
+  CeedCall(CeedMalloc(num_entries, &entries));
+  {
+    CeedSize *row_next;
+
+    CeedCall(CeedMalloc(*num_block_rows, &row_next));
+    memcpy(row_next, *row_offsets, *num_block_rows * sizeof(CeedSize));
+    for (CeedSize k = 0; k < num_entries; k++) {
+      if (!is_symmetric || rows[k] <= cols[k]) {
+        const CeedSize slot = row_next[rows[k]]++;
+
+        entries[slot].col   = cols[k];
+        entries[slot].entry = k;
+      }
+    }
+    CeedCall(CeedFree(&row_next));
+  }
+  CeedCall(CeedFree(&rows));
+  CeedCall(CeedFree(&cols));
+
+  // Sort each block row by block column and merge duplicates
   CeedCall(CeedCalloc(1, data));
-  (*data)->ref_count = 1;
-  (*data)->ceed      = ceed;
-  CeedCall(CeedReference(ceed));
+  (*data)->num_entries = num_entries;
+  CeedCall(CeedMalloc(num_entries, &(*data)->scatter));
+  for (CeedSize k = 0; k < num_entries; k++) (*data)->scatter[k] = -1;
+  CeedCall(CeedMalloc(num_entries, col_indices));
+  for (CeedSize i = 0; i < *num_block_rows; i++) {
+    const CeedSize row_start = (*row_offsets)[i], row_end = (*row_offsets)[i + 1];
+
+    if (row_end - row_start > 1) qsort(&entries[row_start], row_end - row_start, sizeof(CeedSparseEntry), CeedSparseEntryCompare);
+    (*row_offsets)[i] = num_blocks;
+    for (CeedSize k = row_start; k < row_end; k++) {
+      const CeedSize entry = entries[k].entry;
+
+      if (k == row_start || entries[k].col != entries[k - 1].col) (*col_indices)[num_blocks++] = entries[k].col;
+      (*data)->scatter[entry] = (num_blocks - 1) * num_block_values + block_entries[entry];
+    }
+  }
+  (*row_offsets)[*num_block_rows] = num_blocks;
+  (*data)->num_values             = num_blocks * num_block_values;
+  CeedCall(CeedRealloc(num_blocks, col_indices));
+  CeedCall(CeedFree(&entries));
+  CeedCall(CeedFree(&block_entries));
   return CEED_ERROR_SUCCESS;
 }
 
 /**
-  @brief Increment the reference counter for a `CeedQFunctionAssemblyData`
+  @brief Sum the values of a non-composite `CeedOperator` into compressed sparse storage.
+
+  The scatter table is ordered as the coordinate entries of @ref CeedSingleOperatorAssemble(), so the entries of each element are contiguous and give the compressed storage slot of each entry of the element matrix.
+  Backends that implement `LinearAssembleSingleAddSparse` sum element matrices directly into `values`.
+  Otherwise, the coordinate values are assembled into a temporary `CeedVector`.
+
+  @param[in]     op      `CeedOperator` to assemble
+  @param[in]     scatter Compressed storage slot of each coordinate entry of `op`, -1 for dropped entries
+  @param[in,out] values  Values of the assembled matrix
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorAssembleAddSparse(CeedOperator op, const CeedSize *scatter, CeedVector values) {
+  CeedSize num_entries;
+
+  CeedCall(CeedSingleOperatorAssemblyCountEntries(op, &num_entries));
+  if (num_entries == 0) return CEED_ERROR_SUCCESS;
+
+  if (op->op_galerkin_fine) {
+    // Galerkin coarse operator
+    CeedOperatorElementAssemblyData data;
+
+    CeedCall(CeedOperatorGetElementAssemblyData(op, &data));
+    CeedCall(CeedOperatorElementAssemblyDataGetValues(data, 0, scatter, values));
+    return CEED_ERROR_SUCCESS;
+  } else if (op->LinearAssembleSingleAddSparse) {
+    // Backend version
+    CeedCall(op->LinearAssembleSingleAddSparse(op, scatter, values));
+    return CEED_ERROR_SUCCESS;
+  } else {
+    // Operator fallback
+    CeedOperator op_fallback;
+
+    CeedDebug(CeedOperatorReturnCeed(op), "\nFalling back for CeedSingleOperatorAssembleAddSparse\n");
+    CeedCall(CeedOperatorGetFallback(op, &op_fallback));
+    if (op_fallback) {
+      CeedCall(CeedSingleOperatorAssembleAddSparse(op_fallback, scatter, values));
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+
+  // Default to scattering coordinate values
+  const CeedScalar *coo_array;
+  CeedScalar       *values_array;
+  CeedVector        coo_values;
+
+  CeedCall(CeedVectorCreate(CeedOperatorReturnCeed(op), num_entries, &coo_values));
+  CeedCall(CeedVectorSetValue(coo_values, 0.0));
+  CeedCall(CeedSingleOperatorAssemble(op, 0, coo_values));
+  CeedCall(CeedVectorGetArrayRead(coo_values, CEED_MEM_HOST, &coo_array));
+  CeedCall(CeedVectorGetArray(values, CEED_MEM_HOST, &values_array));
+  for (CeedSize i = 0; i < num_entries; i++) {
+    if (scatter[i] >= 0) values_array[scatter[i]] += coo_array[i];
+  }
+  CeedCall(CeedVectorRestoreArray(values, &values_array));
+  CeedCall(CeedVectorRestoreArrayRead(coo_values, &coo_array));
+  CeedCall(CeedVectorDestroy(&coo_values));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Assemble the values of a linear `CeedOperator` into compressed sparse storage with a cached `CeedSparseAssembly` scatter map.
+
+  Element matrices are summed one sub-operator at a time into `values` with the scatter map, see @ref CeedSingleOperatorAssembleAddSparse().
+
+  @param[in]  op     `CeedOperator` to assemble
+  @param[in]  data   `CeedSparseAssembly` from @ref CeedOperatorLinearAssembleSymbolicSparse()
+  @param[out] values Values of the assembled matrix
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorLinearAssembleSparse(CeedOperator op, CeedSparseAssembly data, CeedVector values) {
+  bool          is_composite;
+  CeedInt       num_sub_operators = 1;
+  CeedSize      length, offset = 0;
+  CeedOperator *sub_operators = &op;
+
+  CeedCall(CeedOperatorCheckReady(op));
+  CeedCall(CeedVectorGetLength(values, &length));
+  CeedCheck(length == data->num_values, CeedOperatorReturnCeed(op), CEED_ERROR_DIMENSION,
+            "Values vector length %" CeedSize_FMT " does not match sparse nonzero pattern with %" CeedSize_FMT " values", length, data->num_values);
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  if (is_composite) {
+    CeedCall(CeedCompositeOperatorGetNumSub(op, &num_sub_operators));
+    CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
+  }
+
+  // Sum element matrices into compressed values
+  CeedCall(CeedVectorSetValue(values, 0.0));
+  for (CeedInt k = 0; k < num_sub_operators; k++) {
+    CeedSize single_entries;
+
+    CeedCall(CeedSingleOperatorAssembleAddSparse(sub_operators[k], &data->scatter[offset], values));
+    CeedCall(CeedSingleOperatorAssemblyCountEntries(sub_operators[k], &single_entries));
+    offset += single_entries;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/// @}
+
+/// ----------------------------------------------------------------------------
+/// CeedOperator Backend API
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedOperatorBackend
+/// @{
+
+/**
+  @brief Select correct basis matrix pointer based on @ref CeedEvalMode
+
+  @param[in]  basis     `CeedBasis` from which to get the basis matrix
+  @param[in]  eval_mode Current basis evaluation mode
+  @param[in]  identity  Pointer to identity matrix
+  @param[out] basis_ptr `CeedBasis` pointer to set
+
+  @ref Backend
+**/
+int CeedOperatorGetBasisPointer(CeedBasis basis, CeedEvalMode eval_mode, const CeedScalar *identity, const CeedScalar **basis_ptr) {
+  switch (eval_mode) {
+    case CEED_EVAL_NONE:
+      *basis_ptr = identity;
+      break;
+    case CEED_EVAL_INTERP:
+      CeedCall(CeedBasisGetInterp(basis, basis_ptr));
+      break;
+    case CEED_EVAL_GRAD:
+      CeedCall(CeedBasisGetGrad(basis, basis_ptr));
+      break;
+    case CEED_EVAL_DIV:
+      CeedCall(CeedBasisGetDiv(basis, basis_ptr));
+      break;
+    case CEED_EVAL_CURL:
+      CeedCall(CeedBasisGetCurl(basis, basis_ptr));
+      break;
+    case CEED_EVAL_WEIGHT:
+      break;  // Caught by QF Assembly
+  }
+  assert(*basis_ptr != NULL);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Create point block restriction for active `CeedOperatorField`
+
+  @param[in]  rstr             Original `CeedElemRestriction` for active field
+  @param[out] point_block_rstr Address of the variable where the newly created `CeedElemRestriction` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorCreateActivePointBlockRestriction(CeedElemRestriction rstr, CeedElemRestriction *point_block_rstr) {
+  Ceed           ceed;
+  CeedInt        num_elem, num_comp, shift, elem_size, comp_stride, *point_block_offsets;
+  CeedSize       l_size;
+  const CeedInt *offsets;
+
+  CeedCall(CeedElemRestrictionGetCeed(rstr, &ceed));
+  CeedCall(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
+
+  // Expand offsets
+  CeedCall(CeedElemRestrictionGetNumElements(rstr, &num_elem));
+  CeedCall(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
+  CeedCall(CeedElemRestrictionGetElementSize(rstr, &elem_size));
+  CeedCall(CeedElemRestrictionGetCompStride(rstr, &comp_stride));
+  CeedCall(CeedElemRestrictionGetLVectorSize(rstr, &l_size));
+  shift = num_comp;
+  if (comp_stride != 1) shift *= num_comp;
+  CeedCall(CeedCalloc(num_elem * elem_size, &point_block_offsets));
+  for (CeedInt i = 0; i < num_elem * elem_size; i++) {
+    point_block_offsets[i] = offsets[i] * shift;
+  }
+
+  // Create new restriction
+  CeedCall(CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp * num_comp, 1, l_size * num_comp, CEED_MEM_HOST, CEED_OWN_POINTER,
+                                     point_block_offsets, point_block_rstr));
+
+  // Cleanup
+  CeedCall(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
+  CeedCall(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get `CeedQFunctionAssemblyData`
+
+  @param[in]  op   `CeedOperator` to assemble
+  @param[out] data `CeedQFunctionAssemblyData`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorGetQFunctionAssemblyData(CeedOperator op, CeedQFunctionAssemblyData *data) {
+  if (!op->qf_assembled) {
+    CeedQFunctionAssemblyData data;
+
+    CeedCall(CeedQFunctionAssemblyDataCreate(op->ceed, &data));
+    op->qf_assembled = data;
+  }
+  *data = op->qf_assembled;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Create object holding `CeedQFunction` assembly data for `CeedOperator`
+
+  @param[in]  ceed `Ceed` object used to create the `CeedQFunctionAssemblyData`
+  @param[out] data Address of the variable where the newly created `CeedQFunctionAssemblyData` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedQFunctionAssemblyDataCreate(Ceed ceed, CeedQFunctionAssemblyData *data) {
+  CeedCall(CeedCalloc(1, data));
+  (*data)->ref_count = 1;
+  (*data)->ceed      = ceed;
+  CeedCall(CeedReference(ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Increment the reference counter for a `CeedQFunctionAssemblyData`
 
   @param[in,out] data `CeedQFunctionAssemblyData` to increment the reference counter
 
@@ -1371,6 +2042,21 @@ int CeedQFunctionAssemblyDataSetReuse(CeedQFunctionAssemblyData data, bool reuse
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Determine if `CeedQFunctionAssemblyData` reuses assembled data between calls
+
+  @param[in]  data       `CeedQFunctionAssemblyData`
+  @param[out] reuse_data Boolean flag indicating if assembled data is reused
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedQFunctionAssemblyDataIsReuse(CeedQFunctionAssemblyData data, bool *reuse_data) {
+  *reuse_data = data->reuse_data;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Mark `CeedQFunctionAssemblyData` as stale
 
@@ -1920,6 +2606,268 @@ int CeedOperatorAssemblyDataDestroy(CeedOperatorAssemblyData *data) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get `CeedOperatorElementAssemblyData`, assembling the element matrices if needed
+
+  @param[in]  op   `CeedOperator` to assemble
+  @param[out] data `CeedOperatorElementAssemblyData`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorGetElementAssemblyData(CeedOperator op, CeedOperatorElementAssemblyData *data) {
+  if (!op->elem_assembled) {
+    CeedOperatorElementAssemblyData data;
+
+    CeedCall(CeedOperatorElementAssemblyDataCreate(op->ceed, op, &data));
+    op->elem_assembled = data;
+  } else if (op->elem_assembled->needs_data_update ||
+             (op->op_galerkin_fine && op->elem_assembled->galerkin_fine_state != CeedOperatorGetGalerkinFineState(op))) {
+    CeedCall(CeedSingleOperatorAssembleElementMatrices(op, op->elem_assembled));
+  }
+  op->elem_assembled->elem_mask = op->elem_mask;
+  *data                         = op->elem_assembled;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Create object holding dense element matrices for a non-composite `CeedOperator`.
+
+  The `CeedOperatorElementAssemblyData` holds the element matrices of the `CeedOperator`, references to the active input and output `CeedElemRestriction`, and E-vectors for application.
+  Oriented `CeedElemRestriction` are replaced by unoriented copies, as the orientations are included in the element matrices.
+
+  @param[in]  ceed `Ceed` object used to create the `CeedOperatorElementAssemblyData`
+  @param[in]  op   `CeedOperator` to assemble
+  @param[out] data Address of the variable where the newly created `CeedOperatorElementAssemblyData` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorElementAssemblyDataCreate(Ceed ceed, CeedOperator op, CeedOperatorElementAssemblyData *data) {
+  CeedInt             num_elem_out;
+  CeedRestrictionType rstr_type;
+  CeedElemRestriction rstr_in, rstr_out;
+
+  CeedCall(CeedCalloc(1, data));
+  CeedCall(CeedReferenceCopy(ceed, &(*data)->ceed));
+
+  // Active restrictions
+  CeedCall(CeedOperatorGetActiveElemRestrictions(op, &rstr_in, &rstr_out));
+  CeedCall(CeedElemRestrictionGetType(rstr_in, &rstr_type));
+  if (rstr_type == CEED_RESTRICTION_ORIENTED || rstr_type == CEED_RESTRICTION_CURL_ORIENTED) {
+    CeedCall(CeedElemRestrictionCreateUnorientedCopy(rstr_in, &(*data)->rstr_in));
+  } else {
+    CeedCall(CeedElemRestrictionReferenceCopy(rstr_in, &(*data)->rstr_in));
+  }
+  if (rstr_in != rstr_out) {
+    CeedCall(CeedElemRestrictionGetType(rstr_out, &rstr_type));
+    if (rstr_type == CEED_RESTRICTION_ORIENTED || rstr_type == CEED_RESTRICTION_CURL_ORIENTED) {
+      CeedCall(CeedElemRestrictionCreateUnorientedCopy(rstr_out, &(*data)->rstr_out));
+    } else {
+      CeedCall(CeedElemRestrictionReferenceCopy(rstr_out, &(*data)->rstr_out));
+    }
+  } else {
+    CeedCall(CeedElemRestrictionReferenceCopy((*data)->rstr_in, &(*data)->rstr_out));
+  }
+  CeedCall(CeedElemRestrictionDestroy(&rstr_in));
+  CeedCall(CeedElemRestrictionDestroy(&rstr_out));
+
+  // Sizes and E-vector layouts
+  CeedCall(CeedElemRestrictionGetNumElements((*data)->rstr_in, &(*data)->num_elem));
+  CeedCall(CeedElemRestrictionGetNumElements((*data)->rstr_out, &num_elem_out));
+  CeedCheck((*data)->num_elem == num_elem_out, ceed, CEED_ERROR_UNSUPPORTED,
+            "Active input and output operator restrictions must have the same number of elements."
+            " Input has %" CeedInt_FMT " elements; output has %" CeedInt_FMT "elements.",
+            (*data)->num_elem, num_elem_out);
+  CeedCall(CeedElemRestrictionGetElementSize((*data)->rstr_in, &(*data)->elem_size_in));
+  CeedCall(CeedElemRestrictionGetNumComponents((*data)->rstr_in, &(*data)->num_comp_in));
+  CeedCall(CeedElemRestrictionGetELayout((*data)->rstr_in, (*data)->layout_in));
+  CeedCall(CeedElemRestrictionGetElementSize((*data)->rstr_out, &(*data)->elem_size_out));
+  CeedCall(CeedElemRestrictionGetNumComponents((*data)->rstr_out, &(*data)->num_comp_out));
+  CeedCall(CeedElemRestrictionGetELayout((*data)->rstr_out, (*data)->layout_out));
+  CeedCall(CeedElemRestrictionCreateVector((*data)->rstr_in, NULL, &(*data)->e_vec_in));
+  CeedCall(CeedElemRestrictionCreateVector((*data)->rstr_out, NULL, &(*data)->e_vec_out));
+
+  // Element matrices
+  {
+    const CeedSize num_entries = (CeedSize)(*data)->elem_size_in * (*data)->num_comp_in * (*data)->elem_size_out * (*data)->num_comp_out;
+
+    const CeedInt  num_values  = CeedIntMax((*data)->elem_size_in * (*data)->num_comp_in, (*data)->elem_size_out * (*data)->num_comp_out);
+
+    (*data)->num_blocks = (*data)->num_elem / CEED_ELEM_ASSEMBLY_BLOCK_SIZE + !!((*data)->num_elem % CEED_ELEM_ASSEMBLY_BLOCK_SIZE);
+    CeedCall(CeedCalloc(num_entries * (*data)->num_blocks * CEED_ELEM_ASSEMBLY_BLOCK_SIZE, &(*data)->elem_mats));
+    CeedCall(CeedCalloc(num_values * CEED_ELEM_ASSEMBLY_BLOCK_SIZE, &(*data)->u_block));
+    CeedCall(CeedCalloc(num_values * CEED_ELEM_ASSEMBLY_BLOCK_SIZE, &(*data)->v_block));
+  }
+  CeedCall(CeedSingleOperatorAssembleElementMatrices(op, *data));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Mark element matrices in `CeedOperatorElementAssemblyData` as requiring re-assembly
+
+  @param[in,out] data              `CeedOperatorElementAssemblyData`
+  @param[in]     needs_data_update Boolean flag setting update needed
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorElementAssemblyDataSetUpdateNeeded(CeedOperatorElementAssemblyData data, bool needs_data_update) {
+  data->needs_data_update = needs_data_update;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Check if a block of `CeedOperatorElementAssemblyData` contains elements selected by the element mask
+
+  @param[in] data  `CeedOperatorElementAssemblyData`
+  @param[in] block Index of the block of elements
+
+  @return Boolean flag, true if the block contains selected elements
+
+  @ref Developer
+**/
+static inline bool CeedElementAssemblyDataIsBlockActive(CeedOperatorElementAssemblyData data, CeedInt block) {
+  for (CeedInt e = block * CEED_ELEM_ASSEMBLY_BLOCK_SIZE; e < CeedIntMin((block + 1) * CEED_ELEM_ASSEMBLY_BLOCK_SIZE, data->num_elem); e++) {
+    if (data->elem_mask[e]) return true;
+  }
+  return false;
+}
+
+/**
+  @brief Apply element matrices in `CeedOperatorElementAssemblyData` and add scaled result to output `CeedVector`.
+
+  This computes `out += alpha * R_out^T A_e R_in in`, or `out += alpha * R_in^T A_e^T R_out in` for the transpose, where `A_e` is the block diagonal matrix of element matrices.
+  The element matrices are applied as a batched dense matrix-vector product, vectorized across the elements of each block.
+  With an element mask, only ranges of blocks containing selected elements are restricted and applied, and elements not selected do not contribute.
+
+  @param[in]     data         `CeedOperatorElementAssemblyData`
+  @param[in]     is_transpose Boolean flag to apply the transpose of the element matrices
+  @param[in]     alpha        Scaling factor for the action of the element matrices
+  @param[in]     in           `CeedVector` containing input state
+  @param[in,out] out          `CeedVector` to sum in result
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorElementAssemblyDataApplyAdd(CeedOperatorElementAssemblyData data, bool is_transpose, CeedScalar alpha, CeedVector in,
+                                            CeedVector out) {
+  const CeedInt       num_rows = data->elem_size_out * data->num_comp_out, num_cols = data->elem_size_in * data->num_comp_in;
+  const CeedInt       num_u = is_transpose ? num_rows : num_cols, num_v = is_transpose ? num_cols : num_rows;
+  const CeedInt       elem_size_u = is_transpose ? data->elem_size_out : data->elem_size_in;
+  const CeedInt       elem_size_v = is_transpose ? data->elem_size_in : data->elem_size_out;
+  const CeedInt      *layout_u = is_transpose ? data->layout_out : data->layout_in, *layout_v = is_transpose ? data->layout_in : data->layout_out;
+  const CeedScalar   *e_u;
+  CeedScalar         *e_v, *u = data->u_block, *v = data->v_block;
+  CeedVector          e_vec_u = is_transpose ? data->e_vec_out : data->e_vec_in, e_vec_v = is_transpose ? data->e_vec_in : data->e_vec_out;
+  CeedElemRestriction rstr_u = is_transpose ? data->rstr_out : data->rstr_in, rstr_v = is_transpose ? data->rstr_in : data->rstr_out;
+
+  // Loop through ranges of blocks containing elements selected by the element mask
+  for (CeedInt b_start = 0, b_stop; b_start < data->num_blocks; b_start = b_stop) {
+    if (data->elem_mask) {
+      while (b_start < data->num_blocks && !CeedElementAssemblyDataIsBlockActive(data, b_start)) b_start++;
+    }
+    for (b_stop = b_start; b_stop < data->num_blocks && (!data->elem_mask || CeedElementAssemblyDataIsBlockActive(data, b_stop));) b_stop++;
+    if (b_start == b_stop) break;
+    const CeedInt range_start = b_start * CEED_ELEM_ASSEMBLY_BLOCK_SIZE;
+    const CeedInt range_stop  = CeedIntMin(b_stop * CEED_ELEM_ASSEMBLY_BLOCK_SIZE, data->num_elem);
+
+    // -- Restrict input
+    CeedCall(CeedElemRestrictionApplyRange(rstr_u, range_start, range_stop, CEED_NOTRANSPOSE, in, e_vec_u, CEED_REQUEST_IMMEDIATE));
+    CeedCall(CeedVectorGetArrayRead(e_vec_u, CEED_MEM_HOST, &e_u));
+    CeedCall(CeedVectorGetArrayWrite(e_vec_v, CEED_MEM_HOST, &e_v));
+
+    // -- Apply element matrices block by block
+    for (CeedInt b = b_start; b < b_stop; b++) {
+      const CeedInt     e_start = b * CEED_ELEM_ASSEMBLY_BLOCK_SIZE - range_start;
+      const CeedInt     num_lanes = CeedIntMin(CEED_ELEM_ASSEMBLY_BLOCK_SIZE, data->num_elem - b * CEED_ELEM_ASSEMBLY_BLOCK_SIZE);
+      const CeedScalar *mats = &data->elem_mats[(CeedSize)b * num_rows * num_cols * CEED_ELEM_ASSEMBLY_BLOCK_SIZE];
+
+      // ---- Gather element values, interleaving elements
+      for (CeedInt k = 0; k < num_u; k++) {
+        const CeedInt node = k % elem_size_u, comp = k / elem_size_u;
+
+        for (CeedInt lane = 0; lane < num_lanes; lane++) {
+          u[k * CEED_ELEM_ASSEMBLY_BLOCK_SIZE + lane] = e_u[node * layout_u[0] + comp * layout_u[1] + (CeedSize)(e_start + lane) * layout_u[2]];
+        }
+      }
+
+      // ---- Batched dense matrix-vector product
+      for (CeedInt k = 0; k < num_v * CEED_ELEM_ASSEMBLY_BLOCK_SIZE; k++) v[k] = 0.0;
+      if (!is_transpose) {
+        for (CeedInt i = 0; i < num_rows; i++) {
+          for (CeedInt j = 0; j < num_cols; j++) {
+            const CeedScalar *a_ij = &mats[(i * num_cols + j) * CEED_ELEM_ASSEMBLY_BLOCK_SIZE];
+
+            CeedPragmaSIMD for (CeedInt lane = 0; lane < CEED_ELEM_ASSEMBLY_BLOCK_SIZE; lane++) {
+              v[i * CEED_ELEM_ASSEMBLY_BLOCK_SIZE + lane] += a_ij[lane] * u[j * CEED_ELEM_ASSEMBLY_BLOCK_SIZE + lane];
+            }
+          }
+        }
+      } else {
+        for (CeedInt i = 0; i < num_rows; i++) {
+          for (CeedInt j = 0; j < num_cols; j++) {
+            const CeedScalar *a_ij = &mats[(i * num_cols + j) * CEED_ELEM_ASSEMBLY_BLOCK_SIZE];
+
+            CeedPragmaSIMD for (CeedInt lane = 0; lane < CEED_ELEM_ASSEMBLY_BLOCK_SIZE; lane++) {
+              v[j * CEED_ELEM_ASSEMBLY_BLOCK_SIZE + lane] += a_ij[lane] * u[i * CEED_ELEM_ASSEMBLY_BLOCK_SIZE + lane];
+            }
+          }
+        }
+      }
+
+      // ---- Scatter scaled element values, with no contribution from elements not selected by the mask
+      for (CeedInt k = 0; k < num_v; k++) {
+        const CeedInt node = k % elem_size_v, comp = k / elem_size_v;
+
+        for (CeedInt lane = 0; lane < num_lanes; lane++) {
+          const bool is_selected = !data->elem_mask || data->elem_mask[b * CEED_ELEM_ASSEMBLY_BLOCK_SIZE + lane];
+
+          e_v[node * layout_v[0] + comp * layout_v[1] + (CeedSize)(e_start + lane) * layout_v[2]] =
+              is_selected ? alpha * v[k * CEED_ELEM_ASSEMBLY_BLOCK_SIZE + lane] : 0.0;
+        }
+      }
+    }
+    CeedCall(CeedVectorRestoreArrayRead(e_vec_u, &e_u));
+    CeedCall(CeedVectorRestoreArray(e_vec_v, &e_v));
+
+    // -- Restrict output
+    CeedCall(CeedElemRestrictionApplyRange(rstr_v, range_start, range_stop, CEED_TRANSPOSE, e_vec_v, out, CEED_REQUEST_IMMEDIATE));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Destroy `CeedOperatorElementAssemblyData`
+
+  @param[in,out] data `CeedOperatorElementAssemblyData` to destroy
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorElementAssemblyDataDestroy(CeedOperatorElementAssemblyData *data) {
+  if (!*data) {
+    *data = NULL;
+    return CEED_ERROR_SUCCESS;
+  }
+  CeedCall(CeedDestroy(&(*data)->ceed));
+  CeedCall(CeedElemRestrictionDestroy(&(*data)->rstr_in));
+  CeedCall(CeedElemRestrictionDestroy(&(*data)->rstr_out));
+  CeedCall(CeedVectorDestroy(&(*data)->e_vec_in));
+  CeedCall(CeedVectorDestroy(&(*data)->e_vec_out));
+  CeedCall(CeedFree(&(*data)->elem_mats));
+  CeedCall(CeedFree(&(*data)->u_block));
+  CeedCall(CeedFree(&(*data)->v_block));
+
+  CeedCall(CeedFree(data));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Retrieve fallback `CeedOperator` with a reference `Ceed` for advanced `CeedOperator` functionality
 
@@ -2021,6 +2969,9 @@ int CeedOperatorGetFallbackParentCeed(CeedOperator op, Ceed *parent) {
 **/
 int CeedOperatorLinearAssembleQFunction(CeedOperator op, CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
   CeedCall(CeedOperatorCheckReady(op));
+  CeedCheck(!op->is_product, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED, "Linear assembly is not supported for product CeedOperator");
+  CeedCheck(!op->op_galerkin_fine, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED,
+            "CeedQFunction assembly is not supported for Galerkin coarse CeedOperator");
 
   if (op->LinearAssembleQFunction) {
     // Backend version
@@ -2095,7 +3046,12 @@ int CeedOperatorLinearAssembleDiagonal(CeedOperator op, CeedVector assembled, Ce
     if (num_elem == 0) return CEED_ERROR_SUCCESS;
   }
 
-  if (op->LinearAssembleDiagonal) {
+  if (op->op_galerkin_fine) {
+    // Galerkin coarse operator
+    CeedCall(CeedVectorSetValue(assembled, 0.0));
+    CeedCall(CeedOperatorLinearAssembleAddDiagonal(op, assembled, request));
+    return CEED_ERROR_SUCCESS;
+  } else if (op->LinearAssembleDiagonal) {
     // Backend version
     CeedCall(op->LinearAssembleDiagonal(op, assembled, request));
     return CEED_ERROR_SUCCESS;
@@ -2148,6 +3104,7 @@ int CeedOperatorLinearAssembleAddDiagonal(CeedOperator op, CeedVector assembled,
   CeedSize input_size = 0, output_size = 0;
 
   CeedCall(CeedOperatorCheckReady(op));
+  CeedCheck(!op->is_product, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED, "Linear assembly is not supported for product CeedOperator");
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
 
   CeedCall(CeedOperatorGetActiveVectorLengths(op, &input_size, &output_size));
@@ -2161,7 +3118,14 @@ int CeedOperatorLinearAssembleAddDiagonal(CeedOperator op, CeedVector assembled,
     if (num_elem == 0) return CEED_ERROR_SUCCESS;
   }
 
-  if (op->LinearAssembleAddDiagonal) {
+  if (op->op_galerkin_fine) {
+    // Galerkin coarse operator
+    CeedOperatorElementAssemblyData data;
+
+    CeedCall(CeedOperatorGetElementAssemblyData(op, &data));
+    CeedCall(CeedOperatorElementAssemblyDataAddDiagonal(data, false, assembled));
+    return CEED_ERROR_SUCCESS;
+  } else if (op->LinearAssembleAddDiagonal) {
     // Backend version
     CeedCall(op->LinearAssembleAddDiagonal(op, assembled, request));
     return CEED_ERROR_SUCCESS;
@@ -2210,6 +3174,8 @@ int CeedOperatorLinearAssemblePointBlockDiagonalSymbolic(CeedOperator op, CeedSi
   CeedInt       num_active_components, num_sub_operators;
   CeedOperator *sub_operators;
 
+  CeedCheck(!op->is_product, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED, "Linear assembly is not supported for product CeedOperator");
+
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
 
   CeedSize input_size = 0, output_size = 0;
@@ -2326,7 +3292,12 @@ int CeedOperatorLinearAssemblePointBlockDiagonal(CeedOperator op, CeedVector ass
     if (num_elem == 0) return CEED_ERROR_SUCCESS;
   }
 
-  if (op->LinearAssemblePointBlockDiagonal) {
+  if (op->op_galerkin_fine) {
+    // Galerkin coarse operator
+    CeedCall(CeedVectorSetValue(assembled, 0.0));
+    CeedCall(CeedOperatorLinearAssembleAddPointBlockDiagonal(op, assembled, request));
+    return CEED_ERROR_SUCCESS;
+  } else if (op->LinearAssemblePointBlockDiagonal) {
     // Backend version
     CeedCall(op->LinearAssemblePointBlockDiagonal(op, assembled, request));
     return CEED_ERROR_SUCCESS;
@@ -2376,6 +3347,7 @@ int CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op, CeedVector
   CeedSize input_size = 0, output_size = 0;
 
   CeedCall(CeedOperatorCheckReady(op));
+  CeedCheck(!op->is_product, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED, "Linear assembly is not supported for product CeedOperator");
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
 
   CeedCall(CeedOperatorGetActiveVectorLengths(op, &input_size, &output_size));
@@ -2389,7 +3361,14 @@ int CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op, CeedVector
     if (num_elem == 0) return CEED_ERROR_SUCCESS;
   }
 
-  if (op->LinearAssembleAddPointBlockDiagonal) {
+  if (op->op_galerkin_fine) {
+    // Galerkin coarse operator
+    CeedOperatorElementAssemblyData data;
+
+    CeedCall(CeedOperatorGetElementAssemblyData(op, &data));
+    CeedCall(CeedOperatorElementAssemblyDataAddDiagonal(data, true, assembled));
+    return CEED_ERROR_SUCCESS;
+  } else if (op->LinearAssembleAddPointBlockDiagonal) {
     // Backend version
     CeedCall(op->LinearAssembleAddPointBlockDiagonal(op, assembled, request));
     return CEED_ERROR_SUCCESS;
@@ -2440,6 +3419,7 @@ int CeedOperatorLinearAssembleSymbolic(CeedOperator op, CeedSize *num_entries, C
   CeedOperator *sub_operators;
 
   CeedCall(CeedOperatorCheckReady(op));
+  CeedCheck(!op->is_product, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED, "Linear assembly is not supported for product CeedOperator");
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
 
   if (op->LinearAssembleSymbolic) {
@@ -2516,6 +3496,7 @@ int CeedOperatorLinearAssemble(CeedOperator op, CeedVector values) {
   CeedOperator *sub_operators;
 
   CeedCall(CeedOperatorCheckReady(op));
+  CeedCheck(!op->is_product, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED, "Linear assembly is not supported for product CeedOperator");
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
 
   // Early exit for empty operator
@@ -2563,6 +3544,173 @@ int CeedOperatorLinearAssemble(CeedOperator op, CeedVector values) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+   @brief Assemble the compressed sparse row (CSR) nonzero pattern of a linear `CeedOperator`.
+
+   Expected to be used in conjunction with @ref CeedOperatorLinearAssembleCSR().
+
+   The coordinate nonzero pattern from @ref CeedOperatorLinearAssembleSymbolic() is sorted by row and column and duplicate `(i, j)` pairs are merged.
+   The map from each coordinate entry to its slot in the CSR values is cached on the `CeedOperator`, so that repeated numeric assembly with @ref CeedOperatorLinearAssembleCSR() sums duplicate entries with a single scatter and without sorting.
+   Column indices are strictly increasing within each row.
+   If the `CeedOperator` is declared symmetric with @ref CeedOperatorSetSymmetric(), only the upper triangle, with column index no less than row index, is stored.
+
+   Note: Calling this function asserts that setup is complete and sets the `CeedOperator` as immutable.
+
+   @param[in]  op          `CeedOperator` to assemble
+   @param[out] num_rows    Number of rows in the assembled matrix
+   @param[out] row_offsets Offset of the first value of each row, of length `num_rows + 1`; the caller is responsible for freeing this array with @ref CeedFree()
+   @param[out] col_indices Column index of each value, of length `row_offsets[num_rows]`; the caller is responsible for freeing this array with @ref CeedFree()
+
+   @return An error code: 0 - success, otherwise - failure
+
+   @ref User
+**/
+int CeedOperatorLinearAssembleSymbolicCSR(CeedOperator op, CeedSize *num_rows, CeedSize **row_offsets, CeedInt **col_indices) {
+  CeedSparseAssembly data;
+
+  CeedCall(CeedOperatorLinearAssembleSymbolicSparse(op, 1, 1, num_rows, row_offsets, col_indices, &data));
+  CeedCall(CeedSparseAssemblyDestroy(&op->csr_assembled));
+  op->csr_assembled = data;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+   @brief Assemble the compressed sparse row (CSR) values of a linear `CeedOperator`.
+
+   Expected to be used in conjunction with @ref CeedOperatorLinearAssembleSymbolicCSR(), which must be called first.
+   The values are ordered to match the `row_offsets` and `col_indices` returned by @ref CeedOperatorLinearAssembleSymbolicCSR().
+
+   Element matrices are summed into `values` with the cached scatter map as they are formed, so backends that support it allocate no coordinate values.
+
+   Note: Calling this function asserts that setup is complete and sets the `CeedOperator` as immutable.
+
+   @param[in]  op     `CeedOperator` to assemble
+   @param[out] values Values of the assembled matrix, of length `row_offsets[num_rows]`
+
+   @return An error code: 0 - success, otherwise - failure
+
+   @ref User
+**/
+int CeedOperatorLinearAssembleCSR(CeedOperator op, CeedVector values) {
+  CeedCheck(op->csr_assembled, CeedOperatorReturnCeed(op), CEED_ERROR_INCOMPLETE,
+            "CeedOperatorLinearAssembleSymbolicCSR must be called before assembling values");
+  CeedCall(CeedOperatorLinearAssembleSparse(op, op->csr_assembled, values));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+   @brief Assemble the block compressed sparse row (BSR) nonzero pattern of a square linear `CeedOperator` with multiple components.
+
+   Expected to be used in conjunction with @ref CeedOperatorLinearAssembleBSR().
+
+   Each pair of coupled nodes gives one dense `block_size * block_size` block, where `block_size` is the number of active components.
+   Nodes and components are identified from the active L-vector layout as in @ref CeedOperatorLinearAssemblePointBlockDiagonal().
+   The map from each coordinate entry to its slot in the BSR values is cached on the `CeedOperator` for repeated numeric assembly with @ref CeedOperatorLinearAssembleBSR().
+   Block column indices are strictly increasing within each block row.
+   If the `CeedOperator` is declared symmetric with @ref CeedOperatorSetSymmetric(), only the upper block triangle, with block column index no less than block row index, is stored.
+
+   Note: All active `CeedElemRestriction` must have the same number of components and component stride.
+
+   Note: Calling this function asserts that setup is complete and sets the `CeedOperator` as immutable.
+
+   @param[in]  op             `CeedOperator` to assemble
+   @param[out] block_size     Number of rows and columns in each block
+   @param[out] num_block_rows Number of block rows in the assembled matrix
+   @param[out] row_offsets    Offset of the first block of each block row, of length `num_block_rows + 1`; the caller is responsible for freeing this array with @ref CeedFree()
+   @param[out] col_indices    Block column index of each block, of length `row_offsets[num_block_rows]`; the caller is responsible for freeing this array with @ref CeedFree()
+
+   @return An error code: 0 - success, otherwise - failure
+
+   @ref User
+**/
+int CeedOperatorLinearAssembleSymbolicBSR(CeedOperator op, CeedInt *block_size, CeedSize *num_block_rows, CeedSize **row_offsets,
+                                          CeedInt **col_indices) {
+  CeedInt            comp_stride;
+  CeedSparseAssembly data;
+
+  CeedCall(CeedOperatorCheckReady(op));
+  CeedCall(CeedOperatorGetActiveNodeLayout(op, block_size, &comp_stride));
+  CeedCall(CeedOperatorLinearAssembleSymbolicSparse(op, *block_size, comp_stride, num_block_rows, row_offsets, col_indices, &data));
+  CeedCall(CeedSparseAssemblyDestroy(&op->bsr_assembled));
+  op->bsr_assembled = data;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+   @brief Assemble the block compressed sparse row (BSR) values of a square linear `CeedOperator` with multiple components.
+
+   Expected to be used in conjunction with @ref CeedOperatorLinearAssembleSymbolicBSR(), which must be called first.
+   The values hold one row-major `block_size * block_size` block for each block column index returned by @ref CeedOperatorLinearAssembleSymbolicBSR(), with shape `[blocks, component out, component in]`.
+
+   Note: Calling this function asserts that setup is complete and sets the `CeedOperator` as immutable.
+
+   @param[in]  op     `CeedOperator` to assemble
+   @param[out] values Values of the assembled matrix, of length `row_offsets[num_block_rows] * block_size * block_size`
+
+   @return An error code: 0 - success, otherwise - failure
+
+   @ref User
+**/
+int CeedOperatorLinearAssembleBSR(CeedOperator op, CeedVector values) {
+  CeedCheck(op->bsr_assembled, CeedOperatorReturnCeed(op), CEED_ERROR_INCOMPLETE,
+            "CeedOperatorLinearAssembleSymbolicBSR must be called before assembling values");
+  CeedCall(CeedOperatorLinearAssembleSparse(op, op->bsr_assembled, values));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Estimate the memory used by element assembly of a `CeedOperator`.
+
+  This reports the bytes of dense element matrices and E-vectors that @ref CeedOperatorSetElementAssembly() would allocate, without assembling anything.
+  For a composite `CeedOperator`, the memory for all sub-operators is summed.
+  Assembling the element matrices temporarily requires an additional copy of the element matrices and the assembled `CeedQFunction`.
+
+  @param[in]  op        `CeedOperator` to estimate element assembly memory for
+  @param[out] num_bytes Address of variable to hold the number of bytes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorGetElementAssemblyMemory(CeedOperator op, CeedSize *num_bytes) {
+  bool is_composite;
+
+  CeedCall(CeedOperatorCheckReady(op));
+  CeedCheck(!op->is_product, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED, "Element assembly is not supported for product CeedOperator");
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+
+  *num_bytes = 0;
+  if (is_composite) {
+    CeedInt       num_suboperators;
+    CeedOperator *sub_operators;
+
+    CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
+    CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
+    for (CeedInt i = 0; i < num_suboperators; i++) {
+      CeedSize single_bytes;
+
+      CeedCall(CeedOperatorGetElementAssemblyMemory(sub_operators[i], &single_bytes));
+      *num_bytes += single_bytes;
+    }
+  } else {
+    CeedInt             num_elem, num_blocks;
+    CeedSize            num_entries, e_vec_len_in, e_vec_len_out;
+    CeedElemRestriction rstr_in, rstr_out;
+
+    CeedCall(CeedOperatorGetNumElements(op, &num_elem));
+    if (num_elem == 0) return CEED_ERROR_SUCCESS;
+    CeedCall(CeedSingleOperatorAssemblyCountEntries(op, &num_entries));
+    CeedCall(CeedOperatorGetActiveElemRestrictions(op, &rstr_in, &rstr_out));
+    CeedCall(CeedElemRestrictionGetEVectorSize(rstr_in, &e_vec_len_in));
+    CeedCall(CeedElemRestrictionGetEVectorSize(rstr_out, &e_vec_len_out));
+    CeedCall(CeedElemRestrictionDestroy(&rstr_in));
+    CeedCall(CeedElemRestrictionDestroy(&rstr_out));
+    num_blocks = num_elem / CEED_ELEM_ASSEMBLY_BLOCK_SIZE + !!(num_elem % CEED_ELEM_ASSEMBLY_BLOCK_SIZE);
+    *num_bytes = (num_entries / num_elem * num_blocks * CEED_ELEM_ASSEMBLY_BLOCK_SIZE + e_vec_len_in + e_vec_len_out) * (CeedSize)sizeof(CeedScalar);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get the multiplicity of nodes across sub-operators in a composite `CeedOperator`.
 
@@ -2587,6 +3735,7 @@ int CeedCompositeOperatorGetMultiplicity(CeedOperator op, CeedInt num_skip_indic
   CeedOperator       *sub_operators;
 
   CeedCall(CeedOperatorCheckReady(op));
+  CeedCheck(!op->is_product, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED, "Linear assembly is not supported for product CeedOperator");
 
   // Zero mult vector
   CeedCall(CeedVectorSetValue(mult, 0.0));
@@ -2637,6 +3786,29 @@ int CeedCompositeOperatorGetMultiplicity(CeedOperator op, CeedInt num_skip_indic
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Set whether multigrid coarse `CeedOperator` created from a `CeedOperator` are Galerkin projections.
+
+  When `use_galerkin = true`, the coarse `CeedOperator` created by @ref CeedOperatorMultigridLevelCreate(), @ref CeedOperatorMultigridLevelCreateTensorH1(), and @ref CeedOperatorMultigridLevelCreateH1() is applied with element matrices `P_e^T A_e P_e`, where `A_e` are the fine element matrices and `P_e` is the element prolongation from the coarse to fine `CeedBasis`.
+  The triple products are computed with the tensor product structure of `P_e` and stored in element assembly form, see @ref CeedOperatorSetElementAssembly(), so coarse memory scales with the coarse element size instead of the fine quadrature data.
+  Diagonal and full assembly of the coarse `CeedOperator` use the same element matrices.
+  The fine element matrices are assembled and projected in chunks of elements, and the coarse `CeedOperator` keeps no references to the passive input `CeedVector` of the fine `CeedOperator`.
+  Calling @ref CeedOperatorSetQFunctionAssemblyDataUpdateNeeded() on the fine `CeedOperator` marks the Galerkin element matrices of all coarser levels for re-assembly.
+  The setting is inherited by the coarse `CeedOperator`, so further coarsening is also Galerkin.
+
+  @param[in,out] op           Fine grid `CeedOperator`
+  @param[in]     use_galerkin Boolean flag to create Galerkin coarse `CeedOperator`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Advanced
+**/
+int CeedOperatorSetMultigridGalerkin(CeedOperator op, bool use_galerkin) {
+  op->use_galerkin_coarse = use_galerkin;
+  if (op->op_fallback) op->op_fallback->use_galerkin_coarse = use_galerkin;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Create a multigrid coarse `CeedOperator` and level transfer `CeedOperator` for a `CeedOperator`, creating the prolongation basis from the fine and coarse grid interpolation.
 
@@ -2661,7 +3833,7 @@ int CeedOperatorMultigridLevelCreate(CeedOperator op_fine, CeedVector p_mult_fin
   CeedCall(CeedOperatorCheckReady(op_fine));
 
   // Build prolongation matrix, if required
-  if (op_prolong || op_restrict) {
+  if (op_prolong || op_restrict || op_fine->use_galerkin_coarse) {
     CeedBasis basis_fine;
 
     CeedCall(CeedOperatorGetActiveBasis(op_fine, &basis_fine));
@@ -2712,7 +3884,7 @@ int CeedOperatorMultigridLevelCreateTensorH1(CeedOperator op_fine, CeedVector p_
             Q_f, Q_c);
 
   // Create coarse to fine basis, if required
-  if (op_prolong || op_restrict) {
+  if (op_prolong || op_restrict || op_fine->use_galerkin_coarse) {
     CeedInt     dim, num_comp, num_nodes_c, P_1d_f, P_1d_c;
     CeedScalar *q_ref, *q_weight, *grad;
 
@@ -2775,7 +3947,7 @@ int CeedOperatorMultigridLevelCreateH1(CeedOperator op_fine, CeedVector p_mult_f
   CeedCheck(Q_f == Q_c, ceed, CEED_ERROR_DIMENSION, "Bases must have compatible quadrature spaces");
 
   // Coarse to fine basis
-  if (op_prolong || op_restrict) {
+  if (op_prolong || op_restrict || op_fine->use_galerkin_coarse) {
     CeedInt          dim, num_comp, num_nodes_c, num_nodes_f;
     CeedScalar      *q_ref, *q_weight, *grad;
     CeedElemTopology topo;
@@ -2804,6 +3976,27 @@ int CeedOperatorMultigridLevelCreateH1(CeedOperator op_fine, CeedVector p_mult_f
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Set whether @ref CeedOperatorCreateFDMElementInverse() shares one scaling between all elements.
+
+  By default, the FDM inverse scales the simultaneous diagonalization by an average of the linearized `CeedQFunction` in each element and stores `num_comp * num_nodes` values per element.
+  With shared scaling, the element averages are averaged over all elements and only `num_comp * num_nodes` values are stored for the whole `CeedOperator`.
+  The scaling is stored with an element stride of 0, and CPU backends restrict it into a single element block instead of a full E-vector.
+  The average is taken over the whole mesh, so this is only suited to meshes with elements of similar shape and size; the approximate inverse degrades on elements that differ from the average.
+
+  @param[in] op                 `CeedOperator`
+  @param[in] use_shared_scaling Boolean flag to share the FDM scaling between elements
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Advanced
+**/
+int CeedOperatorSetFDMSharedScaling(CeedOperator op, bool use_shared_scaling) {
+  op->use_fdm_shared_scaling = use_shared_scaling;
+  if (op->op_fallback) op->op_fallback->use_fdm_shared_scaling = use_shared_scaling;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Build a FDM based approximate inverse for each element for a `CeedOperator`.
 
@@ -2812,6 +4005,7 @@ int CeedOperatorMultigridLevelCreateH1(CeedOperator op_fine, CeedVector p_mult_f
   The assembled `CeedQFunction` is used to modify the eigenvalues from simultaneous diagonalization and obtain an approximate inverse of the form \f$V^T \hat S V\f$.
   The `CeedOperator` must be linear and non-composite.
   The associated `CeedQFunction` must therefore also be linear.
+  With @ref CeedOperatorSetFDMSharedScaling(), a single scaling is stored for all elements.
 
   Note: Calling this function asserts that setup is complete and sets the `CeedOperator` as immutable.
 
@@ -2826,7 +4020,7 @@ int CeedOperatorMultigridLevelCreateH1(CeedOperator op_fine, CeedVector p_mult_f
 int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv, CeedRequest *request) {
   Ceed                 ceed, ceed_parent;
   bool                 interp = false, grad = false, is_tensor_basis = true;
-  CeedInt              num_input_fields, P_1d, Q_1d, num_nodes, num_qpts, dim, num_comp = 1, num_elem = 1;
+  CeedInt              num_input_fields, P_1d, Q_1d, num_nodes, num_qpts, dim, num_comp = 1, num_elem = 1, num_elem_q_data;
   CeedScalar          *mass, *laplace, *x, *fdm_interp, *lambda, *elem_avg;
   const CeedScalar    *interp_1d, *grad_1d, *q_weight_1d;
   CeedVector           q_data;
@@ -2886,6 +4080,7 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
   CeedCall(CeedBasisGetDimension(basis, &dim));
   CeedCall(CeedBasisGetNumComponents(basis, &num_comp));
   CeedCall(CeedElemRestrictionGetNumElements(rstr, &num_elem));
+  num_elem_q_data = num_elem;
 
   // Build and diagonalize 1D Mass and Laplacian
   CeedCall(CeedBasisIsTensor(basis, &is_tensor_basis));
@@ -2972,10 +4167,16 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
         if (fabs(fdm_diagonal[c * num_nodes + n]) < fdm_diagonal_bound) fdm_diagonal[c * num_nodes + n] = fdm_diagonal_bound;
       }
     }
-    CeedCall(CeedVectorCreate(ceed_parent, num_elem * num_comp * num_nodes, &q_data));
+    if (op->use_fdm_shared_scaling && num_elem > 0) {
+      // Average the element scaling over all elements
+      for (CeedInt e = 1; e < num_elem; e++) elem_avg[0] += elem_avg[e];
+      elem_avg[0] /= num_elem;
+      num_elem_q_data = 1;
+    }
+    CeedCall(CeedVectorCreate(ceed_parent, num_elem_q_data * num_comp * num_nodes, &q_data));
     CeedCall(CeedVectorSetValue(q_data, 0.0));
     CeedCall(CeedVectorGetArrayWrite(q_data, CEED_MEM_HOST, &q_data_array));
-    for (CeedInt e = 0; e < num_elem; e++) {
+    for (CeedInt e = 0; e < num_elem_q_data; e++) {
       for (CeedInt c = 0; c < num_comp; c++) {
         for (CeedInt n = 0; n < num_nodes; n++) {
           q_data_array[(e * num_comp + c) * num_nodes + n] = 1. / (elem_avg[e] * fdm_diagonal[c * num_nodes + n]);
@@ -3003,11 +4204,11 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
     CeedCall(CeedFree(&lambda));
   }
 
-  // -- Restriction
+  // -- Restriction, with element stride 0 for shared scaling
   {
-    CeedInt strides[3] = {1, num_nodes, num_nodes * num_comp};
+    CeedInt strides[3] = {1, num_nodes, num_elem_q_data == 1 ? 0 : num_nodes * num_comp};
     CeedCall(CeedElemRestrictionCreateStrided(ceed_parent, num_elem, num_nodes, num_comp,
-                                              (CeedSize)num_elem * (CeedSize)num_comp * (CeedSize)num_nodes, strides, &rstr_qd_i));
+                                              (CeedSize)num_elem_q_data * (CeedSize)num_comp * (CeedSize)num_nodes, strides, &rstr_qd_i));
   }
 
   // -- QFunction
@@ -3048,4 +4249,163 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Build a point-block Jacobi inverse for a square linear `CeedOperator`.
+
+  This returns a `CeedOperator` applying the inverse of the `num_comp * num_comp` point-block diagonal, as given by @ref CeedOperatorLinearAssemblePointBlockDiagonal().
+  The point blocks are inverted in batches of nodes by Gauss-Jordan elimination without pivoting, so each block must be invertible without row exchanges, such as for symmetric positive definite or diagonally dominant blocks.
+  The inverted blocks are stored interleaved across each batch of nodes, `[batch, component out, component in, node]`, so both the inversion and the application vectorize across nodes.
+  The active L-vector must be interlaced or have a component stride equal to the number of nodes.
+  The returned `CeedOperator` does not track later changes to `op`; create a new inverse after updating passive inputs of `op`.
+
+  Note: Calling this function asserts that setup is complete and sets the `CeedOperator` as immutable.
+
+  @param[in]  op      `CeedOperator` to create point-block inverse
+  @param[out] pbj_inv `CeedOperator` to apply the action of the point-block Jacobi inverse
+  @param[in]  request Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorCreatePointBlockJacobi(CeedOperator op, CeedOperator *pbj_inv, CeedRequest *request) {
+  Ceed                ceed;
+  bool                is_singular = false;
+  CeedInt             num_comp, comp_stride, num_block_values, num_nodes, num_elem, elem_size, *offsets;
+  CeedSize            input_size, output_size;
+  CeedScalar         *pivot, *factor, *inv_array;
+  const CeedScalar   *point_block_array;
+  CeedVector          point_block_diag, inv;
+  CeedElemRestriction rstr, rstr_inv;
+  CeedQFunction       qf_pbj;
+
+  CeedCall(CeedOperatorCheckReady(op));
+  CeedCall(CeedOperatorGetActiveNodeLayout(op, &num_comp, &comp_stride));
+  CeedCall(CeedOperatorGetActiveVectorLengths(op, &input_size, &output_size));
+  num_block_values = num_comp * num_comp;
+  num_nodes        = output_size / num_comp;
+  CeedCheck(num_nodes > 0, CeedOperatorReturnCeed(op), CEED_ERROR_DIMENSION, "Operator must have at least one active node");
+  CeedCall(CeedOperatorGetCeed(op, &ceed));
+
+  // Group nodes into elements, with the final element padded by the last node
+  elem_size = CeedIntMin(num_nodes, 64);
+  num_elem  = (num_nodes + elem_size - 1) / elem_size;
+
+  // Assemble point-block diagonal
+  CeedCall(CeedVectorCreate(ceed, output_size * num_comp, &point_block_diag));
+  CeedCall(CeedOperatorLinearAssemblePointBlockDiagonal(op, point_block_diag, request));
+
+  // Invert point blocks, interleaved across the nodes of each element
+  CeedCall(CeedVectorCreate(ceed, (CeedSize)num_elem * elem_size * num_block_values, &inv));
+  CeedCall(CeedVectorGetArrayRead(point_block_diag, CEED_MEM_HOST, &point_block_array));
+  CeedCall(CeedVectorGetArrayWrite(inv, CEED_MEM_HOST, &inv_array));
+  CeedCall(CeedCalloc(elem_size, &pivot));
+  CeedCall(CeedCalloc(elem_size, &factor));
+  for (CeedInt e = 0; e < num_elem; e++) {
+    const CeedInt num_active = CeedIntMin(elem_size, num_nodes - e * elem_size);
+    CeedScalar   *block      = &inv_array[(CeedSize)e * elem_size * num_block_values];
+
+    // -- Gather blocks, padding with the identity
+    for (CeedInt c = 0; c < num_block_values; c++) {
+      for (CeedInt i = 0; i < elem_size; i++) {
+        const CeedSize node = (CeedSize)e * elem_size + i;
+
+        block[c * elem_size + i] = i < num_active ? point_block_array[node * num_block_values + c] : (c % (num_comp + 1) == 0);
+      }
+    }
+
+    // -- Gauss-Jordan elimination, in place
+    for (CeedInt k = 0; k < num_comp; k++) {
+      CeedScalar *row_k = &block[k * num_comp * elem_size];
+
+      for (CeedInt i = 0; i < elem_size; i++) is_singular = is_singular || row_k[k * elem_size + i] == 0.0;
+      if (is_singular) break;
+      CeedPragmaSIMD for (CeedInt i = 0; i < elem_size; i++) {
+        pivot[i]                 = 1.0 / row_k[k * elem_size + i];
+        row_k[k * elem_size + i] = 1.0;
+      }
+      for (CeedInt j = 0; j < num_comp; j++) {
+        CeedPragmaSIMD for (CeedInt i = 0; i < elem_size; i++) row_k[j * elem_size + i] *= pivot[i];
+      }
+      for (CeedInt r = 0; r < num_comp; r++) {
+        CeedScalar *row_r = &block[r * num_comp * elem_size];
+
+        if (r == k) continue;
+        CeedPragmaSIMD for (CeedInt i = 0; i < elem_size; i++) {
+          factor[i]                = row_r[k * elem_size + i];
+          row_r[k * elem_size + i] = 0.0;
+        }
+        for (CeedInt j = 0; j < num_comp; j++) {
+          CeedPragmaSIMD for (CeedInt i = 0; i < elem_size; i++) row_r[j * elem_size + i] -= factor[i] * row_k[j * elem_size + i];
+        }
+      }
+    }
+    if (is_singular) break;
+
+    // -- Zero padded blocks so they add nothing to the last node
+    for (CeedInt c = 0; c < num_block_values; c++) {
+      for (CeedInt i = num_active; i < elem_size; i++) block[c * elem_size + i] = 0.0;
+    }
+  }
+  CeedCall(CeedFree(&pivot));
+  CeedCall(CeedFree(&factor));
+  CeedCall(CeedVectorRestoreArrayRead(point_block_diag, &point_block_array));
+  CeedCall(CeedVectorRestoreArray(inv, &inv_array));
+  CeedCall(CeedVectorDestroy(&point_block_diag));
+  if (is_singular) {
+    CeedCall(CeedVectorDestroy(&inv));
+    CeedCall(CeedDestroy(&ceed));
+  }
+  CeedCheck(!is_singular, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED, "Point block diagonal is singular or requires pivoting");
+
+  // Setup point-block Jacobi operator
+  // -- Restrictions
+  CeedCall(CeedMalloc(num_elem * elem_size, &offsets));
+  for (CeedInt i = 0; i < num_elem * elem_size; i++) offsets[i] = CeedIntMin(i, num_nodes - 1) * (comp_stride == 1 ? num_comp : 1);
+  CeedCall(CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, comp_stride, output_size, CEED_MEM_HOST, CEED_OWN_POINTER, offsets, &rstr));
+  {
+    CeedInt strides[3] = {1, elem_size, elem_size * num_block_values};
+
+    CeedCall(CeedElemRestrictionCreateStrided(ceed, num_elem, elem_size, num_block_values, (CeedSize)num_elem * elem_size * num_block_values,
+                                              strides, &rstr_inv));
+  }
+
+  // -- QFunction, applying each inverse block as a linearized QFunction
+  CeedCall(CeedQFunctionCreateInteriorByName(ceed, "AssembledTranspose", &qf_pbj));
+  CeedCall(CeedQFunctionAddInput(qf_pbj, "point block inverse", num_block_values, CEED_EVAL_NONE));
+  CeedCall(CeedQFunctionAddInput(qf_pbj, "input", num_comp, CEED_EVAL_NONE));
+  CeedCall(CeedQFunctionAddOutput(qf_pbj, "output", num_comp, CEED_EVAL_NONE));
+  CeedCall(CeedQFunctionSetUserFlopsEstimate(qf_pbj, 2 * num_block_values));
+
+  // -- Operator
+  CeedCall(CeedOperatorCreate(ceed, qf_pbj, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, pbj_inv));
+  CeedCall(CeedOperatorSetField(*pbj_inv, "point block inverse", rstr_inv, CEED_BASIS_NONE, inv));
+  CeedCall(CeedOperatorSetField(*pbj_inv, "input", rstr, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE));
+  CeedCall(CeedOperatorSetField(*pbj_inv, "output", rstr, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE));
+
+  // -- Context
+  {
+    CeedInt               num_fields = 1;
+    int32_t               sizes[CEED_FIELD_MAX] = {num_comp};
+    CeedContextFieldLabel label;
+
+    CeedCall(CeedOperatorGetContextFieldLabel(*pbj_inv, "num inputs", &label));
+    CeedCall(CeedOperatorSetContextInt32(*pbj_inv, label, &num_fields));
+    CeedCall(CeedOperatorGetContextFieldLabel(*pbj_inv, "num outputs", &label));
+    CeedCall(CeedOperatorSetContextInt32(*pbj_inv, label, &num_fields));
+    CeedCall(CeedOperatorGetContextFieldLabel(*pbj_inv, "input sizes", &label));
+    CeedCall(CeedOperatorSetContextInt32(*pbj_inv, label, sizes));
+    CeedCall(CeedOperatorGetContextFieldLabel(*pbj_inv, "output sizes", &label));
+    CeedCall(CeedOperatorSetContextInt32(*pbj_inv, label, sizes));
+  }
+
+  // Cleanup
+  CeedCall(CeedDestroy(&ceed));
+  CeedCall(CeedVectorDestroy(&inv));
+  CeedCall(CeedElemRestrictionDestroy(&rstr));
+  CeedCall(CeedElemRestrictionDestroy(&rstr_inv));
+  CeedCall(CeedQFunctionDestroy(&qf_pbj));
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
@@ -558,6 +558,27 @@ int CeedQFunctionSetData(CeedQFunction qf, void *data) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the backend function applying a `CeedQFunction`.
+
+  Backends may resolve this function once at setup and call it in element block loops.
+  The `CeedQFunction` is set as immutable, as in @ref CeedQFunctionApply().
+  The function skips the vector length check of @ref CeedQFunctionApply(), so the caller is responsible for it.
+
+  @param[in]  qf    `CeedQFunction`
+  @param[out] apply Variable to store backend function
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedQFunctionGetApplyFunction(CeedQFunction qf, CeedQFunctionApplyFunction *apply) {
+  CeedCheck(qf->Apply, CeedQFunctionReturnCeed(qf), CEED_ERROR_UNSUPPORTED, "Backend does not support CeedQFunctionApply");
+  CeedCall(CeedQFunctionSetImmutable(qf));
+  *apply = qf->Apply;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get a boolean value indicating if the `CeedQFunction` is immutable
 
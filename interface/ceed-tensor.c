@@ -170,6 +170,40 @@ int CeedTensorContractSetData(CeedTensorContract contract, void *data) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get whether tensor-product bases using a `CeedTensorContract` fold 1D matrices with even-odd symmetry
+
+  Folding halves the size of each contraction at the cost of extra passes over the data, which only pays off for contractions that do not already apply small dense matrices at full speed.
+
+  @param[in]  contract     `CeedTensorContract`
+  @param[out] use_even_odd Variable to store even-odd folding status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedTensorContractGetUseEvenOdd(CeedTensorContract contract, bool *use_even_odd) {
+  *use_even_odd = contract->use_even_odd;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Set whether tensor-product bases using a `CeedTensorContract` fold 1D matrices with even-odd symmetry
+
+  Backends set this when creating the `CeedTensorContract`; it is off by default.
+
+  @param[in,out] contract     `CeedTensorContract`
+  @param[in]     use_even_odd Boolean flag to fold 1D matrices with even-odd symmetry
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedTensorContractSetUseEvenOdd(CeedTensorContract contract, bool use_even_odd) {
+  contract->use_even_odd = use_even_odd;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Increment the reference counter for a `CeedTensorContract`
 
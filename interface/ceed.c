@@ -175,6 +175,135 @@ static int CeedWorkVectorsDestroy(Ceed ceed) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Destroy the object cache for a `ceed`.
+
+  Cache entries are weak references that are removed when the objects are destroyed, and each cached object holds a reference to its `Ceed`, so the cache is empty here.
+
+  @param[in,out] ceed `Ceed` to destroy object cache for
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedObjectCacheDestroy(Ceed ceed) {
+  if (!ceed->object_cache) return CEED_ERROR_SUCCESS;
+  CeedCall(CeedFree(&ceed->object_cache->rstrs));
+  CeedCall(CeedFree(&ceed->object_cache->bases));
+  CeedCall(CeedFree(&ceed->object_cache));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Accumulate a 64-bit FNV-1a hash of a block of data.
+
+  Pass `*hash = 0` to start a new hash.
+
+  @param[in]     data      Data to hash
+  @param[in]     num_bytes Number of bytes of `data` to hash
+  @param[in,out] hash      Running hash value
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedHashData(const void *data, size_t num_bytes, uint64_t *hash) {
+  const unsigned char *bytes = (const unsigned char *)data;
+
+  if (*hash == 0) *hash = 14695981039346656037ULL;
+  for (size_t i = 0; i < num_bytes; i++) {
+    *hash ^= bytes[i];
+    *hash *= 1099511628211ULL;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Add a `CeedElemRestriction` to the object cache of a `ceed`.
+
+  The cache holds a weak reference; the `CeedElemRestriction` must be removed with @ref CeedObjectCacheRemoveElemRestriction() when destroyed.
+
+  @param[in,out] ceed `Ceed` holding the object cache
+  @param[in]     rstr `CeedElemRestriction` to add, with `cache_hash` set
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedObjectCacheAddElemRestriction(Ceed ceed, CeedElemRestriction rstr) {
+  if (!ceed->object_cache) CeedCall(CeedCalloc(1, &ceed->object_cache));
+  if (ceed->object_cache->num_rstrs == ceed->object_cache->max_rstrs) {
+    ceed->object_cache->max_rstrs = ceed->object_cache->max_rstrs ? 2 * ceed->object_cache->max_rstrs : 4;
+    CeedCall(CeedRealloc(ceed->object_cache->max_rstrs, &ceed->object_cache->rstrs));
+  }
+  ceed->object_cache->rstrs[ceed->object_cache->num_rstrs++] = rstr;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Remove a `CeedElemRestriction` from the object cache of a `ceed`
+
+  @param[in,out] ceed `Ceed` holding the object cache
+  @param[in]     rstr `CeedElemRestriction` to remove
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedObjectCacheRemoveElemRestriction(Ceed ceed, CeedElemRestriction rstr) {
+  if (!ceed->object_cache) return CEED_ERROR_SUCCESS;
+  for (CeedInt i = 0; i < ceed->object_cache->num_rstrs; i++) {
+    if (ceed->object_cache->rstrs[i] == rstr) {
+      ceed->object_cache->rstrs[i] = ceed->object_cache->rstrs[--ceed->object_cache->num_rstrs];
+      break;
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Add a `CeedBasis` to the object cache of a `ceed`.
+
+  The cache holds a weak reference; the `CeedBasis` must be removed with @ref CeedObjectCacheRemoveBasis() when destroyed.
+
+  @param[in,out] ceed  `Ceed` holding the object cache
+  @param[in]     basis `CeedBasis` to add, with `cache_hash` set
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedObjectCacheAddBasis(Ceed ceed, CeedBasis basis) {
+  if (!ceed->object_cache) CeedCall(CeedCalloc(1, &ceed->object_cache));
+  if (ceed->object_cache->num_bases == ceed->object_cache->max_bases) {
+    ceed->object_cache->max_bases = ceed->object_cache->max_bases ? 2 * ceed->object_cache->max_bases : 4;
+    CeedCall(CeedRealloc(ceed->object_cache->max_bases, &ceed->object_cache->bases));
+  }
+  ceed->object_cache->bases[ceed->object_cache->num_bases++] = basis;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Remove a `CeedBasis` from the object cache of a `ceed`
+
+  @param[in,out] ceed  `Ceed` holding the object cache
+  @param[in]     basis `CeedBasis` to remove
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedObjectCacheRemoveBasis(Ceed ceed, CeedBasis basis) {
+  if (!ceed->object_cache) return CEED_ERROR_SUCCESS;
+  for (CeedInt i = 0; i < ceed->object_cache->num_bases; i++) {
+    if (ceed->object_cache->bases[i] == basis) {
+      ceed->object_cache->bases[i] = ceed->object_cache->bases[--ceed->object_cache->num_bases];
+      break;
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -1100,8 +1229,8 @@ int CeedRegistryGetList(size_t *n, char ***const resources, CeedInt **priorities
   for (size_t i = 0; i < num_backends; i++) {
     // Only report compiled backends
     if (backends[i].priority < CEED_MAX_BACKEND_PRIORITY) {
-      *resources[i] = backends[i].prefix;
-      if (priorities) *priorities[i] = backends[i].priority;
+      (*resources)[*n] = backends[i].prefix;
+      if (priorities) (*priorities)[*n] = backends[i].priority;
       *n += 1;
     }
   }
@@ -1240,6 +1369,7 @@ int CeedInit(const char *resource, Ceed *ceed) {
       CEED_FTABLE_ENTRY(Ceed, OperatorCreate),
       CEED_FTABLE_ENTRY(Ceed, OperatorCreateAtPoints),
       CEED_FTABLE_ENTRY(Ceed, CompositeOperatorCreate),
+      CEED_FTABLE_ENTRY(Ceed, ProductOperatorCreate),
       CEED_FTABLE_ENTRY(CeedVector, HasValidArray),
       CEED_FTABLE_ENTRY(CeedVector, HasBorrowedArrayOfType),
       CEED_FTABLE_ENTRY(CeedVector, CopyStrided),
@@ -1265,6 +1395,8 @@ int CeedInit(const char *resource, Ceed *ceed) {
       CEED_FTABLE_ENTRY(CeedElemRestriction, ApplyUnoriented),
       CEED_FTABLE_ENTRY(CeedElemRestriction, ApplyAtPointsInElement),
       CEED_FTABLE_ENTRY(CeedElemRestriction, ApplyBlock),
+      CEED_FTABLE_ENTRY(CeedElemRestriction, ApplyRange),
+      CEED_FTABLE_ENTRY(CeedElemRestriction, ApplyRangeScaled),
       CEED_FTABLE_ENTRY(CeedElemRestriction, GetOffsets),
       CEED_FTABLE_ENTRY(CeedElemRestriction, GetOrientations),
       CEED_FTABLE_ENTRY(CeedElemRestriction, GetCurlOrientations),
@@ -1300,11 +1432,19 @@ int CeedInit(const char *resource, Ceed *ceed) {
       CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleSymbolic),
       CEED_FTABLE_ENTRY(CeedOperator, LinearAssemble),
       CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleSingle),
+      CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleSingleAddSparse),
+      CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleSingleRange),
       CEED_FTABLE_ENTRY(CeedOperator, CreateFDMElementInverse),
       CEED_FTABLE_ENTRY(CeedOperator, Apply),
       CEED_FTABLE_ENTRY(CeedOperator, ApplyComposite),
       CEED_FTABLE_ENTRY(CeedOperator, ApplyAdd),
       CEED_FTABLE_ENTRY(CeedOperator, ApplyAddComposite),
+      CEED_FTABLE_ENTRY(CeedOperator, ApplyAddProduct),
+      CEED_FTABLE_ENTRY(CeedOperator, ApplyAddMulti),
+      CEED_FTABLE_ENTRY(CeedOperator, ApplyAddScaled),
+      CEED_FTABLE_ENTRY(CeedOperator, ApplyAddScaledComposite),
+      CEED_FTABLE_ENTRY(CeedOperator, SetElementMask),
+      CEED_FTABLE_ENTRY(CeedOperator, View),
       CEED_FTABLE_ENTRY(CeedOperator, ApplyJacobian),
       CEED_FTABLE_ENTRY(CeedOperator, Destroy),
       {NULL, 0}  // End of lookup table - used in SetBackendFunction loop
@@ -1442,6 +1582,44 @@ int CeedIsDeterministic(Ceed ceed, bool *is_deterministic) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Set object caching for a `Ceed` context.
+
+  When `is_object_caching = true`, creating a `CeedElemRestriction` or `CeedBasis` with parameters and data identical to an existing one created with this `Ceed` context returns a reference to the existing object instead of a new object.
+  This includes blocked restrictions derived by backends, so operators sharing restrictions and bases also share the backend data derived from them.
+  Only restrictions with host offsets and bases with all arrays provided are cached, and only objects owning their data are reused.
+  Disabling object caching does not release objects already shared.
+
+  @param[in] ceed              `Ceed` context
+  @param[in] is_object_caching Boolean flag to enable object caching
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedSetObjectCaching(Ceed ceed, bool is_object_caching) {
+  ceed->is_object_caching = is_object_caching;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get object caching status of `Ceed` context.
+
+  Delegate `Ceed` contexts report the status of their parent.
+
+  @param[in]  ceed              `Ceed` context
+  @param[out] is_object_caching Variable to store object caching status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedIsObjectCaching(Ceed ceed, bool *is_object_caching) {
+  if (ceed->parent) return CeedIsObjectCaching(ceed->parent, is_object_caching);
+  *is_object_caching = ceed->is_object_caching;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Set additional JiT source root for `Ceed` context
 
@@ -1605,6 +1783,7 @@ int CeedDestroy(Ceed *ceed) {
   CeedCall(CeedFree(&(*ceed)->resource));
   CeedCall(CeedDestroy(&(*ceed)->op_fallback_ceed));
   CeedCall(CeedWorkVectorsDestroy(*ceed));
+  CeedCall(CeedObjectCacheDestroy(*ceed));
   CeedCall(CeedFree(ceed));
   return CEED_ERROR_SUCCESS;
 }
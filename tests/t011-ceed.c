@@ -0,0 +1,67 @@
+/// @file
+/// Test object caching of CeedElemRestriction and CeedBasis objects
+/// \test Test object caching of CeedElemRestriction and CeedBasis objects
+#include <ceed.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedInt             num_elem = 3, ind[2 * num_elem];
+  CeedElemRestriction elem_restriction_1, elem_restriction_2, elem_restriction_3;
+  CeedBasis           basis_1, basis_2, basis_3;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind[2 * i + 0] = i;
+    ind[2 * i + 1] = i + 1;
+  }
+
+  // Caching disabled by default
+  {
+    bool is_object_caching;
+
+    CeedIsObjectCaching(ceed, &is_object_caching);
+    if (is_object_caching) printf("Object caching should be disabled by default\n");
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_elem + 1, CEED_MEM_HOST, CEED_COPY_VALUES, ind, &elem_restriction_1);
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_elem + 1, CEED_MEM_HOST, CEED_COPY_VALUES, ind, &elem_restriction_2);
+  if (elem_restriction_1 == elem_restriction_2) printf("Restrictions should not be shared without object caching\n");
+  CeedElemRestrictionDestroy(&elem_restriction_1);
+  CeedElemRestrictionDestroy(&elem_restriction_2);
+
+  // Caching enabled
+  CeedSetObjectCaching(ceed, true);
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_elem + 1, CEED_MEM_HOST, CEED_COPY_VALUES, ind, &elem_restriction_1);
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_elem + 1, CEED_MEM_HOST, CEED_COPY_VALUES, ind, &elem_restriction_2);
+  if (elem_restriction_1 != elem_restriction_2) printf("Identical restrictions should be shared with object caching\n");
+  ind[0] = 1;
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_elem + 1, CEED_MEM_HOST, CEED_COPY_VALUES, ind, &elem_restriction_3);
+  if (elem_restriction_1 == elem_restriction_3) printf("Different restrictions should not be shared\n");
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 2, 1, 3, 4, CEED_GAUSS, &basis_1);
+  CeedBasisCreateTensorH1Lagrange(ceed, 2, 1, 3, 4, CEED_GAUSS, &basis_2);
+  CeedBasisCreateTensorH1Lagrange(ceed, 2, 1, 3, 4, CEED_GAUSS_LOBATTO, &basis_3);
+  if (basis_1 != basis_2) printf("Identical bases should be shared with object caching\n");
+  if (basis_1 == basis_3) printf("Different bases should not be shared\n");
+
+  // Destroying one reference leaves the other valid
+  CeedElemRestrictionDestroy(&elem_restriction_1);
+  CeedBasisDestroy(&basis_1);
+  {
+    CeedSize l_size;
+    CeedInt  P;
+
+    CeedElemRestrictionGetLVectorSize(elem_restriction_2, &l_size);
+    if (l_size != num_elem + 1) printf("Shared restriction invalid after destroying reference\n");
+    CeedBasisGetNumNodes(basis_2, &P);
+    if (P != 9) printf("Shared basis invalid after destroying reference\n");
+  }
+
+  CeedElemRestrictionDestroy(&elem_restriction_2);
+  CeedElemRestrictionDestroy(&elem_restriction_3);
+  CeedBasisDestroy(&basis_2);
+  CeedBasisDestroy(&basis_3);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,85 @@
+/// @file
+/// Test reuse of the blocked version of an element restriction
+/// \test Test reuse of the blocked version of an element restriction
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedVector          x, y, y_block;
+  CeedInt             num_elem  = 8;
+  CeedInt             elem_size = 2;
+  CeedInt             blk_size  = 5;
+  CeedInt             ind[elem_size * num_elem];
+  CeedElemRestriction elem_restriction, elem_restriction_block, elem_restriction_block_1, elem_restriction_block_2, elem_restriction_block_3;
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, num_elem + 1, &x);
+  {
+    CeedScalar x_array[num_elem + 1];
+
+    for (CeedInt i = 0; i < num_elem + 1; i++) x_array[i] = 10 + i;
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, blk_size * elem_size, &y);
+  CeedVectorCreate(ceed, blk_size * elem_size, &y_block);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind[2 * i + 0] = i;
+    ind[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, elem_size, 1, 1, num_elem + 1, CEED_MEM_HOST, CEED_COPY_VALUES, ind, &elem_restriction);
+  CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, blk_size, 1, 1, num_elem + 1, CEED_MEM_HOST, CEED_COPY_VALUES, ind,
+                                   &elem_restriction_block);
+
+  // Blocked version is shared between requests for the same block size
+  CeedElemRestrictionGetBlocked(elem_restriction, blk_size, &elem_restriction_block_1);
+  CeedElemRestrictionGetBlocked(elem_restriction, blk_size, &elem_restriction_block_2);
+  if (elem_restriction_block_1 != elem_restriction_block_2) printf("Blocked restriction not reused\n");
+  {
+    CeedInt block_size;
+
+    CeedElemRestrictionGetBlockSize(elem_restriction_block_1, &block_size);
+    if (block_size != blk_size) printf("Incorrect block size %" CeedInt_FMT " != %" CeedInt_FMT "\n", block_size, blk_size);
+  }
+
+  // Blocked versions for other block sizes are kept alongside
+  CeedElemRestrictionDestroy(&elem_restriction_block_2);
+  CeedElemRestrictionGetBlocked(elem_restriction, 1, &elem_restriction_block_3);
+  CeedElemRestrictionGetBlocked(elem_restriction, blk_size, &elem_restriction_block_2);
+  if (elem_restriction_block_1 != elem_restriction_block_2) printf("Blocked restriction not reused after request for another block size\n");
+  if (elem_restriction_block_3 == elem_restriction_block_1) printf("Blocked restriction reused for another block size\n");
+
+  // Blocked version matches explicitly created blocked restriction
+  for (CeedInt b = 0; b < 2; b++) {
+    const CeedScalar *y_array, *y_block_array;
+
+    CeedElemRestrictionApplyBlock(elem_restriction_block, b, CEED_NOTRANSPOSE, x, y, CEED_REQUEST_IMMEDIATE);
+    CeedElemRestrictionApplyBlock(elem_restriction_block_1, b, CEED_NOTRANSPOSE, x, y_block, CEED_REQUEST_IMMEDIATE);
+    CeedVectorGetArrayRead(y, CEED_MEM_HOST, &y_array);
+    CeedVectorGetArrayRead(y_block, CEED_MEM_HOST, &y_block_array);
+    for (CeedInt i = 0; i < blk_size * elem_size; i++) {
+      if (y_array[i] != y_block_array[i]) {
+        // LCOV_EXCL_START
+        printf("Error in block %" CeedInt_FMT " restricted array y[%" CeedInt_FMT "] = %f != %f\n", b, i, (double)y_block_array[i],
+               (double)y_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(y, &y_array);
+    CeedVectorRestoreArrayRead(y_block, &y_block_array);
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&y);
+  CeedVectorDestroy(&y_block);
+  CeedElemRestrictionDestroy(&elem_restriction);
+  CeedElemRestrictionDestroy(&elem_restriction_block);
+  CeedElemRestrictionDestroy(&elem_restriction_block_1);
+  CeedElemRestrictionDestroy(&elem_restriction_block_2);
+  CeedElemRestrictionDestroy(&elem_restriction_block_3);
+  CeedDestroy(&ceed);
+  return 0;
+}
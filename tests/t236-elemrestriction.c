@@ -0,0 +1,114 @@
+/// @file
+/// Test restriction of a range of blocks with a blocked element restriction, including scaled transpose
+/// \test Test restriction of a range of blocks with a blocked element restriction, including scaled transpose
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <math.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedVector          x, x_range, y, y_range;
+  CeedInt             num_elem  = 10;
+  CeedInt             elem_size = 2;
+  CeedInt             blk_size  = 3;
+  CeedInt             ind[elem_size * num_elem];
+  CeedElemRestriction elem_restriction;
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, num_elem + 1, &x);
+  {
+    CeedScalar x_array[num_elem + 1];
+
+    for (CeedInt i = 0; i < num_elem + 1; i++) x_array[i] = 10 + i;
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_elem + 1, &x_range);
+  CeedVectorCreate(ceed, blk_size * elem_size, &y);
+  // E-vector longer than the range
+  CeedVectorCreate(ceed, 3 * blk_size * elem_size, &y_range);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind[2 * i + 0] = i;
+    ind[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, blk_size, 1, 1, num_elem + 1, CEED_MEM_HOST, CEED_COPY_VALUES, ind, &elem_restriction);
+
+  // No Transpose, blocks [1, 3)
+  CeedElemRestrictionApplyRange(elem_restriction, 1, 3, CEED_NOTRANSPOSE, x, y_range, CEED_REQUEST_IMMEDIATE);
+  for (CeedInt b = 1; b < 3; b++) {
+    const CeedScalar *y_array, *y_range_array;
+
+    CeedElemRestrictionApplyBlock(elem_restriction, b, CEED_NOTRANSPOSE, x, y, CEED_REQUEST_IMMEDIATE);
+    CeedVectorGetArrayRead(y, CEED_MEM_HOST, &y_array);
+    CeedVectorGetArrayRead(y_range, CEED_MEM_HOST, &y_range_array);
+    for (CeedInt i = 0; i < blk_size * elem_size; i++) {
+      if (y_array[i] != y_range_array[(b - 1) * blk_size * elem_size + i]) {
+        // LCOV_EXCL_START
+        printf("Error in block %" CeedInt_FMT " restricted array y[%" CeedInt_FMT "] = %f != %f\n", b, i,
+               (double)y_range_array[(b - 1) * blk_size * elem_size + i], (double)y_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(y, &y_array);
+    CeedVectorRestoreArrayRead(y_range, &y_range_array);
+  }
+
+  // Transpose, blocks [1, 3)
+  CeedVectorSetValue(x, 0.0);
+  CeedVectorSetValue(x_range, 0.0);
+  CeedElemRestrictionApplyRange(elem_restriction, 1, 3, CEED_TRANSPOSE, y_range, x_range, CEED_REQUEST_IMMEDIATE);
+  {
+    CeedScalar *y_range_array;
+
+    CeedVectorGetArray(y_range, CEED_MEM_HOST, &y_range_array);
+    for (CeedInt b = 1; b < 3; b++) {
+      CeedVectorSetArray(y, CEED_MEM_HOST, CEED_USE_POINTER, &y_range_array[(b - 1) * blk_size * elem_size]);
+      CeedElemRestrictionApplyBlock(elem_restriction, b, CEED_TRANSPOSE, y, x, CEED_REQUEST_IMMEDIATE);
+      CeedVectorTakeArray(y, CEED_MEM_HOST, NULL);
+    }
+    CeedVectorRestoreArray(y_range, &y_range_array);
+  }
+  {
+    const CeedScalar *x_array, *x_range_array;
+
+    CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array);
+    CeedVectorGetArrayRead(x_range, CEED_MEM_HOST, &x_range_array);
+    for (CeedInt i = 0; i < num_elem + 1; i++) {
+      if (fabs(x_array[i] - x_range_array[i]) > 10 * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("Error in transpose restricted array x[%" CeedInt_FMT "] = %f != %f\n", i, (double)x_range_array[i], (double)x_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(x, &x_array);
+    CeedVectorRestoreArrayRead(x_range, &x_range_array);
+  }
+
+  // Scaled transpose, blocks [1, 3), summing into the transpose above
+  CeedElemRestrictionApplyRangeScaled(elem_restriction, 1, 3, -2.0, y_range, x_range, CEED_REQUEST_IMMEDIATE);
+  {
+    const CeedScalar *x_array, *x_range_array;
+
+    CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array);
+    CeedVectorGetArrayRead(x_range, CEED_MEM_HOST, &x_range_array);
+    for (CeedInt i = 0; i < num_elem + 1; i++) {
+      if (fabs(x_range_array[i] + x_array[i]) > 10 * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("Error in scaled transpose restricted array x[%" CeedInt_FMT "] = %f != %f\n", i, (double)x_range_array[i], -(double)x_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(x, &x_array);
+    CeedVectorRestoreArrayRead(x_range, &x_range_array);
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&x_range);
+  CeedVectorDestroy(&y);
+  CeedVectorDestroy(&y_range);
+  CeedElemRestrictionDestroy(&elem_restriction);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,165 @@
+/// @file
+/// Test product of operators, with and without a shared intermediate restriction
+/// \test Test product of operators, with and without a shared intermediate restriction
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "t500-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass, qf_interp, qf_mass_q;
+  CeedOperator        op_setup, op_mass, op_interp, op_mass_q, op_product_shared, op_product_l_vec;
+  CeedVector          q_data, x, u, v, v_expected, w;
+  CeedInt             num_elem = 15, p = 5, q = 8;
+  CeedInt             num_nodes_x = num_elem + 1, num_nodes_u = num_elem * (p - 1) + 1;
+  CeedInt             ind_x[num_elem * 2], ind_u[num_elem * p];
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, num_nodes_x, &x);
+  {
+    CeedScalar x_array[num_nodes_x];
+
+    for (CeedInt i = 0; i < num_nodes_x; i++) x_array[i] = (CeedScalar)i * i / ((num_nodes_x - 1) * (num_nodes_x - 1));
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_nodes_u, &u);
+  {
+    CeedScalar u_array[num_nodes_u];
+
+    for (CeedInt i = 0; i < num_nodes_u; i++) u_array[i] = sin(i);
+    CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+  }
+  CeedVectorCreate(ceed, num_nodes_u, &v);
+  CeedVectorCreate(ceed, num_nodes_u, &v_expected);
+  CeedVectorCreate(ceed, num_nodes_u, &w);
+  CeedVectorCreate(ceed, num_elem * q, &q_data);
+
+  // Restrictions
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_nodes_x, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p; j++) {
+      ind_u[p * i + j] = i * (p - 1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, 1, 1, num_nodes_u, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, q * num_elem, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedQFunctionCreateIdentity(ceed, 1, CEED_EVAL_INTERP, CEED_EVAL_NONE, &qf_interp);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass_q);
+  CeedQFunctionAddInput(qf_mass_q, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass_q, "u", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddOutput(qf_mass_q, "v", 1, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, x);
+  CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // Mass operator split at the quadrature points, sharing the strided quadrature point restriction
+  CeedOperatorCreate(ceed, qf_interp, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_interp);
+  CeedOperatorSetField(op_interp, "input", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_interp, "output", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetChunkSize(op_interp, 4);
+
+  CeedOperatorCreate(ceed, qf_mass_q, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass_q);
+  CeedOperatorSetField(op_mass_q, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass_q, "u", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_q, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetChunkSize(op_mass_q, 6);
+
+  CeedOperatorCreateProduct(ceed, op_mass_q, op_interp, &op_product_shared);
+
+  // Product of mass operators, with an intermediate L-vector
+  CeedOperatorCreateProduct(ceed, op_mass, op_mass, &op_product_l_vec);
+
+  CeedOperatorApply(op_setup, CEED_VECTOR_NONE, q_data, CEED_REQUEST_IMMEDIATE);
+
+  for (CeedInt k = 0; k < 2; k++) {
+    const char *product_name = k == 0 ? "shared restriction" : "intermediate L-vector";
+
+    if (k == 0) {
+      CeedOperatorApply(op_mass, u, v_expected, CEED_REQUEST_IMMEDIATE);
+      CeedOperatorApply(op_product_shared, u, v, CEED_REQUEST_IMMEDIATE);
+    } else {
+      CeedOperatorApply(op_mass, u, w, CEED_REQUEST_IMMEDIATE);
+      CeedOperatorApply(op_mass, w, v_expected, CEED_REQUEST_IMMEDIATE);
+      CeedOperatorApply(op_product_l_vec, u, v, CEED_REQUEST_IMMEDIATE);
+    }
+
+    // Check output
+    {
+      const CeedScalar *v_array, *v_expected_array;
+
+      CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+      CeedVectorGetArrayRead(v_expected, CEED_MEM_HOST, &v_expected_array);
+      for (CeedInt i = 0; i < num_nodes_u; i++) {
+        if (fabs(v_array[i] - v_expected_array[i]) > 100. * CEED_EPSILON) {
+          // LCOV_EXCL_START
+          printf("[%" CeedInt_FMT "] Error in product operator with %s: %f != %f\n", i, product_name, v_array[i], v_expected_array[i]);
+          // LCOV_EXCL_STOP
+        }
+      }
+      CeedVectorRestoreArrayRead(v, &v_array);
+      CeedVectorRestoreArrayRead(v_expected, &v_expected_array);
+    }
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&v_expected);
+  CeedVectorDestroy(&w);
+  CeedVectorDestroy(&q_data);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedQFunctionDestroy(&qf_interp);
+  CeedQFunctionDestroy(&qf_mass_q);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_interp);
+  CeedOperatorDestroy(&op_mass_q);
+  CeedOperatorDestroy(&op_product_shared);
+  CeedOperatorDestroy(&op_product_l_vec);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,205 @@
+/// @file
+/// Test transpose application of non-symmetric operator
+/// \test Test transpose application of non-symmetric operator
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "t515-operator.h"
+
+// Dot product of two vectors
+static CeedScalar Dot(CeedVector x, CeedVector y) {
+  CeedSize          length;
+  CeedScalar        dot = 0.0;
+  const CeedScalar *x_array, *y_array;
+
+  CeedVectorGetLength(x, &length);
+  CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array);
+  CeedVectorGetArrayRead(y, CEED_MEM_HOST, &y_array);
+  for (CeedSize i = 0; i < length; i++) dot += x_array[i] * y_array[i];
+  CeedVectorRestoreArrayRead(x, &x_array);
+  CeedVectorRestoreArrayRead(y, &y_array);
+  return dot;
+}
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass, qf_adv, qf_adv_transpose;
+  CeedOperator        op_setup, op_mass, op_adv, op_adv_user, op_composite, op_product;
+  CeedVector          q_data, x, u, w, a_u, a_transpose_w, a_transpose_w_user;
+  CeedInt             num_elem = 15, p = 5, q = 8;
+  CeedInt             num_nodes_x = num_elem + 1, num_nodes_u = num_elem * (p - 1) + 1;
+  CeedInt             ind_x[num_elem * 2], ind_u[num_elem * p];
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, num_nodes_x, &x);
+  {
+    CeedScalar x_array[num_nodes_x];
+
+    for (CeedInt i = 0; i < num_nodes_x; i++) x_array[i] = (CeedScalar)i * i / ((num_nodes_x - 1) * (num_nodes_x - 1));
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_nodes_u, &u);
+  {
+    CeedScalar u_array[num_nodes_u];
+
+    for (CeedInt i = 0; i < num_nodes_u; i++) u_array[i] = sin(i);
+    CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+  }
+  CeedVectorCreate(ceed, num_nodes_u, &w);
+  {
+    CeedScalar w_array[num_nodes_u];
+
+    for (CeedInt i = 0; i < num_nodes_u; i++) w_array[i] = cos(2 * i);
+    CeedVectorSetArray(w, CEED_MEM_HOST, CEED_COPY_VALUES, w_array);
+  }
+  CeedVectorCreate(ceed, num_nodes_u, &a_u);
+  CeedVectorCreate(ceed, num_nodes_u, &a_transpose_w);
+  CeedVectorCreate(ceed, num_nodes_u, &a_transpose_w_user);
+  CeedVectorCreate(ceed, num_elem * q, &q_data);
+
+  // Restrictions
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_nodes_x, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p; j++) {
+      ind_u[p * i + j] = i * (p - 1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, 1, 1, num_nodes_u, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, q * num_elem, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedQFunctionCreateInterior(ceed, 1, advection, advection_loc, &qf_adv);
+  CeedQFunctionAddInput(qf_adv, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_adv, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddInput(qf_adv, "du", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_adv, "v", 1, CEED_EVAL_INTERP);
+
+  // Transpose QFunction, with fields matched by name to the fields of the operator
+  CeedQFunctionCreateInterior(ceed, 1, advection_transpose, advection_transpose_loc, &qf_adv_transpose);
+  CeedQFunctionAddInput(qf_adv_transpose, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_adv_transpose, "v", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_adv_transpose, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_adv_transpose, "du", 1, CEED_EVAL_GRAD);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, x);
+  CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // -- Transpose from linearized QFunction
+  CeedOperatorCreate(ceed, qf_adv, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_adv);
+  CeedOperatorSetField(op_adv, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_adv, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_adv, "du", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_adv, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // -- Transpose from user QFunction
+  CeedOperatorCreate(ceed, qf_adv, CEED_QFUNCTION_NONE, qf_adv_transpose, &op_adv_user);
+  CeedOperatorSetField(op_adv_user, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_adv_user, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_adv_user, "du", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_adv_user, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedCompositeOperatorCreate(ceed, &op_composite);
+  CeedCompositeOperatorAddSub(op_composite, op_adv);
+  CeedCompositeOperatorAddSub(op_composite, op_mass);
+
+  CeedOperatorCreateProduct(ceed, op_mass, op_adv, &op_product);
+
+  CeedOperatorApply(op_setup, CEED_VECTOR_NONE, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Check transpose by duality, w^T (A u) = (A^T w)^T u
+  for (CeedInt k = 0; k < 5; k++) {
+    CeedOperator op            = k == 4 ? op_mass : k == 0 ? op_adv : (k == 1 ? op_adv_user : (k == 2 ? op_composite : op_product));
+    const char  *operator_name = k == 0 ? "operator" : (k == 1 ? "operator with transpose QFunction" : (k == 2 ? "composite operator" : "product operator"));
+    CeedScalar   w_a_u, a_transpose_w_u;
+
+    CeedOperatorApply(op, u, a_u, CEED_REQUEST_IMMEDIATE);
+    CeedOperatorApplyTranspose(op, w, a_transpose_w, CEED_REQUEST_IMMEDIATE);
+    w_a_u           = Dot(w, a_u);
+    a_transpose_w_u = Dot(a_transpose_w, u);
+    if (fabs(w_a_u - a_transpose_w_u) > 500. * CEED_EPSILON) {
+      // LCOV_EXCL_START
+      printf("Error in transpose of %s: w^T (A u) = %f != (A^T w)^T u = %f\n", operator_name, w_a_u, a_transpose_w_u);
+      // LCOV_EXCL_STOP
+    }
+  }
+
+  // Linearized and user transpose QFunctions agree after the passive data changes, with the linearized QFunction flagged for re-assembly
+  CeedVectorScale(q_data, 2.0);
+  CeedOperatorSetQFunctionAssemblyDataUpdateNeeded(op_adv, true);
+  CeedOperatorApplyTranspose(op_adv, w, a_transpose_w, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApplyTranspose(op_adv_user, w, a_transpose_w_user, CEED_REQUEST_IMMEDIATE);
+  {
+    const CeedScalar *a_transpose_w_array, *a_transpose_w_user_array;
+
+    CeedVectorGetArrayRead(a_transpose_w, CEED_MEM_HOST, &a_transpose_w_array);
+    CeedVectorGetArrayRead(a_transpose_w_user, CEED_MEM_HOST, &a_transpose_w_user_array);
+    for (CeedInt i = 0; i < num_nodes_u; i++) {
+      if (fabs(a_transpose_w_array[i] - a_transpose_w_user_array[i]) > 100. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Error in transpose from linearized QFunction: %f != %f\n", i, a_transpose_w_array[i], a_transpose_w_user_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(a_transpose_w, &a_transpose_w_array);
+    CeedVectorRestoreArrayRead(a_transpose_w_user, &a_transpose_w_user_array);
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&w);
+  CeedVectorDestroy(&a_u);
+  CeedVectorDestroy(&a_transpose_w);
+  CeedVectorDestroy(&a_transpose_w_user);
+  CeedVectorDestroy(&q_data);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedQFunctionDestroy(&qf_adv);
+  CeedQFunctionDestroy(&qf_adv_transpose);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_adv);
+  CeedOperatorDestroy(&op_adv_user);
+  CeedOperatorDestroy(&op_composite);
+  CeedOperatorDestroy(&op_product);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,45 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed/types.h>
+
+CEED_QFUNCTION(setup)(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {
+  const CeedScalar *weight = in[0], *dxdX = in[1];
+  CeedScalar       *rho = out[0];
+  for (CeedInt i = 0; i < Q; i++) {
+    rho[i] = weight[i] * dxdX[i];
+  }
+  return 0;
+}
+
+CEED_QFUNCTION(mass)(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {
+  const CeedScalar *rho = in[0], *u = in[1];
+  CeedScalar       *v = out[0];
+  for (CeedInt i = 0; i < Q; i++) {
+    v[i] = rho[i] * u[i];
+  }
+  return 0;
+}
+
+CEED_QFUNCTION(advection)(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {
+  const CeedScalar *rho = in[0], *u = in[1], *du = in[2];
+  CeedScalar       *v = out[0];
+  for (CeedInt i = 0; i < Q; i++) {
+    v[i] = rho[i] * (0.5 * u[i] + du[i]);
+  }
+  return 0;
+}
+
+CEED_QFUNCTION(advection_transpose)(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {
+  const CeedScalar *rho = in[0], *v = in[1];
+  CeedScalar       *u = out[0], *du = out[1];
+  for (CeedInt i = 0; i < Q; i++) {
+    u[i]  = 0.5 * rho[i] * v[i];
+    du[i] = rho[i] * v[i];
+  }
+  return 0;
+}
@@ -0,0 +1,148 @@
+/// @file
+/// Test assembly of 3D Poisson operator diagonal on a distorted mesh
+/// \test Test assembly of 3D Poisson operator diagonal on a distorted mesh
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_diff;
+  CeedOperator        op_setup, op_diff;
+  CeedVector          q_data, x, assembled, u, v;
+  CeedInt             p = 3, q = 4, dim = 3;
+  CeedInt             n_x = 3, n_y = 2, n_z = 2;
+  CeedInt             num_elem = n_x * n_y * n_z;
+  CeedInt             num_nodes_x = n_x * (p - 1) + 1, num_nodes_y = n_y * (p - 1) + 1, num_nodes_z = n_z * (p - 1) + 1;
+  CeedInt             num_dofs = num_nodes_x * num_nodes_y * num_nodes_z, num_qpts = num_elem * q * q * q;
+  CeedInt             ind_x[num_elem * p * p * p];
+  CeedScalar          assembled_true[num_dofs];
+
+  CeedInit(argv[1], &ceed);
+
+  // Vectors
+  CeedVectorCreate(ceed, dim * num_dofs, &x);
+  {
+    CeedScalar x_array[dim * num_dofs];
+
+    for (CeedInt k = 0; k < num_nodes_z; k++) {
+      for (CeedInt j = 0; j < num_nodes_y; j++) {
+        for (CeedInt i = 0; i < num_nodes_x; i++) {
+          const CeedInt    node    = i + num_nodes_x * (j + num_nodes_y * k);
+          const CeedScalar perturb = 0.05 * sin((CeedScalar)(i + 2 * j + 3 * k));
+
+          x_array[node + 0 * num_dofs] = (CeedScalar)i / (num_nodes_x - 1) + perturb;
+          x_array[node + 1 * num_dofs] = (CeedScalar)j / (num_nodes_y - 1) - perturb;
+          x_array[node + 2 * num_dofs] = (CeedScalar)k / (num_nodes_z - 1) + 0.5 * perturb;
+        }
+      }
+    }
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_dofs, &u);
+  CeedVectorCreate(ceed, num_dofs, &v);
+  CeedVectorCreate(ceed, num_qpts * dim * (dim + 1) / 2, &q_data);
+
+  // Restrictions
+  for (CeedInt e = 0; e < num_elem; e++) {
+    const CeedInt e_x = e % n_x, e_y = (e / n_x) % n_y, e_z = e / (n_x * n_y);
+
+    for (CeedInt k = 0; k < p; k++) {
+      for (CeedInt j = 0; j < p; j++) {
+        for (CeedInt i = 0; i < p; i++) {
+          ind_x[e * p * p * p + i + p * (j + p * k)] =
+              (e_x * (p - 1) + i) + num_nodes_x * ((e_y * (p - 1) + j) + num_nodes_y * (e_z * (p - 1) + k));
+        }
+      }
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p * p * p, dim, num_dofs, dim * num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+  CeedElemRestrictionCreate(ceed, num_elem, p * p * p, 1, 1, num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q * q * q, q * q * q * dim * (dim + 1) / 2};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q * q * q, dim * (dim + 1) / 2, dim * (dim + 1) / 2 * num_qpts, strides_q_data,
+                                   &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, p, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInteriorByName(ceed, "Poisson3DBuild", &qf_setup);
+  CeedQFunctionCreateInteriorByName(ceed, "Poisson3DApply", &qf_diff);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "weights", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "qdata", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_diff, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_diff);
+  CeedOperatorSetField(op_diff, "du", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_diff, "qdata", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_diff, "dv", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // Apply setup operator
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Assemble diagonal
+  CeedVectorCreate(ceed, num_dofs, &assembled);
+  CeedOperatorLinearAssembleDiagonal(op_diff, assembled, CEED_REQUEST_IMMEDIATE);
+
+  // Manually assemble diagonal
+  CeedVectorSetValue(u, 0.0);
+  for (CeedInt i = 0; i < num_dofs; i++) {
+    CeedScalar       *u_array;
+    const CeedScalar *v_array;
+
+    // Set input
+    CeedVectorGetArray(u, CEED_MEM_HOST, &u_array);
+    u_array[i] = 1.0;
+    if (i) u_array[i - 1] = 0.0;
+    CeedVectorRestoreArray(u, &u_array);
+
+    // Compute diag entry for DoF i
+    CeedOperatorApply(op_diff, u, v, CEED_REQUEST_IMMEDIATE);
+
+    // Retrieve entry
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    assembled_true[i] = v_array[i];
+    CeedVectorRestoreArrayRead(v, &v_array);
+  }
+
+  // Check output
+  {
+    const CeedScalar *assembled_array;
+
+    CeedVectorGetArrayRead(assembled, CEED_MEM_HOST, &assembled_array);
+    for (CeedInt i = 0; i < num_dofs; i++) {
+      if (fabs(assembled_array[i] - assembled_true[i]) > 100. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Error in assembly: %f != %f\n", i, assembled_array[i], assembled_true[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(assembled, &assembled_array);
+  }
+
+  // Cleanup
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&assembled);
+  CeedVectorDestroy(&q_data);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_diff);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_diff);
+  CeedDestroy(&ceed);
+  return 0;
+}
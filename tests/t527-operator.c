@@ -0,0 +1,162 @@
+/// @file
+/// Test composite operator with sub-operators sharing active restrictions and bases
+/// \test Test composite operator with sub-operators sharing active restrictions and bases
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "t500-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u, basis_u_other;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass_1, op_mass_2, op_mass_3, op_composite;
+  CeedVector          q_data_1, q_data_2, x, u, v, v_sum, v_sub;
+  CeedInt             num_elem = 15, p = 5, q = 8;
+  CeedInt             num_nodes_x = num_elem + 1, num_nodes_u = num_elem * (p - 1) + 1;
+  CeedInt             ind_x[num_elem * 2], ind_u[num_elem * p];
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, num_nodes_x, &x);
+  {
+    CeedScalar x_array[num_nodes_x];
+
+    for (CeedInt i = 0; i < num_nodes_x; i++) x_array[i] = (CeedScalar)i / (num_nodes_x - 1);
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_nodes_u, &u);
+  {
+    CeedScalar u_array[num_nodes_u];
+
+    for (CeedInt i = 0; i < num_nodes_u; i++) u_array[i] = sin(i);
+    CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+  }
+  CeedVectorCreate(ceed, num_nodes_u, &v);
+  CeedVectorCreate(ceed, num_nodes_u, &v_sum);
+  CeedVectorCreate(ceed, num_nodes_u, &v_sub);
+  CeedVectorCreate(ceed, num_elem * q, &q_data_1);
+  CeedVectorCreate(ceed, num_elem * q, &q_data_2);
+
+  // Restrictions
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_nodes_x, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p; j++) {
+      ind_u[p * i + j] = i * (p - 1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, 1, 1, num_nodes_u, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, q * num_elem, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p, q, CEED_GAUSS, &basis_u);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p, q, CEED_GAUSS, &basis_u_other);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, x);
+  CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  // Sub-operators 1 and 2 share active restrictions and bases, sub-operator 3 uses a different basis object, and sub-operator 1 is repeated
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass_1);
+  CeedOperatorSetField(op_mass_1, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data_1);
+  CeedOperatorSetField(op_mass_1, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_1, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass_2);
+  CeedOperatorSetField(op_mass_2, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data_2);
+  CeedOperatorSetField(op_mass_2, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_2, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass_3);
+  CeedOperatorSetField(op_mass_3, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data_1);
+  CeedOperatorSetField(op_mass_3, "u", elem_restriction_u, basis_u_other, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_3, "v", elem_restriction_u, basis_u_other, CEED_VECTOR_ACTIVE);
+
+  CeedCompositeOperatorCreate(ceed, &op_composite);
+  CeedCompositeOperatorAddSub(op_composite, op_mass_1);
+  CeedCompositeOperatorAddSub(op_composite, op_mass_2);
+  CeedCompositeOperatorAddSub(op_composite, op_mass_3);
+  CeedCompositeOperatorAddSub(op_composite, op_mass_1);
+
+  CeedOperatorApply(op_setup, CEED_VECTOR_NONE, q_data_1, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_setup, CEED_VECTOR_NONE, q_data_2, CEED_REQUEST_IMMEDIATE);
+  for (CeedInt k = 0; k < 2; k++) {
+    // Passive input of a fused sub-operator changes between applications
+    if (k == 1) CeedVectorScale(q_data_2, -3.0);
+
+    CeedOperatorApply(op_composite, u, v, CEED_REQUEST_IMMEDIATE);
+
+    // Sum of sub-operators applied individually
+    CeedVectorSetValue(v_sum, 0.0);
+    CeedOperatorApply(op_mass_1, u, v_sub, CEED_REQUEST_IMMEDIATE);
+    CeedVectorAXPY(v_sum, 2.0, v_sub);
+    CeedOperatorApply(op_mass_2, u, v_sub, CEED_REQUEST_IMMEDIATE);
+    CeedVectorAXPY(v_sum, 1.0, v_sub);
+    CeedOperatorApply(op_mass_3, u, v_sub, CEED_REQUEST_IMMEDIATE);
+    CeedVectorAXPY(v_sum, 1.0, v_sub);
+
+    // Check output
+    {
+      const CeedScalar *v_array, *v_sum_array;
+
+      CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+      CeedVectorGetArrayRead(v_sum, CEED_MEM_HOST, &v_sum_array);
+      for (CeedInt i = 0; i < num_nodes_u; i++) {
+        if (fabs(v_array[i] - v_sum_array[i]) > 100. * CEED_EPSILON) {
+          // LCOV_EXCL_START
+          printf("[%" CeedInt_FMT ", %" CeedInt_FMT "] Error in composite apply: %f != %f\n", k, i, v_array[i], v_sum_array[i]);
+          // LCOV_EXCL_STOP
+        }
+      }
+      CeedVectorRestoreArrayRead(v, &v_array);
+      CeedVectorRestoreArrayRead(v_sum, &v_sum_array);
+    }
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&v_sum);
+  CeedVectorDestroy(&v_sub);
+  CeedVectorDestroy(&q_data_1);
+  CeedVectorDestroy(&q_data_2);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_u_other);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass_1);
+  CeedOperatorDestroy(&op_mass_2);
+  CeedOperatorDestroy(&op_mass_3);
+  CeedOperatorDestroy(&op_composite);
+  CeedDestroy(&ceed);
+  return 0;
+}
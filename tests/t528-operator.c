@@ -0,0 +1,246 @@
+/// @file
+/// Test application of operator on a subset of elements selected by an element mask
+/// \test Test application of operator on a subset of elements selected by an element mask
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "t500-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass, op_mass_unchunked;
+  CeedVector          q_data, x, u, v, v_full, v_subset;
+  CeedInt             num_elem = 48, p = 5, q = 8;
+  CeedInt             num_nodes_x = num_elem + 1, num_nodes_u = num_elem * (p - 1) + 1;
+  CeedInt             ind_x[num_elem * 2], ind_u[num_elem * p];
+  bool                masks[3][num_elem];
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, num_nodes_x, &x);
+  {
+    CeedScalar x_array[num_nodes_x];
+
+    for (CeedInt i = 0; i < num_nodes_x; i++) x_array[i] = (CeedScalar)i * i / ((num_nodes_x - 1) * (num_nodes_x - 1));
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_nodes_u, &u);
+  {
+    CeedScalar u_array[num_nodes_u];
+
+    for (CeedInt i = 0; i < num_nodes_u; i++) u_array[i] = sin(i);
+    CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+  }
+  CeedVectorCreate(ceed, num_nodes_u, &v);
+  CeedVectorCreate(ceed, num_nodes_u, &v_full);
+  CeedVectorCreate(ceed, num_nodes_u, &v_subset);
+  CeedVectorCreate(ceed, num_elem * q, &q_data);
+
+  // Restrictions
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_nodes_x, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p; j++) {
+      ind_u[p * i + j] = i * (p - 1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, 1, 1, num_nodes_u, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, q * num_elem, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, x);
+  CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetChunkSize(op_mass, 4);
+
+  CeedOperatorApply(op_setup, CEED_VECTOR_NONE, q_data, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_mass, u, v_full, CEED_REQUEST_IMMEDIATE);
+
+  // Element masks, spanning partial element blocks and chunks
+  for (CeedInt e = 0; e < num_elem; e++) {
+    masks[0][e] = e == 1 || e == 2 || e == 3 || e == 9 || e == 14;
+    masks[1][e] = e >= 6 && e < 11;
+    masks[2][e] = e < 2;
+  }
+
+  for (CeedInt k = 0; k < 2; k++) {
+    CeedInt             num_elem_subset = 0, ind_x_subset[num_elem * 2], ind_u_subset[num_elem * p];
+    CeedElemRestriction elem_restriction_x_subset, elem_restriction_u_subset, elem_restriction_q_data_subset;
+    CeedOperator        op_setup_subset, op_mass_subset;
+    CeedVector          q_data_subset;
+
+    // Operator on the selected elements only
+    for (CeedInt e = 0; e < num_elem; e++) {
+      if (!masks[k][e]) continue;
+      for (CeedInt j = 0; j < 2; j++) ind_x_subset[2 * num_elem_subset + j] = ind_x[2 * e + j];
+      for (CeedInt j = 0; j < p; j++) ind_u_subset[p * num_elem_subset + j] = ind_u[p * e + j];
+      num_elem_subset++;
+    }
+    CeedElemRestrictionCreate(ceed, num_elem_subset, 2, 1, 1, num_nodes_x, CEED_MEM_HOST, CEED_COPY_VALUES, ind_x_subset,
+                              &elem_restriction_x_subset);
+    CeedElemRestrictionCreate(ceed, num_elem_subset, p, 1, 1, num_nodes_u, CEED_MEM_HOST, CEED_COPY_VALUES, ind_u_subset,
+                              &elem_restriction_u_subset);
+    CeedElemRestrictionCreateStrided(ceed, num_elem_subset, q, 1, q * num_elem_subset, strides_q_data, &elem_restriction_q_data_subset);
+    CeedVectorCreate(ceed, num_elem_subset * q, &q_data_subset);
+
+    CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup_subset);
+    CeedOperatorSetField(op_setup_subset, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+    CeedOperatorSetField(op_setup_subset, "dx", elem_restriction_x_subset, basis_x, x);
+    CeedOperatorSetField(op_setup_subset, "rho", elem_restriction_q_data_subset, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+    CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass_subset);
+    CeedOperatorSetField(op_mass_subset, "rho", elem_restriction_q_data_subset, CEED_BASIS_NONE, q_data_subset);
+    CeedOperatorSetField(op_mass_subset, "u", elem_restriction_u_subset, basis_u, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_mass_subset, "v", elem_restriction_u_subset, basis_u, CEED_VECTOR_ACTIVE);
+
+    CeedOperatorApply(op_setup_subset, CEED_VECTOR_NONE, q_data_subset, CEED_REQUEST_IMMEDIATE);
+    CeedOperatorApply(op_mass_subset, u, v_subset, CEED_REQUEST_IMMEDIATE);
+
+    // Masked operator
+    CeedOperatorSetElementMask(op_mass, masks[k]);
+    CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+
+    // Check output
+    {
+      const CeedScalar *v_array, *v_subset_array;
+
+      CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+      CeedVectorGetArrayRead(v_subset, CEED_MEM_HOST, &v_subset_array);
+      for (CeedInt i = 0; i < num_nodes_u; i++) {
+        if (fabs(v_array[i] - v_subset_array[i]) > 100. * CEED_EPSILON) {
+          // LCOV_EXCL_START
+          printf("[%" CeedInt_FMT ", %" CeedInt_FMT "] Error in masked apply: %f != %f\n", k, i, v_array[i], v_subset_array[i]);
+          // LCOV_EXCL_STOP
+        }
+      }
+      CeedVectorRestoreArrayRead(v, &v_array);
+      CeedVectorRestoreArrayRead(v_subset, &v_subset_array);
+    }
+
+    CeedVectorDestroy(&q_data_subset);
+    CeedElemRestrictionDestroy(&elem_restriction_x_subset);
+    CeedElemRestrictionDestroy(&elem_restriction_u_subset);
+    CeedElemRestrictionDestroy(&elem_restriction_q_data_subset);
+    CeedOperatorDestroy(&op_setup_subset);
+    CeedOperatorDestroy(&op_mass_subset);
+  }
+
+  // Clearing the mask applies the operator on all elements
+  CeedOperatorSetElementMask(op_mass, NULL);
+  CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+  {
+    const CeedScalar *v_array, *v_full_array;
+
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    CeedVectorGetArrayRead(v_full, CEED_MEM_HOST, &v_full_array);
+    for (CeedInt i = 0; i < num_nodes_u; i++) {
+      if (fabs(v_array[i] - v_full_array[i]) > 100. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Error in apply after clearing mask: %f != %f\n", i, v_array[i], v_full_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(v, &v_array);
+    CeedVectorRestoreArrayRead(v_full, &v_full_array);
+  }
+
+  // Elements in blocks without selected elements are not touched, even when one chunk holds all elements
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass_unchunked);
+  CeedOperatorSetField(op_mass_unchunked, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass_unchunked, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_unchunked, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetElementMask(op_mass_unchunked, masks[2]);
+  for (CeedInt use_elem_assembly = 0; use_elem_assembly < 2; use_elem_assembly++) {
+    CeedOperatorSetElementAssembly(op_mass_unchunked, use_elem_assembly);
+    // Adding to -0.0 gives +0.0, so the sign shows any transpose restriction of zeroed element data
+    CeedVectorSetValue(v, -0.0);
+    CeedOperatorApplyAdd(op_mass_unchunked, u, v, CEED_REQUEST_IMMEDIATE);
+    {
+      const CeedScalar *v_array;
+
+      CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+      // Element blocks hold at most 32 elements, so elements past the first 32 share no block with the selected elements
+      for (CeedInt i = 32 * (p - 1) + 1; i < num_nodes_u; i++) {
+        if (v_array[i] != 0.0 || !signbit(v_array[i])) {
+          // LCOV_EXCL_START
+          printf("[%" CeedInt_FMT ", %" CeedInt_FMT "] Node of element not selected by the mask was touched: %f\n", use_elem_assembly, i,
+                 v_array[i]);
+          // LCOV_EXCL_STOP
+        }
+      }
+      CeedVectorRestoreArrayRead(v, &v_array);
+    }
+  }
+
+  // Element assembly applies the mask
+  CeedOperatorSetElementMask(op_mass_unchunked, masks[0]);
+  CeedOperatorSetElementMask(op_mass, masks[0]);
+  CeedOperatorApply(op_mass, u, v_subset, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_mass_unchunked, u, v, CEED_REQUEST_IMMEDIATE);
+  {
+    const CeedScalar *v_array, *v_subset_array;
+
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    CeedVectorGetArrayRead(v_subset, CEED_MEM_HOST, &v_subset_array);
+    for (CeedInt i = 0; i < num_nodes_u; i++) {
+      if (fabs(v_array[i] - v_subset_array[i]) > 100. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Error in masked element assembly apply: %f != %f\n", i, v_array[i], v_subset_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(v, &v_array);
+    CeedVectorRestoreArrayRead(v_subset, &v_subset_array);
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&v_full);
+  CeedVectorDestroy(&v_subset);
+  CeedVectorDestroy(&q_data);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_mass_unchunked);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,207 @@
+/// @file
+/// Test assembly of symmetric mass matrix operator (multi-component) on simplices
+/// \test Test assembly of symmetric mass matrix operator (multi-component) on simplices
+#include "t573-operator.h"
+
+#include <ceed.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "t320-basis.h"
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass;
+  CeedVector          q_data, x, assembled, assembled_point_block;
+  CeedInt             num_elem = 12, dim = 2, p = 6, q = 4, num_comp = 2;
+  CeedInt             n_x = 3, n_y = 2;
+  CeedInt             row, col, offset;
+  CeedInt             num_dofs = (n_x * 2 + 1) * (n_y * 2 + 1), num_qpts = num_elem * q, num_rows = num_comp * num_dofs;
+  CeedInt             ind_x[num_elem * p];
+  CeedScalar          assembled_true[num_rows * num_rows], point_block_true[num_comp * num_comp * num_dofs];
+  CeedScalar          q_ref[dim * q], q_weight[q];
+  CeedScalar          interp[p * q], grad[dim * p * q];
+
+  CeedInit(argv[1], &ceed);
+
+  // Vectors
+  CeedVectorCreate(ceed, dim * num_dofs, &x);
+  {
+    CeedScalar x_array[dim * num_dofs];
+
+    for (CeedInt i = 0; i < num_dofs; i++) {
+      x_array[i]            = (1. / (n_x * 2)) * (CeedScalar)(i % (n_x * 2 + 1));
+      x_array[i + num_dofs] = (1. / (n_y * 2)) * (CeedScalar)(i / (n_x * 2 + 1));
+    }
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_qpts, &q_data);
+  CeedVectorCreate(ceed, num_comp * num_comp * num_dofs, &assembled_point_block);
+
+  // Restrictions
+  for (CeedInt i = 0; i < num_elem / 2; i++) {
+    col    = i % n_x;
+    row    = i / n_x;
+    offset = col * 2 + row * (n_x * 2 + 1) * 2;
+
+    ind_x[i * 2 * p + 0] = 2 + offset;
+    ind_x[i * 2 * p + 1] = 9 + offset;
+    ind_x[i * 2 * p + 2] = 16 + offset;
+    ind_x[i * 2 * p + 3] = 1 + offset;
+    ind_x[i * 2 * p + 4] = 8 + offset;
+    ind_x[i * 2 * p + 5] = 0 + offset;
+
+    ind_x[i * 2 * p + 6]  = 14 + offset;
+    ind_x[i * 2 * p + 7]  = 7 + offset;
+    ind_x[i * 2 * p + 8]  = 0 + offset;
+    ind_x[i * 2 * p + 9]  = 15 + offset;
+    ind_x[i * 2 * p + 10] = 8 + offset;
+    ind_x[i * 2 * p + 11] = 16 + offset;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, dim, num_dofs, dim * num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+  CeedElemRestrictionCreate(ceed, num_elem, p, num_comp, num_dofs, num_comp * num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_x,
+                            &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, num_qpts, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  Build2DSimplex(q_ref, q_weight, interp, grad);
+  CeedBasisCreateH1(ceed, CEED_TOPOLOGY_TRIANGLE, dim, p, q, interp, grad, q_ref, q_weight, &basis_x);
+
+  Build2DSimplex(q_ref, q_weight, interp, grad);
+  CeedBasisCreateH1(ceed, CEED_TOPOLOGY_TRIANGLE, num_comp, p, q, interp, grad, q_ref, q_weight, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", dim * dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", num_comp, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", num_comp, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // Apply Setup Operator
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Assemble without symmetry, then declare the operator symmetric and assemble again
+  for (CeedInt k = 0; k < num_rows * num_rows; k++) assembled_true[k] = 0.0;
+  for (CeedInt s = 0; s < 2; s++) {
+    const bool        is_symmetric = s == 1;
+    CeedSize          num_entries;
+    CeedInt          *rows, *cols;
+    CeedScalar        assembled_values[num_rows * num_rows];
+    const CeedScalar *assembled_array;
+
+    CeedOperatorSetSymmetric(op_mass, is_symmetric);
+
+    // Coordinate format
+    for (CeedInt k = 0; k < num_rows * num_rows; k++) assembled_values[k] = 0.0;
+    CeedOperatorLinearAssembleSymbolic(op_mass, &num_entries, &rows, &cols);
+    CeedVectorCreate(ceed, num_entries, &assembled);
+    CeedOperatorLinearAssemble(op_mass, assembled);
+    CeedVectorGetArrayRead(assembled, CEED_MEM_HOST, &assembled_array);
+    for (CeedInt k = 0; k < num_entries; k++) assembled_values[rows[k] * num_rows + cols[k]] += assembled_array[k];
+    CeedVectorRestoreArrayRead(assembled, &assembled_array);
+    CeedVectorDestroy(&assembled);
+    free(rows);
+    free(cols);
+
+    // Point block diagonal
+    CeedOperatorLinearAssemblePointBlockDiagonal(op_mass, assembled_point_block, CEED_REQUEST_IMMEDIATE);
+    CeedVectorGetArrayRead(assembled_point_block, CEED_MEM_HOST, &assembled_array);
+    if (!is_symmetric) {
+      for (CeedInt k = 0; k < num_rows * num_rows; k++) assembled_true[k] = assembled_values[k];
+      for (CeedInt k = 0; k < num_comp * num_comp * num_dofs; k++) point_block_true[k] = assembled_array[k];
+    } else {
+      for (CeedInt i = 0; i < num_rows; i++) {
+        for (CeedInt j = 0; j < num_rows; j++) {
+          if (fabs(assembled_values[i * num_rows + j] - assembled_true[i * num_rows + j]) > 100. * CEED_EPSILON) {
+            // LCOV_EXCL_START
+            printf("[%" CeedInt_FMT ", %" CeedInt_FMT "] Error in symmetric assembly: %f != %f\n", i, j, assembled_values[i * num_rows + j],
+                   assembled_true[i * num_rows + j]);
+            // LCOV_EXCL_STOP
+          }
+        }
+      }
+      for (CeedInt k = 0; k < num_comp * num_comp * num_dofs; k++) {
+        if (fabs(assembled_array[k] - point_block_true[k]) > 100. * CEED_EPSILON) {
+          // LCOV_EXCL_START
+          printf("[%" CeedInt_FMT "] Error in symmetric point block diagonal assembly: %f != %f\n", k, assembled_array[k], point_block_true[k]);
+          // LCOV_EXCL_STOP
+        }
+      }
+    }
+    CeedVectorRestoreArrayRead(assembled_point_block, &assembled_array);
+  }
+
+  // CSR format stores only the upper triangle of a symmetric operator
+  {
+    bool              is_symmetric;
+    CeedSize          num_csr_rows, *row_offsets;
+    CeedInt          *col_indices;
+    const CeedScalar *assembled_array;
+
+    CeedOperatorIsSymmetric(op_mass, &is_symmetric);
+    if (!is_symmetric) printf("Operator not reported as symmetric\n");
+    CeedOperatorLinearAssembleSymbolicCSR(op_mass, &num_csr_rows, &row_offsets, &col_indices);
+    CeedVectorCreate(ceed, row_offsets[num_csr_rows], &assembled);
+    CeedOperatorLinearAssembleCSR(op_mass, assembled);
+    CeedVectorGetArrayRead(assembled, CEED_MEM_HOST, &assembled_array);
+    for (CeedInt i = 0; i < num_csr_rows; i++) {
+      for (CeedSize k = row_offsets[i]; k < row_offsets[i + 1]; k++) {
+        const CeedInt j = col_indices[k];
+
+        if (j < i) {
+          // LCOV_EXCL_START
+          printf("[%" CeedInt_FMT ", %" CeedInt_FMT "] Lower triangle entry in symmetric CSR assembly\n", i, j);
+          // LCOV_EXCL_STOP
+        } else if (fabs(assembled_array[k] - assembled_true[i * num_rows + j]) > 100. * CEED_EPSILON) {
+          // LCOV_EXCL_START
+          printf("[%" CeedInt_FMT ", %" CeedInt_FMT "] Error in symmetric CSR assembly: %f != %f\n", i, j, assembled_array[k],
+                 assembled_true[i * num_rows + j]);
+          // LCOV_EXCL_STOP
+        }
+      }
+      if (row_offsets[i + 1] == row_offsets[i] || col_indices[row_offsets[i]] != i) printf("[%" CeedInt_FMT "] Missing CSR diagonal entry\n", i);
+    }
+    CeedVectorRestoreArrayRead(assembled, &assembled_array);
+    CeedVectorDestroy(&assembled);
+    free(row_offsets);
+    free(col_indices);
+  }
+
+  // Cleanup
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&q_data);
+  CeedVectorDestroy(&assembled_point_block);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,150 @@
+/// @file
+/// Test point-block Jacobi inverse of non-symmetric mass matrix operator (multi-component)
+/// \test Test point-block Jacobi inverse of non-symmetric mass matrix operator (multi-component)
+#include "t566-operator.h"
+
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass, op_pbj;
+  CeedVector          q_data, x, u, v, assembled;
+  CeedInt             p = 3, q = 3, dim = 2, num_comp = 2;
+  CeedInt             n_x = 5, n_y = 5;
+  CeedInt             num_elem = n_x * n_y;
+  CeedInt             num_nodes_x = n_x * (p - 1) + 1, num_nodes_y = n_y * (p - 1) + 1;
+  CeedInt             num_dofs = num_nodes_x * num_nodes_y, num_qpts = num_elem * q * q;
+  CeedInt             ind_x[num_elem * p * p], ind_u[num_elem * p * p];
+
+  CeedInit(argv[1], &ceed);
+
+  // Vectors
+  CeedVectorCreate(ceed, dim * num_dofs, &x);
+  {
+    CeedScalar x_array[dim * num_dofs];
+
+    for (CeedInt i = 0; i < num_nodes_x; i++) {
+      for (CeedInt j = 0; j < num_nodes_y; j++) {
+        x_array[i + j * num_nodes_x + 0 * num_dofs] = (CeedScalar)i / (num_nodes_x - 1);
+        x_array[i + j * num_nodes_x + 1 * num_dofs] = (CeedScalar)j / (num_nodes_y - 1);
+      }
+    }
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_comp * num_dofs, &u);
+  {
+    CeedScalar u_array[num_comp * num_dofs];
+
+    for (CeedInt i = 0; i < num_comp * num_dofs; i++) u_array[i] = 1.0 + sin((CeedScalar)i);
+    CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+  }
+  CeedVectorCreate(ceed, num_comp * num_dofs, &v);
+  CeedVectorCreate(ceed, num_qpts, &q_data);
+
+  // Restrictions, with interlaced components for the solution
+  for (CeedInt i = 0; i < num_elem; i++) {
+    CeedInt col, row, offset;
+
+    col    = i % n_x;
+    row    = i / n_x;
+    offset = col * (p - 1) + row * num_nodes_x * (p - 1);
+    for (CeedInt j = 0; j < p; j++) {
+      for (CeedInt k = 0; k < p; k++) {
+        ind_x[p * (p * i + k) + j] = offset + k * num_nodes_x + j;
+        ind_u[p * (p * i + k) + j] = num_comp * ind_x[p * (p * i + k) + j];
+      }
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p * p, dim, num_dofs, dim * num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+  CeedElemRestrictionCreate(ceed, num_elem, p * p, num_comp, 1, num_comp * num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q * q * num_elem, q * q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q * q, 1, num_qpts, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, p, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, num_comp, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", dim * dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", num_comp, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", num_comp, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // Apply Setup Operator
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Assemble point-block diagonal and create point-block Jacobi inverse
+  CeedVectorCreate(ceed, num_comp * num_comp * num_dofs, &assembled);
+  CeedOperatorLinearAssemblePointBlockDiagonal(op_mass, assembled, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorCreatePointBlockJacobi(op_mass, &op_pbj, CEED_REQUEST_IMMEDIATE);
+
+  // Apply inverse and check that each point block maps the result back to the input
+  CeedOperatorApply(op_pbj, u, v, CEED_REQUEST_IMMEDIATE);
+  {
+    const CeedScalar *assembled_array, *u_array, *v_array;
+
+    CeedVectorGetArrayRead(assembled, CEED_MEM_HOST, &assembled_array);
+    CeedVectorGetArrayRead(u, CEED_MEM_HOST, &u_array);
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    for (CeedInt n = 0; n < num_dofs; n++) {
+      for (CeedInt c_out = 0; c_out < num_comp; c_out++) {
+        CeedScalar sum = 0.0;
+
+        for (CeedInt c_in = 0; c_in < num_comp; c_in++) {
+          sum += assembled_array[(n * num_comp + c_out) * num_comp + c_in] * v_array[n * num_comp + c_in];
+        }
+        if (fabs(sum - u_array[n * num_comp + c_out]) > 100. * CEED_EPSILON) {
+          // LCOV_EXCL_START
+          printf("[%" CeedInt_FMT ", %" CeedInt_FMT "] Error in point-block Jacobi inverse: %f != %f\n", n, c_out, sum,
+                 u_array[n * num_comp + c_out]);
+          // LCOV_EXCL_STOP
+        }
+      }
+    }
+    CeedVectorRestoreArrayRead(assembled, &assembled_array);
+    CeedVectorRestoreArrayRead(u, &u_array);
+    CeedVectorRestoreArrayRead(v, &v_array);
+  }
+
+  // Cleanup
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&q_data);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&assembled);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_pbj);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,317 @@
+/// @file
+/// Test Galerkin coarse operators for mass and Poisson operator
+/// \test Test Galerkin coarse operators for mass and Poisson operator
+#include "t535-operator.h"
+
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data_mass, elem_restriction_q_data_diff;
+  CeedElemRestriction elem_restriction_coarse[2];
+  CeedBasis           basis_x, basis_u, basis_coarse[2];
+  CeedQFunction       qf_setup_mass, qf_setup_diff, qf_apply;
+  CeedOperator        op_setup_mass, op_setup_diff, op_apply, op_coarse[2], op_prolong[2], op_restrict[2];
+  CeedVector          q_data_mass, q_data_diff, x, p_mult_fine;
+  CeedInt             p = 5, q = 6, dim = 2;
+  CeedInt             n_x = 9, n_y = 9, num_elem = n_x * n_y;
+  CeedInt             num_nodes_x = n_x * (p - 1) + 1, num_nodes_y = n_y * (p - 1) + 1;
+  CeedInt             num_dofs = num_nodes_x * num_nodes_y, num_qpts = num_elem * q * q;
+  CeedInt             ind_x[num_elem * p * p];
+
+  CeedInit(argv[1], &ceed);
+
+  // Vectors
+  CeedVectorCreate(ceed, dim * num_dofs, &x);
+  {
+    CeedScalar x_array[dim * num_dofs];
+
+    for (CeedInt i = 0; i < num_nodes_x; i++) {
+      for (CeedInt j = 0; j < num_nodes_y; j++) {
+        x_array[i + j * num_nodes_x + 0 * num_dofs] = (CeedScalar)i / (num_nodes_x - 1);
+        x_array[i + j * num_nodes_x + 1 * num_dofs] = (CeedScalar)j / (num_nodes_y - 1);
+      }
+    }
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_qpts, &q_data_mass);
+  CeedVectorCreate(ceed, num_qpts * dim * (dim + 1) / 2, &q_data_diff);
+
+  // Restrictions
+  for (CeedInt i = 0; i < num_elem; i++) {
+    CeedInt col, row, offset;
+
+    col    = i % n_x;
+    row    = i / n_x;
+    offset = col * (p - 1) + row * num_nodes_x * (p - 1);
+    for (CeedInt j = 0; j < p; j++) {
+      for (CeedInt k = 0; k < p; k++) ind_x[p * (p * i + k) + j] = offset + k * num_nodes_x + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p * p, dim, num_dofs, dim * num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+  CeedElemRestrictionCreate(ceed, num_elem, p * p, 1, 1, num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_u);
+
+  CeedInt strides_q_data_mass[3] = {1, q * q, q * q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q * q, 1, num_qpts, strides_q_data_mass, &elem_restriction_q_data_mass);
+
+  CeedInt strides_q_data_diff[3] = {1, q * q, q * q * dim * (dim + 1) / 2};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q * q, dim * (dim + 1) / 2, dim * (dim + 1) / 2 * num_qpts, strides_q_data_diff,
+                                   &elem_restriction_q_data_diff);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, p, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunction - setup mass
+  CeedQFunctionCreateInterior(ceed, 1, setup_mass, setup_mass_loc, &qf_setup_mass);
+  CeedQFunctionAddInput(qf_setup_mass, "dx", dim * dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_setup_mass, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddOutput(qf_setup_mass, "q data", 1, CEED_EVAL_NONE);
+
+  // Operator - setup mass
+  CeedOperatorCreate(ceed, qf_setup_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup_mass);
+  CeedOperatorSetField(op_setup_mass, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup_mass, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup_mass, "q data", elem_restriction_q_data_mass, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  // QFunction - setup diff
+  CeedQFunctionCreateInterior(ceed, 1, setup_diff, setup_diff_loc, &qf_setup_diff);
+  CeedQFunctionAddInput(qf_setup_diff, "dx", dim * dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_setup_diff, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddOutput(qf_setup_diff, "q data", dim * (dim + 1) / 2, CEED_EVAL_NONE);
+
+  // Operator - setup diff
+  CeedOperatorCreate(ceed, qf_setup_diff, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup_diff);
+  CeedOperatorSetField(op_setup_diff, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup_diff, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup_diff, "q data", elem_restriction_q_data_diff, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  // Apply Setup Operators
+  CeedOperatorApply(op_setup_mass, x, q_data_mass, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_setup_diff, x, q_data_diff, CEED_REQUEST_IMMEDIATE);
+
+  // QFunction - apply
+  CeedQFunctionCreateInterior(ceed, 1, apply, apply_loc, &qf_apply);
+  CeedQFunctionAddInput(qf_apply, "du", dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_apply, "mass q data", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_apply, "diff q data", dim * (dim + 1) / 2, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_apply, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_apply, "v", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_apply, "dv", dim, CEED_EVAL_GRAD);
+
+  // Operator - apply
+  CeedOperatorCreate(ceed, qf_apply, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_apply);
+  CeedOperatorSetField(op_apply, "du", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_apply, "mass q data", elem_restriction_q_data_mass, CEED_BASIS_NONE, q_data_mass);
+  CeedOperatorSetField(op_apply, "diff q data", elem_restriction_q_data_diff, CEED_BASIS_NONE, q_data_diff);
+  CeedOperatorSetField(op_apply, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_apply, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_apply, "dv", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // Galerkin coarse operators, degree 4 to 2 to 1
+  CeedOperatorSetMultigridGalerkin(op_apply, true);
+  for (CeedInt l = 0; l < 2; l++) {
+    CeedInt  p_coarse = l == 0 ? 3 : 2, num_nodes_coarse = n_x * (p_coarse - 1) + 1, num_dofs_coarse = num_nodes_coarse * num_nodes_coarse;
+    CeedInt  ind_coarse[num_elem * p_coarse * p_coarse];
+    CeedSize length_fine;
+
+    for (CeedInt i = 0; i < num_elem; i++) {
+      CeedInt col, row, offset;
+
+      col    = i % n_x;
+      row    = i / n_x;
+      offset = col * (p_coarse - 1) + row * num_nodes_coarse * (p_coarse - 1);
+      for (CeedInt j = 0; j < p_coarse; j++) {
+        for (CeedInt k = 0; k < p_coarse; k++) ind_coarse[p_coarse * (p_coarse * i + k) + j] = offset + k * num_nodes_coarse + j;
+      }
+    }
+    CeedElemRestrictionCreate(ceed, num_elem, p_coarse * p_coarse, 1, 1, num_dofs_coarse, CEED_MEM_HOST, CEED_COPY_VALUES, ind_coarse,
+                              &elem_restriction_coarse[l]);
+    CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, p_coarse, q, CEED_GAUSS, &basis_coarse[l]);
+    CeedOperatorGetActiveVectorLengths(l == 0 ? op_apply : op_coarse[0], NULL, &length_fine);
+    CeedVectorCreate(ceed, length_fine, &p_mult_fine);
+    CeedVectorSetValue(p_mult_fine, 1.0);
+    // Coarse to fine interpolation, perturbed away from the element boundaries so the Galerkin operator differs from rediscretization
+    {
+      CeedInt           p_fine = l == 0 ? p : 3;
+      const CeedScalar *interp_lagrange;
+      CeedScalar        interp_c_to_f[p_fine * p_coarse];
+      CeedBasis         basis_c_to_f;
+
+      CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p_coarse, p_fine, CEED_GAUSS_LOBATTO, &basis_c_to_f);
+      CeedBasisGetInterp1D(basis_c_to_f, &interp_lagrange);
+      for (CeedInt i = 0; i < p_fine * p_coarse; i++) {
+        const bool is_end_row = i / p_coarse == 0 || i / p_coarse == p_fine - 1;
+
+        interp_c_to_f[i] = (is_end_row ? 1.0 : 1.0 + 0.1 * sin((CeedScalar)i)) * interp_lagrange[i];
+      }
+      CeedOperatorMultigridLevelCreateTensorH1(l == 0 ? op_apply : op_coarse[0], p_mult_fine, elem_restriction_coarse[l], basis_coarse[l],
+                                               interp_c_to_f, &op_coarse[l], &op_prolong[l], &op_restrict[l]);
+      CeedBasisDestroy(&basis_c_to_f);
+    }
+    CeedVectorDestroy(&p_mult_fine);
+
+    // Compare with P^T A P
+    {
+      const CeedScalar *v_array, *v_true_array, *diag_array;
+      CeedVector        u_coarse, v_coarse, v_true_coarse, diag_coarse, u_fine, v_fine;
+
+      CeedVectorCreate(ceed, num_dofs_coarse, &u_coarse);
+      CeedVectorCreate(ceed, num_dofs_coarse, &v_coarse);
+      CeedVectorCreate(ceed, num_dofs_coarse, &v_true_coarse);
+      CeedVectorCreate(ceed, num_dofs_coarse, &diag_coarse);
+      CeedVectorCreate(ceed, length_fine, &u_fine);
+      CeedVectorCreate(ceed, length_fine, &v_fine);
+      {
+        CeedScalar u_array[num_dofs_coarse];
+
+        for (CeedInt i = 0; i < num_dofs_coarse; i++) u_array[i] = 1.0 + sin((CeedScalar)i);
+        CeedVectorSetArray(u_coarse, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+      }
+      CeedOperatorApply(op_prolong[l], u_coarse, u_fine, CEED_REQUEST_IMMEDIATE);
+      CeedOperatorApply(l == 0 ? op_apply : op_coarse[0], u_fine, v_fine, CEED_REQUEST_IMMEDIATE);
+      CeedOperatorApply(op_restrict[l], v_fine, v_true_coarse, CEED_REQUEST_IMMEDIATE);
+      CeedOperatorApply(op_coarse[l], u_coarse, v_coarse, CEED_REQUEST_IMMEDIATE);
+
+      CeedVectorGetArrayRead(v_coarse, CEED_MEM_HOST, &v_array);
+      CeedVectorGetArrayRead(v_true_coarse, CEED_MEM_HOST, &v_true_array);
+      for (CeedInt i = 0; i < num_dofs_coarse; i++) {
+        if (fabs(v_array[i] - v_true_array[i]) > 1000. * CEED_EPSILON) {
+          // LCOV_EXCL_START
+          printf("[%" CeedInt_FMT "] Error in level %" CeedInt_FMT " Galerkin apply: %f != %f\n", i, l + 1, v_array[i], v_true_array[i]);
+          // LCOV_EXCL_STOP
+        }
+      }
+      CeedVectorRestoreArrayRead(v_coarse, &v_array);
+      CeedVectorRestoreArrayRead(v_true_coarse, &v_true_array);
+
+      // Diagonal from columns of the Galerkin operator
+      CeedOperatorLinearAssembleDiagonal(op_coarse[l], diag_coarse, CEED_REQUEST_IMMEDIATE);
+      CeedVectorGetArrayRead(diag_coarse, CEED_MEM_HOST, &diag_array);
+      for (CeedInt i = 0; i < num_dofs_coarse; i++) {
+        CeedScalar *u_array;
+
+        CeedVectorGetArray(u_coarse, CEED_MEM_HOST, &u_array);
+        for (CeedInt j = 0; j < num_dofs_coarse; j++) u_array[j] = i == j;
+        CeedVectorRestoreArray(u_coarse, &u_array);
+        CeedOperatorApply(op_coarse[l], u_coarse, v_coarse, CEED_REQUEST_IMMEDIATE);
+        CeedVectorGetArrayRead(v_coarse, CEED_MEM_HOST, &v_array);
+        if (fabs(diag_array[i] - v_array[i]) > 1000. * CEED_EPSILON) {
+          // LCOV_EXCL_START
+          printf("[%" CeedInt_FMT "] Error in level %" CeedInt_FMT " Galerkin diagonal: %f != %f\n", i, l + 1, diag_array[i], v_array[i]);
+          // LCOV_EXCL_STOP
+        }
+        CeedVectorRestoreArrayRead(v_coarse, &v_array);
+      }
+      CeedVectorRestoreArrayRead(diag_coarse, &diag_array);
+
+      // Point block diagonal from the assembled Galerkin operator
+      {
+        CeedSize          num_entries;
+        CeedInt          *rows, *cols;
+        CeedScalar        diag_true[num_dofs_coarse];
+        const CeedScalar *values_array;
+        CeedVector        values;
+
+        CeedOperatorLinearAssembleSymbolic(op_coarse[l], &num_entries, &rows, &cols);
+        CeedVectorCreate(ceed, num_entries, &values);
+        CeedOperatorLinearAssemble(op_coarse[l], values);
+        for (CeedInt i = 0; i < num_dofs_coarse; i++) diag_true[i] = 0.0;
+        CeedVectorGetArrayRead(values, CEED_MEM_HOST, &values_array);
+        for (CeedSize k = 0; k < num_entries; k++) {
+          if (rows[k] == cols[k]) diag_true[rows[k]] += values_array[k];
+        }
+        CeedVectorRestoreArrayRead(values, &values_array);
+
+        CeedOperatorLinearAssemblePointBlockDiagonal(op_coarse[l], diag_coarse, CEED_REQUEST_IMMEDIATE);
+        CeedVectorGetArrayRead(diag_coarse, CEED_MEM_HOST, &diag_array);
+        for (CeedInt i = 0; i < num_dofs_coarse; i++) {
+          if (fabs(diag_array[i] - diag_true[i]) > 1000. * CEED_EPSILON) {
+            // LCOV_EXCL_START
+            printf("[%" CeedInt_FMT "] Error in level %" CeedInt_FMT " Galerkin point block diagonal: %f != %f\n", i, l + 1, diag_array[i],
+                   diag_true[i]);
+            // LCOV_EXCL_STOP
+          }
+        }
+        CeedVectorRestoreArrayRead(diag_coarse, &diag_array);
+        CeedVectorDestroy(&values);
+        free(rows);
+        free(cols);
+      }
+
+      CeedVectorDestroy(&u_coarse);
+      CeedVectorDestroy(&v_coarse);
+      CeedVectorDestroy(&v_true_coarse);
+      CeedVectorDestroy(&diag_coarse);
+      CeedVectorDestroy(&u_fine);
+      CeedVectorDestroy(&v_fine);
+    }
+  }
+
+  // Update of the fine QFunction data marks all Galerkin levels for re-assembly
+  {
+    CeedSize          length_coarse;
+    const CeedScalar *v_array, *v_scaled_array;
+    CeedVector        u_coarse, v_coarse, v_scaled_coarse;
+
+    CeedOperatorGetActiveVectorLengths(op_coarse[1], &length_coarse, NULL);
+    CeedVectorCreate(ceed, length_coarse, &u_coarse);
+    CeedVectorCreate(ceed, length_coarse, &v_coarse);
+    CeedVectorCreate(ceed, length_coarse, &v_scaled_coarse);
+    {
+      CeedScalar u_array[length_coarse];
+
+      for (CeedInt i = 0; i < length_coarse; i++) u_array[i] = 1.0 + sin((CeedScalar)i);
+      CeedVectorSetArray(u_coarse, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+    }
+    CeedOperatorApply(op_coarse[1], u_coarse, v_coarse, CEED_REQUEST_IMMEDIATE);
+    CeedVectorScale(q_data_mass, 2.0);
+    CeedVectorScale(q_data_diff, 2.0);
+    CeedOperatorSetQFunctionAssemblyDataUpdateNeeded(op_apply, true);
+    CeedOperatorApply(op_coarse[1], u_coarse, v_scaled_coarse, CEED_REQUEST_IMMEDIATE);
+
+    CeedVectorGetArrayRead(v_coarse, CEED_MEM_HOST, &v_array);
+    CeedVectorGetArrayRead(v_scaled_coarse, CEED_MEM_HOST, &v_scaled_array);
+    for (CeedInt i = 0; i < length_coarse; i++) {
+      if (fabs(v_scaled_array[i] - 2.0 * v_array[i]) > 1000. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Error in updated Galerkin apply: %f != %f\n", i, v_scaled_array[i], 2.0 * v_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(v_coarse, &v_array);
+    CeedVectorRestoreArrayRead(v_scaled_coarse, &v_scaled_array);
+    CeedVectorDestroy(&u_coarse);
+    CeedVectorDestroy(&v_coarse);
+    CeedVectorDestroy(&v_scaled_coarse);
+  }
+
+  // Cleanup
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&q_data_mass);
+  CeedVectorDestroy(&q_data_diff);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data_mass);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data_diff);
+  for (CeedInt l = 0; l < 2; l++) {
+    CeedElemRestrictionDestroy(&elem_restriction_coarse[l]);
+    CeedBasisDestroy(&basis_coarse[l]);
+    CeedOperatorDestroy(&op_coarse[l]);
+    CeedOperatorDestroy(&op_prolong[l]);
+    CeedOperatorDestroy(&op_restrict[l]);
+  }
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup_mass);
+  CeedQFunctionDestroy(&qf_setup_diff);
+  CeedQFunctionDestroy(&qf_apply);
+  CeedOperatorDestroy(&op_setup_mass);
+  CeedOperatorDestroy(&op_setup_diff);
+  CeedOperatorDestroy(&op_apply);
+  CeedDestroy(&ceed);
+  return 0;
+}
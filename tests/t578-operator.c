@@ -0,0 +1,118 @@
+/// @file
+/// Test that assembly of a CeedOperator declared symmetric only computes the upper triangle of element matrices
+/// \test Test that assembly of a CeedOperator declared symmetric only computes the upper triangle of element matrices
+#include "t578-operator.h"
+
+#include <ceed.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_u;
+  CeedBasis           basis_u[2];
+  CeedQFunction       qf_convection;
+  CeedInt             num_elem = 5, p = 4, q = 5;
+  CeedInt             num_dofs = num_elem * (p - 1) + 1;
+  CeedInt             ind_u[num_elem * p];
+  CeedScalar          assembled_true[num_dofs * num_dofs];
+  // Only CPU backends restrict assembly of symmetric operators to the upper triangle
+  const bool          is_triangle = !strncmp(argv[1], "/cpu/self", 9);
+
+  CeedInit(argv[1], &ceed);
+
+  // Restriction, with local node order increasing with the global node order, so local and global upper triangles match
+  for (CeedInt e = 0; e < num_elem; e++) {
+    for (CeedInt i = 0; i < p; i++) ind_u[e * p + i] = e * (p - 1) + i;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, 1, 1, num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+
+  // Bases, tensor-product and the same basis without tensor structure
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p, q, CEED_GAUSS, &basis_u[0]);
+  {
+    const CeedScalar *interp, *grad, *q_ref, *q_weight;
+
+    CeedBasisGetInterp1D(basis_u[0], &interp);
+    CeedBasisGetGrad1D(basis_u[0], &grad);
+    CeedBasisGetQRef(basis_u[0], &q_ref);
+    CeedBasisGetQWeights(basis_u[0], &q_weight);
+    CeedBasisCreateH1(ceed, CEED_TOPOLOGY_LINE, 1, p, q, interp, grad, q_ref, q_weight, &basis_u[1]);
+  }
+
+  // QFunction, v = du / dx is not symmetric
+  CeedQFunctionCreateInterior(ceed, 1, convection, convection_loc, &qf_convection);
+  CeedQFunctionAddInput(qf_convection, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_convection, "du", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_convection, "v", 1, CEED_EVAL_INTERP);
+
+  for (CeedInt b = 0; b < 2; b++) {
+    CeedOperator op_convection;
+
+    CeedOperatorCreate(ceed, qf_convection, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_convection);
+    CeedOperatorSetField(op_convection, "weight", CEED_ELEMRESTRICTION_NONE, basis_u[b], CEED_VECTOR_NONE);
+    CeedOperatorSetField(op_convection, "du", elem_restriction_u, basis_u[b], CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_convection, "v", elem_restriction_u, basis_u[b], CEED_VECTOR_ACTIVE);
+
+    // Assemble without symmetry, then declare the non-symmetric operator symmetric and assemble again
+    for (CeedInt s = 0; s < 2; s++) {
+      const bool        is_symmetric = s == 1;
+      CeedSize          num_entries;
+      CeedInt          *rows, *cols;
+      CeedScalar        assembled_values[num_dofs * num_dofs];
+      CeedVector        assembled;
+      const CeedScalar *assembled_array;
+
+      CeedOperatorSetSymmetric(op_convection, is_symmetric);
+      for (CeedInt k = 0; k < num_dofs * num_dofs; k++) assembled_values[k] = 0.0;
+      CeedOperatorLinearAssembleSymbolic(op_convection, &num_entries, &rows, &cols);
+      CeedVectorCreate(ceed, num_entries, &assembled);
+      CeedOperatorLinearAssemble(op_convection, assembled);
+      CeedVectorGetArrayRead(assembled, CEED_MEM_HOST, &assembled_array);
+      for (CeedInt k = 0; k < num_entries; k++) assembled_values[rows[k] * num_dofs + cols[k]] += assembled_array[k];
+      CeedVectorRestoreArrayRead(assembled, &assembled_array);
+      CeedVectorDestroy(&assembled);
+      free(rows);
+      free(cols);
+
+      if (!is_symmetric) {
+        bool is_nonsymmetric = false;
+
+        for (CeedInt k = 0; k < num_dofs * num_dofs; k++) assembled_true[k] = assembled_values[k];
+        for (CeedInt i = 0; i < num_dofs; i++) {
+          for (CeedInt j = 0; j < i; j++) {
+            is_nonsymmetric = is_nonsymmetric || fabs(assembled_true[i * num_dofs + j] - assembled_true[j * num_dofs + i]) > 1e-3;
+          }
+        }
+        // LCOV_EXCL_START
+        if (!is_nonsymmetric) printf("Assembled convection operator is symmetric\n");
+        // LCOV_EXCL_STOP
+      } else if (is_triangle) {
+        // The lower triangle is the mirror of the computed upper triangle
+        for (CeedInt i = 0; i < num_dofs; i++) {
+          for (CeedInt j = 0; j < num_dofs; j++) {
+            const CeedScalar value = i <= j ? assembled_true[i * num_dofs + j] : assembled_true[j * num_dofs + i];
+
+            if (fabs(assembled_values[i * num_dofs + j] - value) > 100. * CEED_EPSILON) {
+              // LCOV_EXCL_START
+              printf("[%" CeedInt_FMT ", %" CeedInt_FMT "] Error in upper triangle assembly with basis %" CeedInt_FMT ": %f != %f\n", i, j, b,
+                     assembled_values[i * num_dofs + j], value);
+              // LCOV_EXCL_STOP
+            }
+          }
+        }
+      }
+    }
+    CeedOperatorDestroy(&op_convection);
+  }
+
+  // Cleanup
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedBasisDestroy(&basis_u[0]);
+  CeedBasisDestroy(&basis_u[1]);
+  CeedQFunctionDestroy(&qf_convection);
+  CeedDestroy(&ceed);
+  return 0;
+}